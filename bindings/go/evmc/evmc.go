@@ -25,11 +25,12 @@ static inline enum evmc_set_option_result set_option(struct evmc_vm* vm, char* n
 
 extern const struct evmc_host_interface evmc_go_host;
 
+// The addresses and the value are passed by value, so that they do not escape to the Go heap.
 static struct evmc_result execute_wrapper(struct evmc_vm* vm,
 	uintptr_t context_index, enum evmc_revision rev,
 	enum evmc_call_kind kind, uint32_t flags, int32_t depth, int64_t gas,
-	const evmc_address* recipient, const evmc_address* sender,
-	const uint8_t* input_data, size_t input_size, const evmc_uint256be* value,
+	evmc_address recipient, evmc_address sender,
+	const uint8_t* input_data, size_t input_size, evmc_uint256be value,
 	const uint8_t* code, size_t code_size)
 {
 	struct evmc_message msg = {
@@ -37,26 +38,62 @@ static struct evmc_result execute_wrapper(struct evmc_vm* vm,
 		flags,
 		depth,
 		gas,
-		*recipient,
-		*sender,
+		recipient,
+		sender,
 		input_data,
 		input_size,
-		*value,
+		value,
 		{{0}}, // create2_salt: not required for execution
 		{{0}}, // code_address: not required for execution
 		0,     // code
 		0,     // code_size
+		0,     // code_analysis
 	};
 
 	struct evmc_host_context* context = (struct evmc_host_context*)context_index;
 	return evmc_execute(vm, &evmc_go_host, context, rev, &msg, code, code_size);
 }
+
+// The execution result with the output copied to the caller's buffer.
+struct execute_into_result
+{
+	enum evmc_status_code status_code;
+	int64_t gas_left;
+	int64_t gas_refund;
+	size_t output_size;
+};
+
+static struct execute_into_result execute_into_wrapper(struct evmc_vm* vm,
+	uintptr_t context_index, enum evmc_revision rev,
+	enum evmc_call_kind kind, uint32_t flags, int32_t depth, int64_t gas,
+	evmc_address recipient, evmc_address sender,
+	const uint8_t* input_data, size_t input_size, evmc_uint256be value,
+	const uint8_t* code, size_t code_size, uint8_t* output, size_t output_capacity)
+{
+	struct evmc_result result = execute_wrapper(vm, context_index, rev, kind, flags, depth, gas,
+		recipient, sender, input_data, input_size, value, code, code_size);
+	struct execute_into_result r = {
+		result.status_code, result.gas_left, result.gas_refund, result.output_size};
+	if (result.output_size != 0)
+		memcpy(output, evmc_get_output_data(&result),
+			result.output_size < output_capacity ? result.output_size : output_capacity);
+	evmc_release_result(&result);
+	return r;
+}
+
+static void execute_batch_wrapper(struct evmc_vm* vm, uintptr_t context_index,
+	const struct evmc_execution_request* requests, size_t count, struct evmc_result* results)
+{
+	struct evmc_host_context* context = (struct evmc_host_context*)context_index;
+	evmc_execute_batch(vm, &evmc_go_host, context, requests, count, results);
+}
 */
 import "C"
 
 import (
 	"fmt"
 	"sync"
+	"sync/atomic"
 	"unsafe"
 )
 
@@ -215,17 +252,140 @@ func (vm *VM) Execute(ctx HostContext, rev Revision,
 	}
 
 	ctxId := addHostContext(ctx)
-	// FIXME: Clarify passing by pointer vs passing by value.
-	evmcRecipient := evmcAddress(recipient)
-	evmcSender := evmcAddress(sender)
-	evmcValue := evmcBytes32(value)
 	result := C.execute_wrapper(vm.handle, C.uintptr_t(ctxId), uint32(rev),
 		C.enum_evmc_call_kind(kind), flags, C.int32_t(depth), C.int64_t(gas),
-		&evmcRecipient, &evmcSender, bytesPtr(input), C.size_t(len(input)), &evmcValue,
-		bytesPtr(code), C.size_t(len(code)))
+		evmcAddress(recipient), evmcAddress(sender), bytesPtr(input), C.size_t(len(input)),
+		evmcBytes32(value), bytesPtr(code), C.size_t(len(code)))
 	removeHostContext(ctxId)
 
-	res.Output = C.GoBytes(unsafe.Pointer(result.output_data), C.int(result.output_size))
+	return goResult(&result)
+}
+
+// ExecuteInto executes the request like Execute() but without any Go heap allocations.
+// The request can be reused between the calls.
+// The output is copied to the caller's buffer and res.Output is the slice of the buffer.
+// The outputSize is the full size of the output: if it is greater than the buffer size
+// the output has been truncated.
+func (vm *VM) ExecuteInto(ctx HostContext, req *ExecutionRequest, output []byte) (res Result, outputSize int, err error) {
+	flags := C.uint32_t(0)
+	if req.Static {
+		flags |= C.EVMC_STATIC
+	}
+
+	ctxId := addHostContext(ctx)
+	result := C.execute_into_wrapper(vm.handle, C.uintptr_t(ctxId), uint32(req.Rev),
+		C.enum_evmc_call_kind(req.Kind), flags, C.int32_t(req.Depth), C.int64_t(req.Gas),
+		evmcAddress(req.Recipient), evmcAddress(req.Sender),
+		bytesPtr(req.Input), C.size_t(len(req.Input)), evmcBytes32(req.Value),
+		bytesPtr(req.Code), C.size_t(len(req.Code)), bytesPtr(output), C.size_t(len(output)))
+	removeHostContext(ctxId)
+
+	outputSize = int(result.output_size)
+	if outputSize < len(output) {
+		res.Output = output[:outputSize]
+	} else {
+		res.Output = output
+	}
+	res.GasLeft = int64(result.gas_left)
+	res.GasRefund = int64(result.gas_refund)
+	if result.status_code != C.EVMC_SUCCESS {
+		err = Error(result.status_code)
+	}
+	return res, outputSize, err
+}
+
+// ExecutionRequest is a single execution of the batch, see VM.ExecuteBatch().
+type ExecutionRequest struct {
+	Rev       Revision
+	Kind      CallKind
+	Static    bool
+	Depth     int
+	Gas       int64
+	Recipient Address
+	Sender    Address
+	Input     []byte
+	Value     Hash
+	Code      []byte
+}
+
+// ExecuteBatch executes the requests in order within the single Host context.
+// The Go-C boundary is crossed once for the whole batch instead of once per execution.
+// The results and the errors are in the order of the requests.
+func (vm *VM) ExecuteBatch(ctx HostContext, requests []ExecutionRequest) (results []Result, errs []error) {
+	n := len(requests)
+	if n == 0 {
+		return nil, nil
+	}
+
+	// The messages and their data are passed to the VM in C memory,
+	// because the C memory must not keep pointers to Go memory.
+	dataSize := 0
+	for i := range requests {
+		dataSize += len(requests[i].Input) + len(requests[i].Code)
+	}
+	cMsgs := C.calloc(C.size_t(n), C.sizeof_struct_evmc_message)
+	cRequests := C.calloc(C.size_t(n), C.sizeof_struct_evmc_execution_request)
+	cResults := C.calloc(C.size_t(n), C.sizeof_struct_evmc_result)
+	cData := C.malloc(C.size_t(dataSize + 1))
+	defer C.free(cMsgs)
+	defer C.free(cRequests)
+	defer C.free(cResults)
+	defer C.free(cData)
+
+	copyData := func(offset uintptr, bytes []byte) (*C.uint8_t, uintptr) {
+		if len(bytes) == 0 {
+			return nil, offset
+		}
+		dst := unsafe.Pointer(uintptr(cData) + offset)
+		C.memcpy(dst, unsafe.Pointer(&bytes[0]), C.size_t(len(bytes)))
+		return (*C.uint8_t)(dst), offset + uintptr(len(bytes))
+	}
+
+	offset := uintptr(0)
+	for i := range requests {
+		r := &requests[i]
+		msg := (*C.struct_evmc_message)(unsafe.Pointer(
+			uintptr(cMsgs) + uintptr(i)*C.sizeof_struct_evmc_message))
+		req := (*C.struct_evmc_execution_request)(unsafe.Pointer(
+			uintptr(cRequests) + uintptr(i)*C.sizeof_struct_evmc_execution_request))
+
+		msg.kind = C.enum_evmc_call_kind(r.Kind)
+		if r.Static {
+			msg.flags = C.EVMC_STATIC
+		}
+		msg.depth = C.int32_t(r.Depth)
+		msg.gas = C.int64_t(r.Gas)
+		msg.recipient = evmcAddress(r.Recipient)
+		msg.sender = evmcAddress(r.Sender)
+		msg.input_data, offset = copyData(offset, r.Input)
+		msg.input_size = C.size_t(len(r.Input))
+		msg.value = evmcBytes32(r.Value)
+
+		req.rev = uint32(r.Rev)
+		req.msg = msg
+		req.code, offset = copyData(offset, r.Code)
+		req.code_size = C.size_t(len(r.Code))
+	}
+
+	ctxId := addHostContext(ctx)
+	C.execute_batch_wrapper(vm.handle, C.uintptr_t(ctxId),
+		(*C.struct_evmc_execution_request)(cRequests), C.size_t(n),
+		(*C.struct_evmc_result)(cResults))
+	removeHostContext(ctxId)
+
+	results = make([]Result, n)
+	errs = make([]error, n)
+	for i := range results {
+		result := (*C.struct_evmc_result)(unsafe.Pointer(
+			uintptr(cResults) + uintptr(i)*C.sizeof_struct_evmc_result))
+		results[i], errs[i] = goResult(result)
+	}
+	return results, errs
+}
+
+// goResult converts the execution result to Go and releases it.
+func goResult(result *C.struct_evmc_result) (res Result, err error) {
+	res.Output = C.GoBytes(unsafe.Pointer(C.evmc_get_output_data(result)), C.int(result.output_size))
 	res.GasLeft = int64(result.gas_left)
 	res.GasRefund = int64(result.gas_refund)
 	if result.status_code != C.EVMC_SUCCESS {
@@ -233,54 +393,112 @@ func (vm *VM) Execute(ctx HostContext, rev Revision,
 	}
 
 	if result.release != nil {
-		C.evmc_release_result(&result)
+		C.evmc_release_result(result)
 	}
 
 	return res, err
 }
 
+// hostContextSlotsCount is the number of the preallocated host context registry slots.
+// This is the number of the in-flight executions (including the nested ones)
+// registered without any locking.
+const hostContextSlotsCount = 1024
+
+// hostContextEntry is the host context registered for an execution
+// with the data cached for the duration of the execution.
+type hostContextEntry struct {
+	ctx HostContext
+
+	// txContext is the transaction context converted to C by the first query of the execution.
+	// The transaction context is constant during the execution,
+	// so HostContext.GetTxContext() is called at most once per execution.
+	// The cache is per call frame: the nested executions started by HostContext.Call()
+	// are registered separately and fetch the context again.
+	txContext       C.struct_evmc_tx_context
+	txContextCached bool
+}
+
+// hostContextSlot is the host context registry slot.
+// Padded to a multiple of the typical cache line size so that the slots used
+// by different goroutines do not share cache lines.
+type hostContextSlot struct {
+	used uint32
+	hostContextEntry
+	_ [64 - (8+unsafe.Sizeof(hostContextEntry{}))%64]byte
+}
+
 var (
+	// hostContextSlots is the lock-free part of the host context registry.
+	// A slot is claimed with atomic compare-and-swap of the used flag and released with atomic store.
+	// The ctx is written by the claiming goroutine before its index is passed to C
+	// and is only read by the host callbacks of this execution, so it needs no synchronization.
+	hostContextSlots [hostContextSlotsCount]hostContextSlot
+
+	// hostContextNextSlot is the hint where to start looking for a free slot.
+	hostContextNextSlot uint32
+
+	// The overflow part of the host context registry, used when all the slots are taken.
+	// The overflow ids start after the slot indexes.
 	hostContextCounter uintptr
-	hostContextMap     = map[uintptr]HostContext{}
+	hostContextMap     = map[uintptr]*hostContextEntry{}
 	hostContextMapMu   sync.Mutex
 )
 
 func addHostContext(ctx HostContext) uintptr {
+	start := atomic.AddUint32(&hostContextNextSlot, 1)
+	for i := uint32(0); i < hostContextSlotsCount; i++ {
+		id := (start + i) % hostContextSlotsCount
+		slot := &hostContextSlots[id]
+		if atomic.CompareAndSwapUint32(&slot.used, 0, 1) {
+			slot.hostContextEntry = hostContextEntry{ctx: ctx}
+			return uintptr(id)
+		}
+	}
+
 	hostContextMapMu.Lock()
-	id := hostContextCounter
+	id := hostContextSlotsCount + hostContextCounter
 	hostContextCounter++
-	hostContextMap[id] = ctx
+	hostContextMap[id] = &hostContextEntry{ctx: ctx}
 	hostContextMapMu.Unlock()
 	return id
 }
 
 func removeHostContext(id uintptr) {
+	if id < hostContextSlotsCount {
+		slot := &hostContextSlots[id]
+		slot.hostContextEntry = hostContextEntry{}
+		atomic.StoreUint32(&slot.used, 0)
+		return
+	}
+
 	hostContextMapMu.Lock()
 	delete(hostContextMap, id)
 	hostContextMapMu.Unlock()
 }
 
-func getHostContext(idx uintptr) HostContext {
+func getHostContextEntry(idx uintptr) *hostContextEntry {
+	if idx < hostContextSlotsCount {
+		return &hostContextSlots[idx].hostContextEntry
+	}
+
 	hostContextMapMu.Lock()
-	ctx := hostContextMap[idx]
+	entry := hostContextMap[idx]
 	hostContextMapMu.Unlock()
-	return ctx
+	return entry
+}
+
+func getHostContext(idx uintptr) HostContext {
+	return getHostContextEntry(idx).ctx
 }
 
+// evmcBytes32 converts the 32-byte value to C, see goAddress().
 func evmcBytes32(in Hash) C.evmc_bytes32 {
-	out := C.evmc_bytes32{}
-	for i := 0; i < len(in); i++ {
-		out.bytes[i] = C.uint8_t(in[i])
-	}
-	return out
+	return *(*C.evmc_bytes32)(unsafe.Pointer(&in))
 }
 
+// evmcAddress converts the address to C, see goAddress().
 func evmcAddress(address Address) C.evmc_address {
-	r := C.evmc_address{}
-	for i := 0; i < len(address); i++ {
-		r.bytes[i] = C.uint8_t(address[i])
-	}
-	return r
+	return *(*C.evmc_address)(unsafe.Pointer(&address))
 }
 
 func bytesPtr(bytes []byte) *C.uint8_t {
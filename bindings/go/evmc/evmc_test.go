@@ -2,7 +2,7 @@
 // Copyright 2018 The EVMC Authors.
 // Licensed under the Apache License, Version 2.0.
 
-//go:generate g++ -shared ../../../examples/example_vm/example_vm.cpp -I../../../include -o example_vm.so
+//go:generate g++ -shared -fPIC ../../../examples/example_vm/example_vm.cpp -x c ../../../lib/instructions/instruction_descriptors.c -I../../../include -o example_vm.so
 
 package evmc
 
@@ -63,6 +63,44 @@ func TestExecuteEmptyCode(t *testing.T) {
 	}
 }
 
+func TestExecuteBatch(t *testing.T) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+
+	// ADDRESS, MSTORE, MSIZE, RETURN: returns the recipient address.
+	code := []byte("\x30\x60\x00\x52\x59\x60\x00\xf3")
+	requests := []ExecutionRequest{
+		{Rev: Byzantium, Kind: Call, Gas: 999, Recipient: Address{1}, Code: code},
+		{Rev: Cancun, Kind: Call, Gas: 100, Input: []byte{1, 2}},
+		{Rev: Byzantium, Kind: Call, Gas: 999, Recipient: Address{2}, Code: code},
+	}
+
+	results, errs := vm.ExecuteBatch(nil, requests)
+	if len(results) != len(requests) || len(errs) != len(requests) {
+		t.Fatalf("wrong number of results: %d, %d", len(results), len(errs))
+	}
+	for i, r := range requests {
+		expected, expectedErr := vm.Execute(nil, r.Rev, r.Kind, r.Static, r.Depth, r.Gas,
+			r.Recipient, r.Sender, r.Input, r.Value, r.Code)
+		if !bytes.Equal(results[i].Output, expected.Output) {
+			t.Errorf("%d: unexpected output: %x", i, results[i].Output)
+		}
+		if results[i].GasLeft != expected.GasLeft {
+			t.Errorf("%d: unexpected gas left: %d", i, results[i].GasLeft)
+		}
+		if errs[i] != expectedErr {
+			t.Errorf("%d: unexpected error: %v", i, errs[i])
+		}
+	}
+	if results[0].Output[12] != 1 || results[2].Output[12] != 2 {
+		t.Errorf("unexpected outputs: %x, %x", results[0].Output, results[2].Output)
+	}
+
+	if emptyResults, _ := vm.ExecuteBatch(nil, nil); len(emptyResults) != 0 {
+		t.Errorf("unexpected results of empty batch")
+	}
+}
+
 func TestRevision(t *testing.T) {
 	if MaxRevision != Osaka {
 		t.Errorf("missing constant for revision %d", MaxRevision)
@@ -86,3 +124,81 @@ func TestErrorMessage(t *testing.T) {
 	check(Error(-1), "internal error")
 	check(Error(1000), "<unknown>")
 }
+
+func TestExecuteInto(t *testing.T) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+
+	// ADDRESS, MSTORE, MSIZE, RETURN: returns the recipient address.
+	req := ExecutionRequest{Rev: Byzantium, Kind: Call, Gas: 999, Recipient: Address{1},
+		Code: []byte("\x30\x60\x00\x52\x59\x60\x00\xf3")}
+	output := make([]byte, 64)
+
+	result, outputSize, err := vm.ExecuteInto(nil, &req, output)
+	if err != nil {
+		t.Errorf("execution returned unexpected error: %v", err)
+	}
+	if outputSize != 32 || len(result.Output) != 32 || &result.Output[0] != &output[0] {
+		t.Fatalf("execution unexpected output: %d, %x", outputSize, result.Output)
+	}
+	if result.Output[12] != 1 {
+		t.Errorf("execution unexpected output: %x", result.Output)
+	}
+	if result.GasLeft != 993 {
+		t.Errorf("execution gas left is incorrect: %d", result.GasLeft)
+	}
+
+	// Reuse the request with the output buffer too small.
+	req.Recipient = Address{2}
+	result, outputSize, err = vm.ExecuteInto(nil, &req, output[:16])
+	if err != nil {
+		t.Errorf("execution returned unexpected error: %v", err)
+	}
+	if outputSize != 32 || len(result.Output) != 16 {
+		t.Errorf("execution unexpected output: %d, %x", outputSize, result.Output)
+	}
+	if result.Output[12] != 2 {
+		t.Errorf("execution unexpected output: %x", result.Output)
+	}
+}
+
+func TestExecuteIntoAllocs(t *testing.T) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+
+	host := &testHostContext{}
+	// NUMBER, MSTORE, MSIZE, RETURN: returns the block number from the Host.
+	req := ExecutionRequest{Rev: Byzantium, Kind: Call, Gas: 999,
+		Code: []byte("\x43\x60\x00\x52\x59\x60\x00\xf3")}
+	output := make([]byte, 32)
+	allocs := testing.AllocsPerRun(100, func() {
+		vm.ExecuteInto(host, &req, output)
+	})
+	if allocs != 0 {
+		t.Errorf("unexpected number of allocations: %v", allocs)
+	}
+}
+
+func BenchmarkExecute(b *testing.B) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+
+	code := []byte("\x30\x60\x00\x52\x59\x60\x00\xf3")
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		vm.Execute(nil, Byzantium, Call, false, 0, 999, Address{1}, Address{}, nil, Hash{}, code)
+	}
+}
+
+func BenchmarkExecuteInto(b *testing.B) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+
+	req := ExecutionRequest{Rev: Byzantium, Kind: Call, Gas: 999, Recipient: Address{1},
+		Code: []byte("\x30\x60\x00\x52\x59\x60\x00\xf3")}
+	output := make([]byte, 32)
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		vm.ExecuteInto(nil, &req, output)
+	}
+}
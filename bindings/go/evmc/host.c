@@ -6,6 +6,16 @@
 
 #include <stdlib.h>
 
+/* The exported Go function writes the transaction context to the out parameter,
+ * see getTxContext().
+ */
+static struct evmc_tx_context get_tx_context(struct evmc_host_context* context)
+{
+    struct evmc_tx_context tx_context;
+    getTxContext(context, &tx_context);
+    return tx_context;
+}
+
 /* Go does not support exporting functions with parameters with const modifiers,
  * so we have to cast function pointers to the function types defined in EVMC.
  * This disables any type checking of exported Go functions. To mitigate this
@@ -22,13 +32,18 @@ const struct evmc_host_interface evmc_go_host = {
     (evmc_copy_code_fn)copyCode,
     (evmc_selfdestruct_fn)selfdestruct,
     (evmc_call_fn)call,
-    (evmc_get_tx_context_fn)getTxContext,
+    get_tx_context,
     (evmc_get_block_hash_fn)getBlockHash,
     (evmc_emit_log_fn)emitLog,
     (evmc_access_account_fn)accessAccount,
     (evmc_access_storage_fn)accessStorage,
     (evmc_get_transient_storage_fn)getTransientStorage,
     (evmc_set_transient_storage_fn)setTransientStorage,
+    (evmc_get_storage_batch_fn)getStorageBatch,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
 };
 
 
@@ -94,7 +109,7 @@ static inline void go_exported_functions_type_checks()
 
     evmc_get_tx_context_fn get_tx_context_fn = NULL;
     tx_context = get_tx_context_fn(context);
-    tx_context = getTxContext(context);
+    getTxContext(context, &tx_context);
 
     evmc_get_block_hash_fn get_block_hash_fn = NULL;
     bytes32 = get_block_hash_fn(context, number);
@@ -111,4 +126,9 @@ static inline void go_exported_functions_type_checks()
     evmc_access_storage_fn access_storage_fn = NULL;
     access_status = access_storage_fn(context, address, &bytes32);
     access_status = accessStorage(context, address, &bytes32);
+
+    evmc_get_storage_batch_fn get_storage_batch_fn = NULL;
+    evmc_storage_key* storage_key = NULL;
+    get_storage_batch_fn(context, storage_key, &bytes32, size);
+    getStorageBatch(context, storage_key, &bytes32, size);
 }
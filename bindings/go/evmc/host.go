@@ -48,20 +48,15 @@ const (
 	StorageModifiedRestored StorageStatus = C.EVMC_STORAGE_MODIFIED_RESTORED
 )
 
+// goAddress converts the address to Go.
+// The C struct consists only of the byte array of the same size, so the layouts are identical.
 func goAddress(in C.evmc_address) Address {
-	out := Address{}
-	for i := 0; i < len(out); i++ {
-		out[i] = byte(in.bytes[i])
-	}
-	return out
+	return *(*Address)(unsafe.Pointer(&in))
 }
 
+// goHash converts the 32-byte value to Go, see goAddress().
 func goHash(in C.evmc_bytes32) Hash {
-	out := Hash{}
-	for i := 0; i < len(out); i++ {
-		out[i] = byte(in.bytes[i])
-	}
-	return out
+	return *(*Hash)(unsafe.Pointer(&in))
 }
 
 func goByteSlice(data *C.uint8_t, size C.size_t) []byte {
@@ -107,6 +102,39 @@ type HostContext interface {
 	SetTransientStorage(addr Address, key Hash, value Hash)
 }
 
+// StorageKey is the reference to an account storage entry.
+// The layout is identical to the C evmc_storage_key.
+type StorageKey struct {
+	Address Address
+	Key     Hash
+}
+
+// Static asserts.
+const (
+	// The size of evmc_storage_key equals the size of StorageKey.
+	_ = uint(unsafe.Sizeof(StorageKey{}) - unsafe.Sizeof(C.evmc_storage_key{}))
+	_ = uint(unsafe.Sizeof(C.evmc_storage_key{}) - unsafe.Sizeof(StorageKey{}))
+
+	// The offset of evmc_storage_key::key equals the offset of StorageKey.Key.
+	_ = uint(unsafe.Offsetof(StorageKey{}.Key) - unsafe.Offsetof(C.evmc_storage_key{}.key))
+	_ = uint(unsafe.Offsetof(C.evmc_storage_key{}.key) - unsafe.Offsetof(StorageKey{}.Key))
+)
+
+// StorageBatchHostContext is the optional extension of the HostContext
+// resolving multiple storage entries at once.
+//
+// VMs query the storage entries they know in advance (e.g. the constant SLOAD keys)
+// with a single call crossing the C-Go boundary once instead of once per entry.
+// The effect must be the same as calling GetStorage() for each of the keys,
+// which is the implementation used for the HostContexts not implementing this interface.
+type StorageBatchHostContext interface {
+	HostContext
+
+	// GetStorageBatch stores the value at keys[i] in values[i].
+	// The slices are only valid during the call.
+	GetStorageBatch(keys []StorageKey, values []Hash)
+}
+
 //export accountExists
 func accountExists(pCtx unsafe.Pointer, pAddr *C.evmc_address) C.bool {
 	ctx := getHostContext(uintptr(pCtx))
@@ -169,28 +197,34 @@ func selfdestruct(pCtx unsafe.Pointer, pAddr *C.evmc_address, pBeneficiary *C.ev
 	return C.bool(ctx.Selfdestruct(goAddress(*pAddr), goAddress(*pBeneficiary)))
 }
 
+// getTxContext writes the transaction context to the result parameter instead of returning it,
+// because returning a struct containing pointers from an exported function allocates.
+// The converted context is cached in the registry entry, see hostContextEntry.
+//
 //export getTxContext
-func getTxContext(pCtx unsafe.Pointer) C.struct_evmc_tx_context {
-	ctx := getHostContext(uintptr(pCtx))
-
-	txContext := ctx.GetTxContext()
-
-	return C.struct_evmc_tx_context{
-		evmcBytes32(txContext.GasPrice),
-		evmcAddress(txContext.Origin),
-		evmcAddress(txContext.Coinbase),
-		C.int64_t(txContext.Number),
-		C.int64_t(txContext.Timestamp),
-		C.int64_t(txContext.GasLimit),
-		evmcBytes32(txContext.PrevRandao),
-		evmcBytes32(txContext.ChainID),
-		evmcBytes32(txContext.BaseFee),
-		evmcBytes32(txContext.BlobBaseFee),
-		nil, // TODO: Add support for blob hashes.
-		0,
-		nil, // TODO: Add support for transaction initcodes.
-		0,
+func getTxContext(pCtx unsafe.Pointer, pResult *C.struct_evmc_tx_context) {
+	entry := getHostContextEntry(uintptr(pCtx))
+	if !entry.txContextCached {
+		txContext := entry.ctx.GetTxContext()
+		entry.txContext = C.struct_evmc_tx_context{
+			evmcBytes32(txContext.GasPrice),
+			evmcAddress(txContext.Origin),
+			evmcAddress(txContext.Coinbase),
+			C.int64_t(txContext.Number),
+			C.int64_t(txContext.Timestamp),
+			C.int64_t(txContext.GasLimit),
+			evmcBytes32(txContext.PrevRandao),
+			evmcBytes32(txContext.ChainID),
+			evmcBytes32(txContext.BaseFee),
+			evmcBytes32(txContext.BlobBaseFee),
+			nil, // TODO: Add support for blob hashes.
+			0,
+			nil, // TODO: Add support for transaction initcodes.
+			0,
+		}
+		entry.txContextCached = true
 	}
+	*pResult = entry.txContext
 }
 
 //export getBlockHash
@@ -252,6 +286,30 @@ func accessStorage(pCtx unsafe.Pointer, pAddr *C.evmc_address, pKey *C.evmc_byte
 	return C.enum_evmc_access_status(ctx.AccessStorage(goAddress(*pAddr), goHash(*pKey)))
 }
 
+// maxBatchSize is the maximum number of the entries of a batched query,
+// the size of the array types used to view the C arrays as Go slices.
+const maxBatchSize = 1 << 26
+
+//export getStorageBatch
+func getStorageBatch(pCtx unsafe.Pointer, pKeys *C.evmc_storage_key, pValues *C.evmc_bytes32, count C.size_t) {
+	if count == 0 {
+		return
+	}
+	n := int(count)
+	// The C arrays are viewed as Go slices without copying, the layouts are identical.
+	keys := (*[maxBatchSize]StorageKey)(unsafe.Pointer(pKeys))[:n:n]
+	values := (*[maxBatchSize]Hash)(unsafe.Pointer(pValues))[:n:n]
+
+	ctx := getHostContext(uintptr(pCtx))
+	if batchCtx, ok := ctx.(StorageBatchHostContext); ok {
+		batchCtx.GetStorageBatch(keys, values)
+		return
+	}
+	for i := range keys {
+		values[i] = ctx.GetStorage(keys[i].Address, keys[i].Key)
+	}
+}
+
 //export getTransientStorage
 func getTransientStorage(pCtx unsafe.Pointer, pAddr *C.struct_evmc_address, pKey *C.evmc_bytes32) C.evmc_bytes32 {
 	ctx := getHostContext(uintptr(pCtx))
@@ -6,6 +6,7 @@ package evmc
 
 import (
 	"bytes"
+	"sync"
 	"testing"
 )
 
@@ -138,3 +139,173 @@ func TestCall(t *testing.T) {
 		t.Errorf("execution returned unexpected error: %v", err)
 	}
 }
+
+func TestHostContextRegistry(t *testing.T) {
+	// Take all the slots and some overflow entries.
+	const n = hostContextSlotsCount + 10
+	hosts := make([]*testHostContext, n)
+	ids := make([]uintptr, n)
+	seen := map[uintptr]bool{}
+	for i := range hosts {
+		hosts[i] = &testHostContext{}
+		ids[i] = addHostContext(hosts[i])
+		if seen[ids[i]] {
+			t.Fatalf("duplicated host context id: %d", ids[i])
+		}
+		seen[ids[i]] = true
+	}
+	for i, id := range ids {
+		if getHostContext(id) != hosts[i] {
+			t.Errorf("wrong host context for id %d", id)
+		}
+	}
+	for _, id := range ids {
+		removeHostContext(id)
+	}
+	if len(hostContextMap) != 0 {
+		t.Errorf("overflow host contexts not removed: %d", len(hostContextMap))
+	}
+
+	// Concurrent executions.
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+	code := []byte("\x43\x60\x00\x52\x59\x60\x00\xf3") // Returns the block number.
+	var wg sync.WaitGroup
+	for g := 0; g < 16; g++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			host := &testHostContext{}
+			for i := 0; i < 100; i++ {
+				result, err := vm.Execute(host, Byzantium, Call, false, 1, 999, Address{}, Address{}, nil, Hash{}, code)
+				if err != nil || len(result.Output) != 32 || result.Output[31] != 42 {
+					t.Errorf("execution unexpected result: %v, %v", result.Output, err)
+					return
+				}
+			}
+		}()
+	}
+	wg.Wait()
+}
+
+type storageHostContext struct {
+	testHostContext
+	storage      map[Hash]Hash
+	numGetCalls  int
+	numBatchKeys int
+}
+
+func (host *storageHostContext) GetStorage(addr Address, key Hash) Hash {
+	host.numGetCalls++
+	return host.storage[key]
+}
+
+type batchHostContext struct {
+	storageHostContext
+	numBatchCalls int
+}
+
+func (host *batchHostContext) GetStorageBatch(keys []StorageKey, values []Hash) {
+	host.numBatchCalls++
+	host.numBatchKeys += len(keys)
+	for i, k := range keys {
+		values[i] = host.storage[k.Key]
+	}
+}
+
+// storageHeavyCode returns the code loading the storage values at the keys 0..n-1,
+// summing them up and returning the sum.
+func storageHeavyCode(n int) []byte {
+	code := []byte{0x60, 0x00} // PUSH1 0
+	for i := 0; i < n; i++ {
+		code = append(code, 0x60, byte(i), 0x54, 0x01) // PUSH1 i, SLOAD, ADD
+	}
+	return append(code, 0x60, 0x00, 0x52, 0x60, 0x20, 0x60, 0x00, 0xf3)
+}
+
+func TestGetStorageBatch(t *testing.T) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+	if err := vm.SetOption("prefetch_storage", "1"); err != nil {
+		t.Fatalf("SetOption() error: %v", err)
+	}
+
+	code := storageHeavyCode(8)
+	storage := map[Hash]Hash{{31: 1}: {31: 10}, {31: 7}: {31: 5}}
+	req := ExecutionRequest{Rev: Cancun, Kind: Call, Gas: 100000, Code: code}
+	output := make([]byte, 32)
+
+	batchHost := &batchHostContext{storageHostContext: storageHostContext{storage: storage}}
+	res, n, err := vm.ExecuteInto(batchHost, &req, output)
+	if err != nil || n != 32 || output[31] != 15 {
+		t.Fatalf("execution unexpected result: %v, %x, %v", res, output[:n], err)
+	}
+	if batchHost.numBatchCalls != 1 || batchHost.numBatchKeys != 8 || batchHost.numGetCalls != 0 {
+		t.Errorf("unexpected storage queries: %d batches of %d keys, %d single",
+			batchHost.numBatchCalls, batchHost.numBatchKeys, batchHost.numGetCalls)
+	}
+
+	// The HostContext without the batch support gets the queries one by one.
+	host := &storageHostContext{storage: storage}
+	res, n, err = vm.ExecuteInto(host, &req, output)
+	if err != nil || n != 32 || output[31] != 15 {
+		t.Fatalf("execution unexpected result: %v, %x, %v", res, output[:n], err)
+	}
+	if host.numGetCalls != 8 {
+		t.Errorf("unexpected number of storage queries: %d", host.numGetCalls)
+	}
+}
+
+func benchmarkStorageHeavy(b *testing.B, host HostContext, prefetch string) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+	if err := vm.SetOption("prefetch_storage", prefetch); err != nil {
+		b.Fatalf("SetOption() error: %v", err)
+	}
+
+	req := ExecutionRequest{Rev: Cancun, Kind: Call, Gas: 1000000, Code: storageHeavyCode(32)}
+	output := make([]byte, 32)
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		vm.ExecuteInto(host, &req, output)
+	}
+}
+
+func BenchmarkStorageHeavy(b *testing.B) {
+	benchmarkStorageHeavy(b, &storageHostContext{}, "0")
+}
+
+func BenchmarkStorageHeavyBatched(b *testing.B) {
+	benchmarkStorageHeavy(b, &batchHostContext{}, "1")
+}
+
+type txContextCountingHostContext struct {
+	testHostContext
+	numTxContextCalls int
+}
+
+func (host *txContextCountingHostContext) GetTxContext() TxContext {
+	host.numTxContextCalls++
+	return host.testHostContext.GetTxContext()
+}
+
+func TestGetTxContextCached(t *testing.T) {
+	vm, _ := Load(modulePath)
+	defer vm.Destroy()
+
+	// NUMBER, NUMBER, ADD, MSTORE, MSIZE, RETURN: returns the doubled block number.
+	req := ExecutionRequest{Rev: Byzantium, Kind: Call, Gas: 999,
+		Code: []byte("\x43\x43\x01\x60\x00\x52\x59\x60\x00\xf3")}
+	output := make([]byte, 32)
+	host := &txContextCountingHostContext{}
+	for i := 1; i <= 2; i++ {
+		_, n, err := vm.ExecuteInto(host, &req, output)
+		if err != nil || n != 32 || output[31] != 84 {
+			t.Fatalf("execution unexpected result: %x, %v", output[:n], err)
+		}
+		// Fetched once per execution.
+		if host.numTxContextCalls != i {
+			t.Errorf("unexpected number of GetTxContext() calls: %d", host.numTxContextCalls)
+		}
+	}
+}
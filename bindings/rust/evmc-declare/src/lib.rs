@@ -353,6 +353,8 @@ fn build_create_fn(names: &VMNameSet) -> proc_macro2::TokenStream {
                 execute: Some(__evmc_execute),
                 get_capabilities: Some(__evmc_get_capabilities),
                 set_option: Some(__evmc_set_option),
+                release_code_analysis: None,
+                execute_batch: None,
                 name: unsafe { ::std::ffi::CStr::from_bytes_with_nul_unchecked(#static_name_ident.as_bytes()).as_ptr() },
                 version: unsafe { ::std::ffi::CStr::from_bytes_with_nul_unchecked(#static_version_ident.as_bytes()).as_ptr() },
             };
@@ -411,7 +413,8 @@ fn build_execute_fn(names: &VMNameSet) -> proc_macro2::TokenStream {
             assert!(!instance.is_null());
             assert!(!msg.is_null());
 
-            let execution_message: ::evmc_vm::ExecutionMessage = unsafe {
+            // The message borrows the input and the code, they are not copied.
+            let execution_message: ::evmc_vm::ExecutionMessageRef = unsafe {
                 msg.as_ref().expect("EVMC message is null").into()
             };
 
@@ -432,7 +435,7 @@ fn build_execute_fn(names: &VMNameSet) -> proc_macro2::TokenStream {
 
             let result = ::std::panic::catch_unwind(|| {
                 if host.is_null() {
-                    container.execute(revision, code_ref, &execution_message, None)
+                    container.execute_borrowed(revision, code_ref, &execution_message, None)
                 } else {
                     let mut execution_context = unsafe {
                         ::evmc_vm::ExecutionContext::new(
@@ -440,7 +443,7 @@ fn build_execute_fn(names: &VMNameSet) -> proc_macro2::TokenStream {
                             context,
                         )
                     };
-                    container.execute(revision, code_ref, &execution_message, Some(&mut execution_context))
+                    container.execute_borrowed(revision, code_ref, &execution_message, Some(&mut execution_context))
                 }
             });
 
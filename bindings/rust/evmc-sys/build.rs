@@ -23,6 +23,7 @@ fn gen_bindings() {
         .allowlist_type("evmc_.*")
         .allowlist_function("evmc_.*")
         .allowlist_var("EVMC_ABI_VERSION")
+        .allowlist_var("EVMC_INLINE_OUTPUT_MAX_SIZE")
         // TODO: consider removing this
         .size_t_is_usize(true)
         .generate()
@@ -27,6 +27,15 @@ impl Default for evmc_bytes32 {
     }
 }
 
+impl Default for evmc_storage_key {
+    fn default() -> Self {
+        evmc_storage_key {
+            address: evmc_address::default(),
+            key: evmc_bytes32::default(),
+        }
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use std::mem::size_of;
@@ -120,6 +120,8 @@ mod tests {
             execute: None,
             get_capabilities: None,
             set_option: None,
+            release_code_analysis: None,
+            execute_batch: None,
         };
 
         let code = [0u8; 0];
@@ -138,6 +140,7 @@ mod tests {
             code_address: ::evmc_sys::evmc_address::default(),
             code: std::ptr::null(),
             code_size: 0,
+            code_analysis: std::ptr::null_mut(),
         };
         let message: ExecutionMessage = (&message).into();
 
@@ -158,6 +161,11 @@ mod tests {
             access_storage: None,
             get_transient_storage: None,
             set_transient_storage: None,
+            get_storage_batch: None,
+            get_code_view: None,
+            allocate_output: None,
+            get_tracer: None,
+            get_tx_initcode: None,
         };
         let host_context = std::ptr::null_mut();
 
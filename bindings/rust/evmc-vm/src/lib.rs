@@ -12,6 +12,9 @@
 mod container;
 mod types;
 
+use std::cell::RefCell;
+use std::collections::HashMap;
+
 pub use container::EvmcContainer;
 pub use evmc_sys as ffi;
 pub use types::*;
@@ -33,6 +36,28 @@ pub trait EvmcVm {
         message: &'a ExecutionMessage,
         context: Option<&'a mut ExecutionContext<'a>>,
     ) -> ExecutionResult;
+
+    /// This is called for every incoming message by the EVMC glue code.
+    ///
+    /// The message borrows the input and the code from the caller, so no copies are made.
+    /// VMs should override this to avoid copying the message data on every call.
+    /// The default implementation copies the message and calls execute().
+    fn execute_borrowed<'a>(
+        &self,
+        revision: Revision,
+        code: &'a [u8],
+        message: &'a ExecutionMessageRef<'a>,
+        context: Option<&'a mut ExecutionContext<'a>>,
+    ) -> ExecutionResult {
+        let message: ExecutionMessage = message.into();
+        match context {
+            Some(context) => {
+                let mut context = context.reborrow();
+                self.execute(revision, code, &message, Some(&mut context))
+            }
+            None => self.execute(revision, code, &message, None),
+        }
+    }
 }
 
 /// Error codes for set_option.
@@ -68,6 +93,25 @@ pub struct ExecutionMessage {
     code: Option<Vec<u8>>,
 }
 
+/// EVMC execution message structure borrowing the input and the code.
+///
+/// The borrowed counterpart of [`ExecutionMessage`], created from the EVMC message
+/// without copying the input and the code.
+#[derive(Debug, Clone, Copy)]
+pub struct ExecutionMessageRef<'a> {
+    kind: MessageKind,
+    flags: u32,
+    depth: i32,
+    gas: i64,
+    recipient: Address,
+    sender: Address,
+    input: Option<&'a [u8]>,
+    value: Uint256,
+    create2_salt: Bytes32,
+    code_address: Address,
+    code: Option<&'a [u8]>,
+}
+
 /// EVMC transaction context structure.
 pub type ExecutionTxContext = ffi::evmc_tx_context;
 
@@ -77,6 +121,39 @@ pub struct ExecutionContext<'a> {
     host: &'a ffi::evmc_host_interface,
     context: *mut ffi::evmc_host_context,
     tx_context: ExecutionTxContext,
+    memo: Option<RefCell<HashMap<[u8; 20], MemoizedAccount<'a>>>>,
+}
+
+/// The zero-copy view of an account code provided by the Host.
+///
+/// The code is valid until the execution which has requested it returns.
+#[derive(Debug, Clone, Copy)]
+pub struct CodeView<'a> {
+    code: &'a [u8],
+    code_hash: Bytes32,
+}
+
+impl<'a> CodeView<'a> {
+    /// Read the code.
+    pub fn code(&self) -> &'a [u8] {
+        self.code
+    }
+
+    /// Read the code hash.
+    pub fn code_hash(&self) -> &Bytes32 {
+        &self.code_hash
+    }
+}
+
+/// The memoized results of the account queries, see [`ExecutionContext::enable_memo`].
+/// Each field is memoized independently.
+#[derive(Default, Clone, Copy)]
+struct MemoizedAccount<'a> {
+    exists: Option<bool>,
+    balance: Option<Uint256>,
+    code_size: Option<usize>,
+    code_hash: Option<Bytes32>,
+    code_view: Option<Option<CodeView<'a>>>,
 }
 
 impl ExecutionResult {
@@ -96,6 +173,24 @@ impl ExecutionResult {
         }
     }
 
+    /// Manually create a result taking the ownership of the output.
+    ///
+    /// The output buffer is handed over to the EVMC result without copying.
+    pub fn with_output(
+        status_code: StatusCode,
+        gas_left: i64,
+        gas_refund: i64,
+        output: Vec<u8>,
+    ) -> Self {
+        ExecutionResult {
+            status_code,
+            gas_left,
+            gas_refund,
+            output: Some(output),
+            create_address: None,
+        }
+    }
+
     /// Create failure result.
     pub fn failure() -> Self {
         ExecutionResult::new(StatusCode::EVMC_FAILURE, 0, 0, None)
@@ -223,6 +318,91 @@ impl ExecutionMessage {
     }
 }
 
+impl<'a> ExecutionMessageRef<'a> {
+    pub fn new(
+        kind: MessageKind,
+        flags: u32,
+        depth: i32,
+        gas: i64,
+        recipient: Address,
+        sender: Address,
+        input: Option<&'a [u8]>,
+        value: Uint256,
+        create2_salt: Bytes32,
+        code_address: Address,
+        code: Option<&'a [u8]>,
+    ) -> Self {
+        ExecutionMessageRef {
+            kind,
+            flags,
+            depth,
+            gas,
+            recipient,
+            sender,
+            input,
+            value,
+            create2_salt,
+            code_address,
+            code,
+        }
+    }
+
+    /// Read the message kind.
+    pub fn kind(&self) -> MessageKind {
+        self.kind
+    }
+
+    /// Read the message flags.
+    pub fn flags(&self) -> u32 {
+        self.flags
+    }
+
+    /// Read the call depth.
+    pub fn depth(&self) -> i32 {
+        self.depth
+    }
+
+    /// Read the gas limit supplied with the message.
+    pub fn gas(&self) -> i64 {
+        self.gas
+    }
+
+    /// Read the recipient address of the message.
+    pub fn recipient(&self) -> &Address {
+        &self.recipient
+    }
+
+    /// Read the sender address of the message.
+    pub fn sender(&self) -> &Address {
+        &self.sender
+    }
+
+    /// Read the optional input message.
+    pub fn input(&self) -> Option<&'a [u8]> {
+        self.input
+    }
+
+    /// Read the value of the message.
+    pub fn value(&self) -> &Uint256 {
+        &self.value
+    }
+
+    /// Read the salt for CREATE2. Only valid if the message kind is CREATE2.
+    pub fn create2_salt(&self) -> &Bytes32 {
+        &self.create2_salt
+    }
+
+    /// Read the code address of the message.
+    pub fn code_address(&self) -> &Address {
+        &self.code_address
+    }
+
+    /// Read the optional init code.
+    pub fn code(&self) -> Option<&'a [u8]> {
+        self.code
+    }
+}
+
 impl<'a> ExecutionContext<'a> {
     pub fn new(host: &'a ffi::evmc_host_interface, _context: *mut ffi::evmc_host_context) -> Self {
         let _tx_context = unsafe {
@@ -234,6 +414,56 @@ impl<'a> ExecutionContext<'a> {
             host,
             context: _context,
             tx_context: _tx_context,
+            memo: None,
+        }
+    }
+
+    /// Enable the memo of the account and code lookups for this execution frame.
+    ///
+    /// The results of account_exists(), get_balance(), get_code_size(), get_code_hash()
+    /// and get_code_view() are memoized, so repeated lookups of the same account
+    /// do not reach the Host. The memo is invalidated by the state modifications done through
+    /// this context: selfdestruct() invalidates the account and the beneficiary,
+    /// call() clears the whole memo because the nested execution may modify any account.
+    pub fn enable_memo(&mut self) {
+        if self.memo.is_none() {
+            self.memo = Some(RefCell::default());
+        }
+    }
+
+    /// Returns the memoized field of the account, querying the Host if not memoized.
+    fn memoized<T: Copy>(
+        &self,
+        address: &Address,
+        field: for<'m> fn(&'m mut MemoizedAccount<'a>) -> &'m mut Option<T>,
+        query: impl FnOnce() -> T,
+    ) -> T {
+        let memo = match &self.memo {
+            Some(memo) => memo,
+            None => return query(),
+        };
+        if let Some(value) = *field(memo.borrow_mut().entry(address.bytes).or_default()) {
+            return value;
+        }
+        let value = query();
+        *field(memo.borrow_mut().entry(address.bytes).or_default()) = Some(value);
+        value
+    }
+
+    /// Invalidate the memoized data of the account.
+    fn invalidate(&self, address: &Address) {
+        if let Some(memo) = &self.memo {
+            memo.borrow_mut().remove(&address.bytes);
+        }
+    }
+
+    /// Create another context of the same Host, valid as long as this one is borrowed.
+    fn reborrow(&mut self) -> ExecutionContext<'_> {
+        ExecutionContext {
+            host: self.host,
+            context: self.context,
+            tx_context: self.tx_context,
+            memo: self.memo.as_ref().map(|_| RefCell::default()),
         }
     }
 
@@ -244,10 +474,14 @@ impl<'a> ExecutionContext<'a> {
 
     /// Check if an account exists.
     pub fn account_exists(&self, address: &Address) -> bool {
-        unsafe {
-            assert!((*self.host).account_exists.is_some());
-            (*self.host).account_exists.unwrap()(self.context, address as *const Address)
-        }
+        self.memoized(
+            address,
+            |a| &mut a.exists,
+            || unsafe {
+                assert!((*self.host).account_exists.is_some());
+                (*self.host).account_exists.unwrap()(self.context, address as *const Address)
+            },
+        )
     }
 
     /// Read from a storage key.
@@ -282,26 +516,38 @@ impl<'a> ExecutionContext<'a> {
 
     /// Get balance of an account.
     pub fn get_balance(&self, address: &Address) -> Uint256 {
-        unsafe {
-            assert!((*self.host).get_balance.is_some());
-            (*self.host).get_balance.unwrap()(self.context, address as *const Address)
-        }
+        self.memoized(
+            address,
+            |a| &mut a.balance,
+            || unsafe {
+                assert!((*self.host).get_balance.is_some());
+                (*self.host).get_balance.unwrap()(self.context, address as *const Address)
+            },
+        )
     }
 
     /// Get code size of an account.
     pub fn get_code_size(&self, address: &Address) -> usize {
-        unsafe {
-            assert!((*self.host).get_code_size.is_some());
-            (*self.host).get_code_size.unwrap()(self.context, address as *const Address)
-        }
+        self.memoized(
+            address,
+            |a| &mut a.code_size,
+            || unsafe {
+                assert!((*self.host).get_code_size.is_some());
+                (*self.host).get_code_size.unwrap()(self.context, address as *const Address)
+            },
+        )
     }
 
     /// Get code hash of an account.
     pub fn get_code_hash(&self, address: &Address) -> Bytes32 {
-        unsafe {
-            assert!((*self.host).get_code_size.is_some());
-            (*self.host).get_code_hash.unwrap()(self.context, address as *const Address)
-        }
+        self.memoized(
+            address,
+            |a| &mut a.code_hash,
+            || unsafe {
+                assert!((*self.host).get_code_hash.is_some());
+                (*self.host).get_code_hash.unwrap()(self.context, address as *const Address)
+            },
+        )
     }
 
     /// Copy code of an account.
@@ -321,6 +567,8 @@ impl<'a> ExecutionContext<'a> {
 
     /// Self-destruct the current account.
     pub fn selfdestruct(&mut self, address: &Address, beneficiary: &Address) -> bool {
+        self.invalidate(address);
+        self.invalidate(beneficiary);
         unsafe {
             assert!((*self.host).selfdestruct.is_some());
             (*self.host).selfdestruct.unwrap()(
@@ -333,26 +581,18 @@ impl<'a> ExecutionContext<'a> {
 
     /// Call to another account.
     pub fn call(&mut self, message: &ExecutionMessage) -> ExecutionResult {
+        self.call_borrowed(&message.into())
+    }
+
+    /// Call to another account with the message borrowing the input and the code.
+    pub fn call_borrowed(&mut self, message: &ExecutionMessageRef) -> ExecutionResult {
+        if let Some(memo) = &self.memo {
+            memo.borrow_mut().clear();
+        }
         // There is no need to make any kind of copies here, because the caller
         // won't go out of scope and ensures these pointers remain valid.
-        let input = message.input();
-        let input_size = if let Some(input) = input {
-            input.len()
-        } else {
-            0
-        };
-        let input_data = if let Some(input) = input {
-            input.as_ptr()
-        } else {
-            std::ptr::null() as *const u8
-        };
-        let code = message.code();
-        let code_size = if let Some(code) = code { code.len() } else { 0 };
-        let code_data = if let Some(code) = code {
-            code.as_ptr()
-        } else {
-            std::ptr::null() as *const u8
-        };
+        let (input_data, input_size) = slice_to_raw(message.input());
+        let (code_data, code_size) = slice_to_raw(message.code());
         // Cannot use a nice from trait here because that complicates memory management,
         // evmc_message doesn't have a release() method we could abstract it with.
         let message = ffi::evmc_message {
@@ -369,6 +609,7 @@ impl<'a> ExecutionContext<'a> {
             code_address: *message.code_address(),
             code: code_data,
             code_size,
+            code_analysis: std::ptr::null_mut(),
         };
         unsafe {
             assert!((*self.host).call.is_some());
@@ -419,15 +660,69 @@ impl<'a> ExecutionContext<'a> {
             )
         }
     }
+
+    /// Read multiple storage keys at once.
+    ///
+    /// The value of keys[i] is written to values[i]. Falls back to get_storage()
+    /// for each key if the Host does not support the batched query.
+    pub fn get_storage_batch(&self, keys: &[StorageKey], values: &mut [Bytes32]) {
+        assert_eq!(keys.len(), values.len());
+        unsafe {
+            match (*self.host).get_storage_batch {
+                Some(get_storage_batch) => {
+                    get_storage_batch(self.context, keys.as_ptr(), values.as_mut_ptr(), keys.len())
+                }
+                None => {
+                    for (key, value) in keys.iter().zip(values.iter_mut()) {
+                        *value = self.get_storage(&key.address, &key.key);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Get the view of the code of an account without copying it.
+    ///
+    /// Returns None if the Host does not support code views or declines to provide it,
+    /// the VM must fall back to copy_code() in such case.
+    pub fn get_code_view(&self, address: &Address) -> Option<CodeView<'a>> {
+        self.memoized(
+            address,
+            |a| &mut a.code_view,
+            || unsafe {
+                let get_code_view = (*self.host).get_code_view?;
+                let mut view = ffi::evmc_code_view {
+                    code: std::ptr::null(),
+                    code_size: 0,
+                    code_hash: Bytes32::default(),
+                };
+                if !get_code_view(self.context, address as *const Address, &mut view) {
+                    return None;
+                }
+                let code: &'a [u8] = if view.code_size == 0 {
+                    &[]
+                } else {
+                    std::slice::from_raw_parts(view.code, view.code_size)
+                };
+                Some(CodeView {
+                    code,
+                    code_hash: view.code_hash,
+                })
+            },
+        )
+    }
 }
 
 impl From<ffi::evmc_result> for ExecutionResult {
     fn from(result: ffi::evmc_result) -> Self {
+        let inline = result.flags & ffi::evmc_result_flags::EVMC_RESULT_INLINE_OUTPUT as u32 != 0;
         let ret = Self {
             status_code: result.status_code,
             gas_left: result.gas_left,
             gas_refund: result.gas_refund,
-            output: if result.output_data.is_null() {
+            output: if inline {
+                Some(result.inline_output[..result.output_size].to_vec())
+            } else if result.output_data.is_null() {
                 assert_eq!(result.output_size, 0);
                 None
             } else if result.output_size == 0 {
@@ -450,28 +745,27 @@ impl From<ffi::evmc_result> for ExecutionResult {
     }
 }
 
-fn allocate_output_data(output: Option<&Vec<u8>>) -> (*const u8, usize) {
-    if let Some(buf) = output {
-        let buf_len = buf.len();
-
-        // Manually allocate heap memory for the new home of the output buffer.
-        let memlayout = std::alloc::Layout::from_size_align(buf_len, 1).expect("Bad layout");
-        let new_buf = unsafe { std::alloc::alloc(memlayout) };
-        unsafe {
-            // Copy the data into the allocated buffer.
-            std::ptr::copy(buf.as_ptr(), new_buf, buf_len);
+/// Hands over the output buffer to the EVMC result without copying.
+///
+/// The buffer is shrunk to its length, so it is deallocated by deallocate_output_data()
+/// with the layout of its size. The empty output is represented by the null pointer.
+fn allocate_output_data(output: Option<Vec<u8>>) -> (*const u8, usize) {
+    match output {
+        Some(buf) if !buf.is_empty() => {
+            let buf = buf.into_boxed_slice();
+            let buf_len = buf.len();
+            (Box::into_raw(buf) as *const u8, buf_len)
         }
-
-        (new_buf as *const u8, buf_len)
-    } else {
-        (std::ptr::null(), 0)
+        _ => (std::ptr::null(), 0),
     }
 }
 
 unsafe fn deallocate_output_data(ptr: *const u8, size: usize) {
     if !ptr.is_null() {
-        let buf_layout = std::alloc::Layout::from_size_align(size, 1).expect("Bad layout");
-        std::alloc::dealloc(ptr as *mut u8, buf_layout);
+        drop(Box::from_raw(std::ptr::slice_from_raw_parts_mut(
+            ptr as *mut u8,
+            size,
+        )));
     }
 }
 
@@ -495,7 +789,7 @@ extern "C" fn release_heap_result(result: *const ffi::evmc_result) {
 /// Returns a pointer to a stack-allocated evmc_result.
 impl From<ExecutionResult> for ffi::evmc_result {
     fn from(value: ExecutionResult) -> Self {
-        let (buffer, len) = allocate_output_data(value.output.as_ref());
+        let (buffer, len) = allocate_output_data(value.output);
         Self {
             status_code: value.status_code,
             gas_left: value.gas_left,
@@ -509,6 +803,8 @@ impl From<ExecutionResult> for ffi::evmc_result {
                 Address { bytes: [0u8; 20] }
             },
             padding: [0u8; 4],
+            flags: 0,
+            inline_output: [0u8; ffi::EVMC_INLINE_OUTPUT_MAX_SIZE as usize],
         }
     }
 }
@@ -523,36 +819,84 @@ extern "C" fn release_stack_result(result: *const ffi::evmc_result) {
 
 impl From<&ffi::evmc_message> for ExecutionMessage {
     fn from(message: &ffi::evmc_message) -> Self {
-        ExecutionMessage {
+        (&ExecutionMessageRef::from(message)).into()
+    }
+}
+
+impl<'a> From<&'a ffi::evmc_message> for ExecutionMessageRef<'a> {
+    fn from(message: &'a ffi::evmc_message) -> Self {
+        ExecutionMessageRef {
             kind: message.kind,
             flags: message.flags,
             depth: message.depth,
             gas: message.gas,
             recipient: message.recipient,
             sender: message.sender,
-            input: if message.input_data.is_null() {
-                assert_eq!(message.input_size, 0);
-                None
-            } else if message.input_size == 0 {
-                None
-            } else {
-                Some(from_buf_raw::<u8>(message.input_data, message.input_size))
-            },
+            input: slice_from_raw(message.input_data, message.input_size),
             value: message.value,
             create2_salt: message.create2_salt,
             code_address: message.code_address,
-            code: if message.code.is_null() {
-                assert_eq!(message.code_size, 0);
-                None
-            } else if message.code_size == 0 {
-                None
-            } else {
-                Some(from_buf_raw::<u8>(message.code, message.code_size))
-            },
+            code: slice_from_raw(message.code, message.code_size),
         }
     }
 }
 
+impl<'a> From<&'a ExecutionMessage> for ExecutionMessageRef<'a> {
+    fn from(message: &'a ExecutionMessage) -> Self {
+        ExecutionMessageRef {
+            kind: message.kind,
+            flags: message.flags,
+            depth: message.depth,
+            gas: message.gas,
+            recipient: message.recipient,
+            sender: message.sender,
+            input: message.input.as_deref(),
+            value: message.value,
+            create2_salt: message.create2_salt,
+            code_address: message.code_address,
+            code: message.code.as_deref(),
+        }
+    }
+}
+
+impl From<&ExecutionMessageRef<'_>> for ExecutionMessage {
+    fn from(message: &ExecutionMessageRef) -> Self {
+        ExecutionMessage::new(
+            message.kind,
+            message.flags,
+            message.depth,
+            message.gas,
+            message.recipient,
+            message.sender,
+            message.input,
+            message.value,
+            message.create2_salt,
+            message.code_address,
+            message.code,
+        )
+    }
+}
+
+/// Borrows the C buffer as a slice, the empty buffer as None.
+fn slice_from_raw<'a>(ptr: *const u8, size: usize) -> Option<&'a [u8]> {
+    if ptr.is_null() {
+        assert_eq!(size, 0);
+        None
+    } else if size == 0 {
+        None
+    } else {
+        Some(unsafe { std::slice::from_raw_parts(ptr, size) })
+    }
+}
+
+/// The pointer and the size of the optional slice, the null pointer for None.
+fn slice_to_raw(slice: Option<&[u8]>) -> (*const u8, usize) {
+    match slice {
+        Some(slice) => (slice.as_ptr(), slice.len()),
+        None => (std::ptr::null(), 0),
+    }
+}
+
 fn from_buf_raw<T>(ptr: *const T, size: usize) -> Vec<T> {
     // Pre-allocate a vector.
     let mut buf = Vec::with_capacity(size);
@@ -605,6 +949,8 @@ mod tests {
             release: Some(test_result_dispose),
             create_address: Address { bytes: [0u8; 20] },
             padding: [0u8; 4],
+            flags: 0,
+            inline_output: [0u8; ffi::EVMC_INLINE_OUTPUT_MAX_SIZE as usize],
         };
 
         let r: ExecutionResult = f.into();
@@ -617,6 +963,28 @@ mod tests {
         assert!(r.create_address().is_some());
     }
 
+    #[test]
+    fn result_from_ffi_inline_output() {
+        let mut inline_output = [0u8; ffi::EVMC_INLINE_OUTPUT_MAX_SIZE as usize];
+        inline_output[..3].copy_from_slice(&[0xc0, 0xff, 0xee]);
+        let f = ffi::evmc_result {
+            status_code: StatusCode::EVMC_SUCCESS,
+            gas_left: 1337,
+            gas_refund: 21,
+            output_data: std::ptr::null(),
+            output_size: 3,
+            release: None,
+            create_address: Address { bytes: [0u8; 20] },
+            padding: [0u8; 4],
+            flags: ffi::evmc_result_flags::EVMC_RESULT_INLINE_OUTPUT as u32,
+            inline_output,
+        };
+
+        let r: ExecutionResult = f.into();
+        assert_eq!(r.status_code(), StatusCode::EVMC_SUCCESS);
+        assert_eq!(r.output().unwrap(), &[0xc0, 0xff, 0xee]);
+    }
+
     #[test]
     fn result_into_heap_ffi() {
         let r = ExecutionResult::new(
@@ -709,6 +1077,30 @@ mod tests {
         }
     }
 
+    #[test]
+    fn result_into_ffi_without_copy() {
+        let output = vec![0xc0, 0xff, 0xee];
+        let output_ptr = output.as_ptr();
+        let r = ExecutionResult::with_output(StatusCode::EVMC_SUCCESS, 420, 21, output);
+        assert_eq!(r.output().unwrap(), &[0xc0, 0xff, 0xee]);
+
+        let f: ffi::evmc_result = r.into();
+        unsafe {
+            assert_eq!(f.status_code, StatusCode::EVMC_SUCCESS);
+            assert_eq!(f.output_data, output_ptr);
+            assert_eq!(f.output_size, 3);
+            f.release.unwrap()(&f);
+        }
+
+        let r = ExecutionResult::with_output(StatusCode::EVMC_SUCCESS, 420, 21, Vec::new());
+        let f: *const ffi::evmc_result = r.into();
+        unsafe {
+            assert!((*f).output_data.is_null());
+            assert_eq!((*f).output_size, 0);
+            (*f).release.unwrap()(f);
+        }
+    }
+
     #[test]
     fn message_new_with_input() {
         let input = vec![0xc0, 0xff, 0xee];
@@ -803,6 +1195,7 @@ mod tests {
             code_address,
             code: std::ptr::null(),
             code_size: 0,
+            code_analysis: std::ptr::null_mut(),
         };
 
         let ret: ExecutionMessage = (&msg).into();
@@ -843,6 +1236,7 @@ mod tests {
             code_address,
             code: std::ptr::null(),
             code_size: 0,
+            code_analysis: std::ptr::null_mut(),
         };
 
         let ret: ExecutionMessage = (&msg).into();
@@ -884,6 +1278,7 @@ mod tests {
             code_address,
             code: code.as_ptr(),
             code_size: code.len(),
+            code_analysis: std::ptr::null_mut(),
         };
 
         let ret: ExecutionMessage = (&msg).into();
@@ -902,6 +1297,142 @@ mod tests {
         assert_eq!(*ret.code().unwrap(), code);
     }
 
+    #[test]
+    fn message_ref_from_ffi() {
+        let input = vec![0xc0, 0xff, 0xee];
+        let code = vec![0x5f, 0x5f, 0xfd];
+        let msg = ffi::evmc_message {
+            kind: MessageKind::EVMC_CALL,
+            flags: 44,
+            depth: 66,
+            gas: 4466,
+            recipient: Address { bytes: [32u8; 20] },
+            sender: Address { bytes: [128u8; 20] },
+            input_data: input.as_ptr(),
+            input_size: input.len(),
+            value: Uint256 { bytes: [0u8; 32] },
+            create2_salt: Bytes32 { bytes: [255u8; 32] },
+            code_address: Address { bytes: [64u8; 20] },
+            code: code.as_ptr(),
+            code_size: code.len(),
+            code_analysis: std::ptr::null_mut(),
+        };
+
+        let ret: ExecutionMessageRef = (&msg).into();
+
+        assert_eq!(ret.kind(), msg.kind);
+        assert_eq!(ret.flags(), msg.flags);
+        assert_eq!(ret.depth(), msg.depth);
+        assert_eq!(ret.gas(), msg.gas);
+        assert_eq!(*ret.recipient(), msg.recipient);
+        assert_eq!(*ret.sender(), msg.sender);
+        assert_eq!(*ret.value(), msg.value);
+        assert_eq!(*ret.create2_salt(), msg.create2_salt);
+        assert_eq!(*ret.code_address(), msg.code_address);
+        // The input and the code are borrowed, not copied.
+        assert_eq!(ret.input().unwrap().as_ptr(), input.as_ptr());
+        assert_eq!(ret.input().unwrap(), &input[..]);
+        assert_eq!(ret.code().unwrap().as_ptr(), code.as_ptr());
+        assert_eq!(ret.code().unwrap(), &code[..]);
+
+        let owned: ExecutionMessage = (&ret).into();
+        assert_eq!(owned.gas(), msg.gas);
+        assert_eq!(*owned.input().unwrap(), input);
+        assert_eq!(*owned.code().unwrap(), code);
+
+        let borrowed: ExecutionMessageRef = (&owned).into();
+        assert_eq!(
+            borrowed.input().unwrap().as_ptr(),
+            owned.input().unwrap().as_ptr()
+        );
+        assert_eq!(
+            borrowed.code().unwrap().as_ptr(),
+            owned.code().unwrap().as_ptr()
+        );
+    }
+
+    #[test]
+    fn message_ref_from_ffi_empty() {
+        let input = vec![0xc0];
+        let msg = ffi::evmc_message {
+            kind: MessageKind::EVMC_CALL,
+            flags: 0,
+            depth: 0,
+            gas: 0,
+            recipient: Address::default(),
+            sender: Address::default(),
+            input_data: input.as_ptr(),
+            input_size: 0,
+            value: Uint256::default(),
+            create2_salt: Bytes32::default(),
+            code_address: Address::default(),
+            code: std::ptr::null(),
+            code_size: 0,
+            code_analysis: std::ptr::null_mut(),
+        };
+
+        let ret: ExecutionMessageRef = (&msg).into();
+        assert!(ret.input().is_none());
+        assert!(ret.code().is_none());
+    }
+
+    struct GasVm;
+
+    impl EvmcVm for GasVm {
+        fn init() -> Self {
+            GasVm
+        }
+
+        fn execute<'a>(
+            &self,
+            _revision: Revision,
+            code: &'a [u8],
+            message: &'a ExecutionMessage,
+            context: Option<&'a mut ExecutionContext<'a>>,
+        ) -> ExecutionResult {
+            let gas_left = message.gas() - code.len() as i64;
+            let output = message.input().cloned().unwrap_or_default();
+            match context {
+                Some(context) => ExecutionResult::with_output(
+                    StatusCode::EVMC_SUCCESS,
+                    gas_left - context.get_tx_context().block_number,
+                    0,
+                    output,
+                ),
+                None => ExecutionResult::with_output(StatusCode::EVMC_SUCCESS, gas_left, 0, output),
+            }
+        }
+    }
+
+    #[test]
+    fn execute_borrowed_default() {
+        let vm = GasVm::init();
+        let input = [0xc0, 0xff, 0xee];
+        let code = [0x00; 10];
+        let message = ExecutionMessageRef::new(
+            MessageKind::EVMC_CALL,
+            0,
+            0,
+            100,
+            Address::default(),
+            Address::default(),
+            Some(&input),
+            Uint256::default(),
+            Bytes32::default(),
+            Address::default(),
+            None,
+        );
+
+        let r = vm.execute_borrowed(Revision::EVMC_CANCUN, &code, &message, None);
+        assert_eq!(r.gas_left(), 90);
+        assert_eq!(r.output().unwrap(), &input);
+
+        let host = get_dummy_host_interface();
+        let mut context = ExecutionContext::new(&host, std::ptr::null_mut());
+        let r = vm.execute_borrowed(Revision::EVMC_CANCUN, &code, &message, Some(&mut context));
+        assert_eq!(r.gas_left(), 48);
+    }
+
     unsafe extern "C" fn get_dummy_tx_context(
         _context: *mut ffi::evmc_host_context,
     ) -> ffi::evmc_tx_context {
@@ -956,6 +1487,8 @@ mod tests {
             release: None,
             create_address: Address::default(),
             padding: [0u8; 4],
+            flags: 0,
+            inline_output: [0u8; ffi::EVMC_INLINE_OUTPUT_MAX_SIZE as usize],
         }
     }
 
@@ -978,6 +1511,11 @@ mod tests {
             access_storage: None,
             get_transient_storage: None,
             set_transient_storage: None,
+            get_storage_batch: None,
+            get_code_view: None,
+            allocate_output: None,
+            get_tracer: None,
+            get_tx_initcode: None,
         }
     }
 
@@ -1074,4 +1612,189 @@ mod tests {
         assert!(b.create_address().is_some());
         assert_eq!(b.create_address().unwrap(), &Address::default());
     }
+
+    /// The Host state of the counting host interface, passed as the Host context.
+    #[derive(Default)]
+    struct CountingHost {
+        num_queries: usize,
+        num_batches: usize,
+    }
+
+    unsafe fn counting_host<'a>(context: *mut ffi::evmc_host_context) -> &'a mut CountingHost {
+        &mut *(context as *mut CountingHost)
+    }
+
+    unsafe extern "C" fn count_get_balance(
+        context: *mut ffi::evmc_host_context,
+        addr: *const Address,
+    ) -> Uint256 {
+        counting_host(context).num_queries += 1;
+        let mut balance = Uint256::default();
+        balance.bytes[31] = (*addr).bytes[19];
+        balance
+    }
+
+    unsafe extern "C" fn count_get_storage(
+        context: *mut ffi::evmc_host_context,
+        _addr: *const Address,
+        key: *const Bytes32,
+    ) -> Bytes32 {
+        counting_host(context).num_queries += 1;
+        *key
+    }
+
+    unsafe extern "C" fn count_get_storage_batch(
+        context: *mut ffi::evmc_host_context,
+        keys: *const StorageKey,
+        values: *mut Bytes32,
+        count: usize,
+    ) {
+        counting_host(context).num_batches += 1;
+        for i in 0..count {
+            *values.add(i) = (*keys.add(i)).key;
+        }
+    }
+
+    unsafe extern "C" fn count_selfdestruct(
+        _context: *mut ffi::evmc_host_context,
+        _addr: *const Address,
+        _beneficiary: *const Address,
+    ) -> bool {
+        true
+    }
+
+    static VIEWED_CODE: [u8; 3] = [0x5f, 0x5f, 0xfd];
+
+    unsafe extern "C" fn count_get_code_view(
+        context: *mut ffi::evmc_host_context,
+        addr: *const Address,
+        view: *mut ffi::evmc_code_view,
+    ) -> bool {
+        counting_host(context).num_queries += 1;
+        if (*addr).bytes[19] == 0 {
+            return false;
+        }
+        (*view).code = VIEWED_CODE.as_ptr();
+        (*view).code_size = VIEWED_CODE.len();
+        (*view).code_hash = Bytes32 { bytes: [0xc0; 32] };
+        true
+    }
+
+    fn get_counting_host_interface() -> ffi::evmc_host_interface {
+        ffi::evmc_host_interface {
+            get_storage: Some(count_get_storage),
+            get_balance: Some(count_get_balance),
+            selfdestruct: Some(count_selfdestruct),
+            get_storage_batch: Some(count_get_storage_batch),
+            get_code_view: Some(count_get_code_view),
+            ..get_dummy_host_interface()
+        }
+    }
+
+    #[test]
+    fn memo() {
+        let host = get_counting_host_interface();
+        let mut state = CountingHost::default();
+        let host_context = &mut state as *mut CountingHost as *mut ffi::evmc_host_context;
+        let a = Address { bytes: [1u8; 20] };
+        let b = Address { bytes: [2u8; 20] };
+
+        {
+            let mut exe_context = ExecutionContext::new(&host, host_context);
+            assert_eq!(exe_context.get_balance(&a).bytes[31], 1);
+            assert_eq!(exe_context.get_balance(&a).bytes[31], 1);
+
+            exe_context.enable_memo();
+            assert_eq!(exe_context.get_balance(&a).bytes[31], 1);
+            assert_eq!(exe_context.get_balance(&a).bytes[31], 1);
+            assert_eq!(exe_context.get_balance(&b).bytes[31], 2);
+            assert_eq!(exe_context.get_code_view(&a).unwrap().code(), &VIEWED_CODE);
+            assert_eq!(exe_context.get_code_view(&a).unwrap().code(), &VIEWED_CODE);
+
+            // Invalidates a and the beneficiary b.
+            exe_context.selfdestruct(&a, &b);
+            assert_eq!(exe_context.get_balance(&a).bytes[31], 1);
+            assert_eq!(exe_context.get_balance(&b).bytes[31], 2);
+            assert_eq!(exe_context.get_balance(&b).bytes[31], 2);
+
+            // Clears the memo.
+            let message = ExecutionMessageRef::new(
+                MessageKind::EVMC_CALL,
+                0,
+                0,
+                0,
+                a,
+                b,
+                None,
+                Uint256::default(),
+                Bytes32::default(),
+                a,
+                None,
+            );
+            exe_context.call_borrowed(&message);
+            assert_eq!(exe_context.get_balance(&a).bytes[31], 1);
+            assert_eq!(exe_context.get_balance(&a).bytes[31], 1);
+        }
+        assert_eq!(state.num_queries, 8);
+    }
+
+    #[test]
+    fn get_storage_batch() {
+        let mut state = CountingHost::default();
+        let host_context = &mut state as *mut CountingHost as *mut ffi::evmc_host_context;
+        let keys = [
+            StorageKey {
+                address: Address::default(),
+                key: Bytes32 { bytes: [1u8; 32] },
+            },
+            StorageKey {
+                address: Address::default(),
+                key: Bytes32 { bytes: [2u8; 32] },
+            },
+        ];
+
+        let host = get_counting_host_interface();
+        let exe_context = ExecutionContext::new(&host, host_context);
+        let mut values = [Bytes32::default(); 2];
+        exe_context.get_storage_batch(&keys, &mut values);
+        assert_eq!(values[0], keys[0].key);
+        assert_eq!(values[1], keys[1].key);
+
+        // Falls back to get_storage().
+        let host = ffi::evmc_host_interface {
+            get_storage_batch: None,
+            ..get_counting_host_interface()
+        };
+        let exe_context = ExecutionContext::new(&host, host_context);
+        let mut values = [Bytes32::default(); 2];
+        exe_context.get_storage_batch(&keys, &mut values);
+        assert_eq!(values[0], keys[0].key);
+        assert_eq!(values[1], keys[1].key);
+
+        assert_eq!(state.num_batches, 1);
+        assert_eq!(state.num_queries, 2);
+    }
+
+    #[test]
+    fn get_code_view() {
+        let mut state = CountingHost::default();
+        let host_context = &mut state as *mut CountingHost as *mut ffi::evmc_host_context;
+        let host = get_counting_host_interface();
+        let exe_context = ExecutionContext::new(&host, host_context);
+
+        let view = exe_context.get_code_view(&Address { bytes: [1u8; 20] });
+        assert!(view.is_some());
+        assert_eq!(view.unwrap().code().as_ptr(), VIEWED_CODE.as_ptr());
+        assert_eq!(view.unwrap().code_hash().bytes, [0xc0; 32]);
+
+        // Declined by the Host.
+        assert!(exe_context.get_code_view(&Address::default()).is_none());
+
+        // Not supported by the Host.
+        let host = get_dummy_host_interface();
+        let exe_context = ExecutionContext::new(&host, host_context);
+        assert!(exe_context
+            .get_code_view(&Address { bytes: [1u8; 20] })
+            .is_none());
+    }
 }
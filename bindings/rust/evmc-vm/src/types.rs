@@ -9,6 +9,9 @@ pub type Bytes32 = ffi::evmc_bytes32;
 /// EVMC big-endian 256-bit integer
 pub type Uint256 = ffi::evmc_uint256be;
 
+/// EVMC storage entry reference, the item of a batched storage query.
+pub type StorageKey = ffi::evmc_storage_key;
+
 /// EVMC call kind.
 pub type MessageKind = ffi::evmc_call_kind;
 
@@ -53,6 +56,13 @@ mod tests {
         assert_eq!(a.clone(), b.clone());
     }
 
+    #[test]
+    fn storage_key_smoke_test() {
+        let a = ffi::evmc_storage_key::default();
+        let b = StorageKey::default();
+        assert_eq!(a.clone(), b.clone());
+    }
+
     #[test]
     fn message_kind() {
         assert_eq!(MessageKind::EVMC_CALL, ffi::evmc_call_kind::EVMC_CALL);
@@ -73,8 +73,9 @@ int main(int argc, char* argv[])
         printf("  Gas left: %" PRId64 "\n", result.gas_left);
         printf("  Output size: %zd\n", result.output_size);
         printf("  Output: ");
+        const uint8_t* output_data = evmc_get_output_data(&result);
         for (size_t i = 0; i < result.output_size; i++)
-            printf("%02x", result.output_data[i]);
+            printf("%02x", output_data[i]);
         printf("\n");
         const evmc_bytes32 storage_key = {{0}};
         evmc_bytes32 storage_value = host->get_storage(ctx, &msg.recipient, &storage_key);
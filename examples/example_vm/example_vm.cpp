@@ -7,20 +7,36 @@
 ///
 /// This VM implements a subset of EVM instructions in simplistic, incorrect and unsafe way:
 /// - memory bounds are not checked,
-/// - stack bounds are not checked,
 /// - most of the operations are done with 32-bit precision (instead of EVM 256-bit precision).
 /// Yet, it is capable of coping with some example EVM bytecode inputs, which is very useful
 /// in integration testing. The implementation is done in simple C++ for readability and uses
 /// pure C API and some C helpers.
+///
+/// The code is analyzed before the execution: the PUSH values are decoded, the jump destinations
+/// are collected and the gas cost and the stack requirements are computed per basic block
+/// with the EVMC instruction metrics. The analysis is cached in the evmc_message::code_analysis
+/// slot if provided by the Host. The instructions are executed with the direct-threaded dispatch
+/// where the compiler supports the computed goto (GCC, Clang) and with the switch otherwise.
 
 #include "example_vm.h"
 #include <evmc/evmc.h>
 #include <evmc/helpers.h>
 #include <evmc/instructions.h>
 #include <algorithm>
+#include <array>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
+
+/// @cond internal
+#if defined(__GNUC__)
+/// The computed goto is available for the threaded dispatch.
+#define EXAMPLE_VM_THREADED_DISPATCH 1
+#else
+#define EXAMPLE_VM_THREADED_DISPATCH 0
+#endif
+/// @endcond
 
 /// The Example VM methods, helper and types are contained in the anonymous namespace.
 /// Technically, this limits the visibility of these elements (internal linkage).
@@ -30,8 +46,13 @@ namespace
 /// The example VM instance struct extending the evmc_vm.
 struct ExampleVM : evmc_vm
 {
-    int verbose = 0;  ///< The verbosity level.
-    ExampleVM();      ///< Constructor to initialize the evmc_vm struct.
+    int verbose = 0;                ///< The verbosity level.
+    bool prefetch_storage = false;  ///< Prefetch the constant SLOAD keys with a single query.
+
+    /// Use the threaded dispatch of the instructions instead of the switch.
+    bool threaded_dispatch = EXAMPLE_VM_THREADED_DISPATCH != 0;
+
+    ExampleVM();  ///< Constructor to initialize the evmc_vm struct.
 };
 
 /// The implementation of the evmc_vm::destroy() method.
@@ -68,14 +89,37 @@ enum evmc_set_option_result set_option(evmc_vm* instance, const char* name, cons
         return EVMC_SET_OPTION_SUCCESS;
     }
 
+    if (std::strcmp(name, "prefetch_storage") == 0)
+    {
+        if (value == nullptr || (std::strcmp(value, "0") != 0 && std::strcmp(value, "1") != 0))
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        vm->prefetch_storage = value[0] == '1';
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+
+    if (std::strcmp(name, "dispatch") == 0)
+    {
+        if (value == nullptr)
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        if (std::strcmp(value, "switch") == 0)
+            vm->threaded_dispatch = false;
+        else if (std::strcmp(value, "threaded") == 0 && EXAMPLE_VM_THREADED_DISPATCH)
+            vm->threaded_dispatch = true;
+        else
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+
     return EVMC_SET_OPTION_INVALID_NAME;
 }
 
 /// The Example VM stack representation.
 struct Stack
 {
-    evmc_uint256be items[1024] = {};  ///< The array of stack items.
-    evmc_uint256be* pointer = items;  ///< The pointer to the currently first empty stack slot.
+    static constexpr int limit = 1024;  ///< The maximum number of stack items.
+
+    evmc_uint256be items[limit] = {};  ///< The array of stack items.
+    evmc_uint256be* pointer = items;   ///< The pointer to the currently first empty stack slot.
 
     /// Pops an item from the top of the stack.
     evmc_uint256be pop() { return *--pointer; }
@@ -158,223 +202,679 @@ inline evmc_address to_address(evmc_uint256be value)
 }
 
 
-/// The example implementation of the evmc_vm::execute() method.
-evmc_result execute(evmc_vm* instance,
-                    const evmc_host_interface* host,
-                    evmc_host_context* context,
-                    enum evmc_revision rev,
-                    const evmc_message* msg,
-                    const uint8_t* code,
-                    size_t code_size)
+/// The storage values of the recipient prefetched with a single batched Host query.
+///
+/// The keys of the SLOAD instructions directly preceded by a PUSH instruction are known before
+/// the execution, so they are queried with evmc_host_interface::get_storage_batch() at once
+/// instead of one Host call per SLOAD. The prefetched values are dropped after every call,
+/// because the nested execution may modify the storage of the recipient.
+struct StoragePrefetch
 {
-    auto* vm = static_cast<ExampleVM*>(instance);
+    static constexpr size_t capacity = 64;  ///< The maximum number of prefetched keys.
+    evmc_storage_key keys[capacity];        ///< The prefetched keys.
+    evmc_bytes32 values[capacity];          ///< The current values at the prefetched keys.
+    size_t size = 0;                        ///< The number of prefetched keys.
+
+    /// Collects the constant SLOAD keys from the code and queries them at once.
+    void fetch(const evmc_host_interface* host,
+               evmc_host_context* context,
+               const evmc_message* msg,
+               const uint8_t* code,
+               size_t code_size)
+    {
+        for (size_t pc = 0; pc < code_size && size < capacity; ++pc)
+        {
+            if (code[pc] < OP_PUSH1 || code[pc] > OP_PUSH32)
+                continue;
 
-    if (vm->verbose > 0)
-        std::puts("execution started\n");
+            const size_t push_size = static_cast<size_t>(code[pc] - OP_PUSH1 + 1);
+            const size_t next_pc = pc + push_size + 1;
+            if (next_pc < code_size && code[next_pc] == OP_SLOAD)
+            {
+                evmc_bytes32 key = {};
+                std::memcpy(&key.bytes[sizeof(key) - push_size], &code[pc + 1], push_size);
+                if (find(key) == nullptr)
+                    keys[size++] = {msg->recipient, key};
+            }
+            pc += push_size;
+        }
 
-    int64_t gas_left = msg->gas;
-    Stack stack;
-    Memory memory;
+        if (size != 0)
+            host->get_storage_batch(context, keys, values, size);
+    }
 
-    for (size_t pc = 0; pc < code_size; ++pc)
-    {
-        // Check remaining gas, assume each instruction costs 1.
-        gas_left -= 1;
-        if (gas_left < 0)
-            return evmc_make_result(EVMC_OUT_OF_GAS, 0, 0, nullptr, 0);
+    /// Drops the prefetched values, so the following SLOADs query the Host.
+    void invalidate() { size = 0; }
 
-        switch (code[pc])
+    /// Returns the pointer to the prefetched value at the key or null if not prefetched.
+    evmc_bytes32* find(const evmc_bytes32& key)
+    {
+        for (size_t i = 0; i < size; ++i)
         {
-        default:
-            return evmc_make_result(EVMC_UNDEFINED_INSTRUCTION, 0, 0, nullptr, 0);
+            if (std::memcmp(keys[i].key.bytes, key.bytes, sizeof(key)) == 0)
+                return &values[i];
+        }
+        return nullptr;
+    }
+};
 
-        case OP_STOP:
-            return evmc_make_result(EVMC_SUCCESS, gas_left, 0, nullptr, 0);
+/// The internal opcode of the instruction beginning a basic block.
+/// It charges the gas and checks the stack requirements of the whole block at once.
+constexpr int OPX_BEGINBLOCK = 0x100;
 
-        case OP_ADD:
-        {
-            uint32_t a = to_uint32(stack.pop());
-            uint32_t b = to_uint32(stack.pop());
-            uint32_t sum = a + b;
-            stack.push(to_uint256(sum));
-            break;
-        }
+/// The internal opcode of the instructions not implemented by the Example VM.
+constexpr int OPX_UNDEFINED = 0x101;
 
-        case OP_ADDRESS:
-        {
-            evmc_uint256be value = to_uint256(msg->recipient);
-            stack.push(value);
-            break;
-        }
+/// The instruction prepared by the code analysis for the interpreter.
+struct Instruction
+{
+    ptrdiff_t label;          ///< The implementation offset for the threaded dispatch.
+    int opcode;               ///< The opcode: EVM opcode, OPX_BEGINBLOCK or OPX_UNDEFINED.
+    uint32_t pc;              ///< The position in the code. The code size for the implicit STOP.
+    uint32_t arg;             ///< The index of the block or of the PUSH value.
+    uint32_t block_gas_left;  ///< The gas of the block from this instruction to the block end.
+};
 
-        case OP_CALLDATALOAD:
-        {
-            uint32_t offset = to_uint32(stack.pop());
-            evmc_uint256be value = {};
+/// The requirements of a basic block checked before its execution.
+struct BasicBlock
+{
+    int64_t gas_cost = 0;      ///< The gas cost of all the block instructions.
+    int stack_required = 0;    ///< The stack height required by the block.
+    int stack_max_growth = 0;  ///< The maximum stack height increase within the block.
+};
 
-            if (offset < msg->input_size)
-            {
-                size_t copy_size = std::min(msg->input_size - offset, sizeof(value));
-                std::memcpy(value.bytes, &msg->input_data[offset], copy_size);
-            }
+/// The analysis of the code: the instructions prepared for the interpreter.
+///
+/// The PUSH values are decoded and the gas and stack costs are summed up per basic block
+/// in advance, so the interpreter charges the gas and checks the stack once per block.
+/// The analysis does not depend on the EVM revision, so it can be cached
+/// in the ::evmc_code_analysis_slot.
+struct CodeAnalysis
+{
+    std::vector<Instruction> instructions;    ///< The instructions ended with the STOP.
+    std::vector<BasicBlock> blocks;           ///< The basic blocks.
+    std::vector<evmc_uint256be> push_values;  ///< The values of the PUSH instructions.
 
-            stack.push(value);
-            break;
-        }
+    /// The map of the JUMPDEST positions to the indexes of their blocks' BEGINBLOCKs.
+    /// The other positions are mapped to -1.
+    std::vector<int32_t> jumpdests;
+};
 
-        case OP_NUMBER:
-        {
-            evmc_uint256be value =
-                to_uint256(static_cast<uint32_t>(host->get_tx_context(context).block_number));
-            stack.push(value);
-            break;
-        }
+/// The table of the implementation offsets for the threaded dispatch indexed by the opcodes.
+using LabelTable = std::array<ptrdiff_t, OPX_UNDEFINED + 1>;
+
+/// Returns the offsets of the instruction implementations for the threaded dispatch.
+const LabelTable& threaded_labels();
+
+/// Checks if the instruction is implemented by the Example VM.
+bool is_implemented(uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case OP_STOP:
+    case OP_ADD:
+    case OP_ADDRESS:
+    case OP_CALLDATALOAD:
+    case OP_NUMBER:
+    case OP_MSTORE:
+    case OP_SLOAD:
+    case OP_SSTORE:
+    case OP_JUMP:
+    case OP_JUMPI:
+    case OP_MSIZE:
+    case OP_JUMPDEST:
+    case OP_DUP1:
+    case OP_CALL:
+    case OP_RETURN:
+    case OP_REVERT:
+        return true;
+    default:
+        return opcode >= OP_PUSH1 && opcode <= OP_PUSH32;
+    }
+}
 
-        case OP_MSTORE:
+/// Analyzes the code using the EVMC instruction descriptors.
+///
+/// The basic blocks begin at the code start, at the JUMPDESTs and after the instructions
+/// ending the execution or jumping (including the not implemented ones).
+void analyze(CodeAnalysis& analysis, const uint8_t* code, size_t code_size)
+{
+    // The instructions used by the Example VM have the same metrics in all revisions.
+    const evmc_instruction_descriptor* descriptors =
+        evmc_get_instruction_descriptor_table(EVMC_LATEST_STABLE_REVISION);
+
+    analysis.instructions.reserve(code_size + 2);
+    analysis.jumpdests.assign(code_size, -1);
+
+    int stack_height = 0;  // The stack height relative to the block start.
+    bool block_ended = true;
+    for (size_t pc = 0; pc < code_size; ++pc)
+    {
+        const uint8_t opcode = code[pc];
+        if (block_ended || opcode == OP_JUMPDEST)
         {
-            uint32_t index = to_uint32(stack.pop());
-            evmc_uint256be value = stack.pop();
-            if (!memory.store(index, value.bytes, sizeof(value)))
-                return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
-            break;
+            if (analysis.instructions.empty() ||
+                analysis.instructions.back().opcode != OPX_BEGINBLOCK)
+            {
+                const Instruction begin = {0, OPX_BEGINBLOCK, static_cast<uint32_t>(pc),
+                                           static_cast<uint32_t>(analysis.blocks.size()), 0};
+                analysis.instructions.push_back(begin);
+                analysis.blocks.push_back(BasicBlock{});
+            }
+            stack_height = 0;
+            block_ended = false;
         }
+        if (opcode == OP_JUMPDEST)
+            analysis.jumpdests[pc] = static_cast<int32_t>(analysis.instructions.size() - 1);
 
-        case OP_SLOAD:
+        BasicBlock& block = analysis.blocks.back();
+        const evmc_instruction_descriptor& d = descriptors[opcode];
+        Instruction instr = {0, opcode, static_cast<uint32_t>(pc), 0, 0};
+        if (!is_implemented(opcode))
         {
-            evmc_uint256be index = stack.pop();
-            evmc_uint256be value = host->get_storage(context, &msg->recipient, &index);
-            stack.push(value);
-            break;
+            instr.opcode = OPX_UNDEFINED;
+            block_ended = true;
         }
-
-        case OP_SSTORE:
+        else if (opcode == OP_REVERT)
         {
-            evmc_uint256be index = stack.pop();
-            evmc_uint256be value = stack.pop();
-            host->set_storage(context, &msg->recipient, &index, &value);
-            break;
+            // The REVERT is undefined before Byzantium, what is checked before its stack
+            // requirements in the execution.
+            block_ended = true;
         }
-
-        case OP_MSIZE:
+        else
         {
-            evmc_uint256be value = to_uint256(memory.size);
-            stack.push(value);
-            break;
+            block.stack_required = std::max(block.stack_required,
+                                            d.stack_height_required - stack_height);
+            stack_height += d.stack_height_change;
+            block.stack_max_growth = std::max(block.stack_max_growth, stack_height);
+            block_ended = (d.flags & (EVMC_INSTRUCTION_TERMINATOR | EVMC_INSTRUCTION_JUMP)) != 0;
         }
+        block.gas_cost += 1;  // Assume each instruction costs 1.
 
-        case OP_PUSH1:
-        case OP_PUSH2:
-        case OP_PUSH3:
-        case OP_PUSH4:
-        case OP_PUSH5:
-        case OP_PUSH6:
-        case OP_PUSH7:
-        case OP_PUSH8:
-        case OP_PUSH9:
-        case OP_PUSH10:
-        case OP_PUSH11:
-        case OP_PUSH12:
-        case OP_PUSH13:
-        case OP_PUSH14:
-        case OP_PUSH15:
-        case OP_PUSH16:
-        case OP_PUSH17:
-        case OP_PUSH18:
-        case OP_PUSH19:
-        case OP_PUSH20:
-        case OP_PUSH21:
-        case OP_PUSH22:
-        case OP_PUSH23:
-        case OP_PUSH24:
-        case OP_PUSH25:
-        case OP_PUSH26:
-        case OP_PUSH27:
-        case OP_PUSH28:
-        case OP_PUSH29:
-        case OP_PUSH30:
-        case OP_PUSH31:
-        case OP_PUSH32:
+        if (d.immediate_size != 0 && instr.opcode != OPX_UNDEFINED)
         {
+            // Decode the PUSH value. The data missing at the code end are zeros.
             evmc_uint256be value = {};
-            size_t num_push_bytes = size_t{code[pc]} - OP_PUSH1 + 1;
-            size_t offset = sizeof(value) - num_push_bytes;
-            std::memcpy(&value.bytes[offset], &code[pc + 1], num_push_bytes);
-            pc += num_push_bytes;
-            stack.push(value);
-            break;
+            const size_t push_size = std::min(size_t{d.immediate_size}, code_size - pc - 1);
+            std::memcpy(&value.bytes[sizeof(value) - d.immediate_size], &code[pc + 1], push_size);
+            instr.opcode = OP_PUSH1;
+            instr.arg = static_cast<uint32_t>(analysis.push_values.size());
+            analysis.push_values.push_back(value);
+            pc += d.immediate_size;
         }
+        analysis.instructions.push_back(instr);
+    }
 
-        case OP_DUP1:
-        {
-            evmc_uint256be value = stack.pop();
-            stack.push(value);
-            stack.push(value);
-            break;
-        }
+    // The implicit STOP at the code end, not charged nor traced.
+    const Instruction stop = {0, OP_STOP, static_cast<uint32_t>(code_size), 0, 0};
+    analysis.instructions.push_back(stop);
 
-        case OP_CALL:
-        {
-            evmc_message call_msg = {};
-            call_msg.gas = to_uint32(stack.pop());
-            call_msg.recipient = to_address(stack.pop());
-            call_msg.value = stack.pop();
+    // Set the gas left in the blocks for tracing and the labels for the threaded dispatch.
+    // The analysis is not modified later, so it can be shared by concurrent executions.
+    uint32_t block_gas_left = 0;
+    for (size_t i = analysis.instructions.size(); i-- > 0;)
+    {
+        Instruction& instr = analysis.instructions[i];
+        if (instr.opcode == OPX_BEGINBLOCK)
+            block_gas_left = 0;
+        else if (instr.pc < code_size)
+            instr.block_gas_left = ++block_gas_left;
+#if EXAMPLE_VM_THREADED_DISPATCH
+        instr.label = threaded_labels()[static_cast<size_t>(instr.opcode)];
+#endif
+    }
+}
 
-            uint32_t call_input_offset = to_uint32(stack.pop());
-            uint32_t call_input_size = to_uint32(stack.pop());
-            call_msg.input_data = memory.expand(call_input_offset, call_input_size);
-            call_msg.input_size = call_input_size;
+/// Reports the instruction to the tracer, unless it is the implicit STOP.
+/// The gas charged in advance for the rest of the block is added back to the gas left.
+void trace_step(const evmc_tracer& tracer,
+                const evmc_message* msg,
+                const uint8_t* code,
+                size_t code_size,
+                const Instruction& instr,
+                int64_t gas_left,
+                const Stack& stack)
+{
+    if (instr.pc >= code_size)
+        return;
+    const auto stack_height = static_cast<uint32_t>(stack.pointer - stack.items);
+    tracer.on_step(tracer.context, msg->depth, instr.pc, code[instr.pc],
+                   gas_left + instr.block_gas_left, stack_height,
+                   stack_height != 0 ? stack.pointer - 1 : nullptr);
+}
 
-            uint32_t call_output_offset = to_uint32(stack.pop());
-            uint32_t call_output_size = to_uint32(stack.pop());
-            uint8_t* call_output_ptr = memory.expand(call_output_offset, call_output_size);
+/// Finds the index of the instruction to jump to.
+/// Returns false if the destination is not a JUMPDEST.
+bool find_jumpdest(const CodeAnalysis& analysis, const evmc_uint256be& dest, size_t& index)
+{
+    for (size_t i = 0; i < sizeof(dest) - sizeof(uint32_t); ++i)
+    {
+        if (dest.bytes[i] != 0)
+            return false;
+    }
+    const uint32_t pc = to_uint32(dest);
+    if (pc >= analysis.jumpdests.size() || analysis.jumpdests[pc] < 0)
+        return false;
+    index = static_cast<size_t>(analysis.jumpdests[pc]);
+    return true;
+}
 
-            if (call_msg.input_data == nullptr || call_output_ptr == nullptr)
-                return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
+/// Checks if the value is not zero.
+bool is_nonzero(const evmc_uint256be& value)
+{
+    for (const auto b : value.bytes)
+    {
+        if (b != 0)
+            return true;
+    }
+    return false;
+}
 
-            evmc_result call_result = host->call(context, &call_msg);
+/// The list of the instruction implementations: X(opcode, label).
+#define EXAMPLE_VM_INSTRUCTIONS(X)      \
+    X(OPX_BEGINBLOCK, op_beginblock)    \
+    X(OPX_UNDEFINED, op_undefined)      \
+    X(OP_STOP, op_stop)                 \
+    X(OP_ADD, op_add)                   \
+    X(OP_ADDRESS, op_address)           \
+    X(OP_CALLDATALOAD, op_calldataload) \
+    X(OP_NUMBER, op_number)             \
+    X(OP_MSTORE, op_mstore)             \
+    X(OP_SLOAD, op_sload)               \
+    X(OP_SSTORE, op_sstore)             \
+    X(OP_JUMP, op_jump)                 \
+    X(OP_JUMPI, op_jumpi)               \
+    X(OP_MSIZE, op_msize)               \
+    X(OP_JUMPDEST, op_jumpdest)         \
+    X(OP_PUSH1, op_push)                \
+    X(OP_DUP1, op_dup1)                 \
+    X(OP_CALL, op_call)                 \
+    X(OP_RETURN, op_return)             \
+    X(OP_REVERT, op_revert)
+
+#if EXAMPLE_VM_THREADED_DISPATCH
+// The labels as values and the computed goto are the GNU extensions.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+/// Jumps to the implementation of the current instruction.
+/// Directly to its label in the threaded dispatch, otherwise through the switch.
+#define DISPATCH()                              \
+    do                                          \
+    {                                           \
+        if (Threaded)                           \
+            goto* (labels_base + instr->label); \
+        goto dispatch;                          \
+    } while (false)
+#else
+#define DISPATCH() goto dispatch
+#endif
 
-            evmc_uint256be value = to_uint256(call_result.status_code == EVMC_SUCCESS ? 1 : 0);
-            stack.push(value);
+/// Proceeds to the next instruction.
+#define NEXT()      \
+    do              \
+    {               \
+        ++instr;    \
+        DISPATCH(); \
+    } while (false)
+
+/// Reports the current instruction to the tracer if tracing.
+#define TRACE_STEP()                                                           \
+    do                                                                         \
+    {                                                                          \
+        if (on_step != nullptr)                                                \
+            trace_step(tracer, msg, code, code_size, *instr, gas_left, stack); \
+    } while (false)
+
+/// Executes the analyzed code, reporting the instructions and the storage modifications
+/// to the tracer. The storage prefetch is optional and may be null.
+///
+/// @tparam Threaded  Use the direct-threaded dispatch (jumping to the addresses of
+///                   the implementations stored in the instructions) instead of the switch.
+///                   Only available with EXAMPLE_VM_THREADED_DISPATCH.
+/// @param labels     If not null, nothing is executed and the offsets of the implementations
+///                   from op_beginblock are stored in the table instead, see threaded_labels().
+template <bool Threaded>
+evmc_result execute_code(const evmc_tracer& tracer,
+                         StoragePrefetch* prefetch,
+                         const CodeAnalysis& analysis,
+                         const evmc_host_interface* host,
+                         evmc_host_context* context,
+                         enum evmc_revision rev,
+                         const evmc_message* msg,
+                         const uint8_t* code,
+                         size_t code_size,
+                         LabelTable* labels = nullptr)
+{
+#if EXAMPLE_VM_THREADED_DISPATCH
+    // The base address of the implementation offsets.
+    const char* const labels_base = static_cast<const char*>(&&op_beginblock);
+    if (Threaded && labels != nullptr)
+    {
+#define STORE_LABEL(OPCODE, LABEL)                                       \
+    (*labels)[OPCODE] = static_cast<const char*>(&&LABEL) - labels_base;
+        EXAMPLE_VM_INSTRUCTIONS(STORE_LABEL)
+#undef STORE_LABEL
+        return evmc_result{};
+    }
+#else
+    (void)labels;
+#endif
 
-            if (call_output_size > call_result.output_size)
-                call_output_size = static_cast<uint32_t>(call_result.output_size);
-            memory.store(call_output_offset, call_result.output_data, call_output_size);
+    const auto on_step = tracer.on_step;
+    int64_t gas_left = msg->gas;
+    Stack stack;
+    Memory memory;
+    const Instruction* instr = analysis.instructions.data();
+    DISPATCH();
+
+dispatch:
+#define DISPATCH_CASE(OPCODE, LABEL) \
+    case OPCODE:                     \
+        goto LABEL;
+    switch (instr->opcode)
+    {
+        EXAMPLE_VM_INSTRUCTIONS(DISPATCH_CASE)
+    }
+#undef DISPATCH_CASE
 
-            if (call_result.release != nullptr)
-                call_result.release(&call_result);
-            break;
-        }
+op_beginblock:
+{
+    const BasicBlock& block = analysis.blocks[instr->arg];
+    gas_left -= block.gas_cost;
+    if (gas_left < 0)
+        return evmc_make_result(EVMC_OUT_OF_GAS, 0, 0, nullptr, 0);
+    const auto stack_height = static_cast<int>(stack.pointer - stack.items);
+    if (stack_height < block.stack_required)
+        return evmc_make_result(EVMC_STACK_UNDERFLOW, 0, 0, nullptr, 0);
+    if (stack_height + block.stack_max_growth > Stack::limit)
+        return evmc_make_result(EVMC_STACK_OVERFLOW, 0, 0, nullptr, 0);
+    NEXT();
+}
 
-        case OP_RETURN:
-        {
-            uint32_t output_offset = to_uint32(stack.pop());
-            uint32_t output_size = to_uint32(stack.pop());
-            uint8_t* output_ptr = memory.expand(output_offset, output_size);
-            if (output_ptr == nullptr)
-                return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
+op_undefined:
+    TRACE_STEP();
+    return evmc_make_result(EVMC_UNDEFINED_INSTRUCTION, 0, 0, nullptr, 0);
 
-            return evmc_make_result(EVMC_SUCCESS, gas_left, 0, output_ptr, output_size);
-        }
+op_stop:
+    TRACE_STEP();
+    return evmc_make_result(EVMC_SUCCESS, gas_left, 0, nullptr, 0);
 
-        case OP_REVERT:
-        {
-            if (rev < EVMC_BYZANTIUM)
-                return evmc_make_result(EVMC_UNDEFINED_INSTRUCTION, 0, 0, nullptr, 0);
+op_add:
+{
+    TRACE_STEP();
+    uint32_t a = to_uint32(stack.pop());
+    uint32_t b = to_uint32(stack.pop());
+    uint32_t sum = a + b;
+    stack.push(to_uint256(sum));
+    NEXT();
+}
 
-            uint32_t output_offset = to_uint32(stack.pop());
-            uint32_t output_size = to_uint32(stack.pop());
-            uint8_t* output_ptr = memory.expand(output_offset, output_size);
-            if (output_ptr == nullptr)
-                return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
+op_address:
+{
+    TRACE_STEP();
+    evmc_uint256be value = to_uint256(msg->recipient);
+    stack.push(value);
+    NEXT();
+}
 
-            return evmc_make_result(EVMC_REVERT, gas_left, 0, output_ptr, output_size);
-        }
-        }
+op_calldataload:
+{
+    TRACE_STEP();
+    uint32_t offset = to_uint32(stack.pop());
+    evmc_uint256be value = {};
+
+    if (offset < msg->input_size)
+    {
+        size_t copy_size = std::min(msg->input_size - offset, sizeof(value));
+        std::memcpy(value.bytes, &msg->input_data[offset], copy_size);
     }
 
-    return evmc_make_result(EVMC_SUCCESS, gas_left, 0, nullptr, 0);
+    stack.push(value);
+    NEXT();
+}
+
+op_number:
+{
+    TRACE_STEP();
+    evmc_uint256be value =
+        to_uint256(static_cast<uint32_t>(host->get_tx_context(context).block_number));
+    stack.push(value);
+    NEXT();
+}
+
+op_mstore:
+{
+    TRACE_STEP();
+    uint32_t index = to_uint32(stack.pop());
+    evmc_uint256be value = stack.pop();
+    if (!memory.store(index, value.bytes, sizeof(value)))
+        return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
+    NEXT();
+}
+
+op_sload:
+{
+    TRACE_STEP();
+    evmc_uint256be index = stack.pop();
+    const evmc_bytes32* prefetched = prefetch != nullptr ? prefetch->find(index) : nullptr;
+    evmc_uint256be value = prefetched != nullptr ?
+                               *prefetched :
+                               host->get_storage(context, &msg->recipient, &index);
+    stack.push(value);
+    NEXT();
+}
+
+op_sstore:
+{
+    TRACE_STEP();
+    evmc_uint256be index = stack.pop();
+    evmc_uint256be value = stack.pop();
+    host->set_storage(context, &msg->recipient, &index, &value);
+    if (prefetch != nullptr)
+    {
+        if (evmc_bytes32* prefetched = prefetch->find(index))
+            *prefetched = value;
+    }
+    if (tracer.on_storage != nullptr)
+        tracer.on_storage(tracer.context, msg->depth, &msg->recipient, &index, &value);
+    NEXT();
+}
+
+op_jump:
+{
+    TRACE_STEP();
+    size_t index = 0;
+    if (!find_jumpdest(analysis, stack.pop(), index))
+        return evmc_make_result(EVMC_BAD_JUMP_DESTINATION, 0, 0, nullptr, 0);
+    instr = &analysis.instructions[index];
+    DISPATCH();
 }
 
+op_jumpi:
+{
+    TRACE_STEP();
+    evmc_uint256be dest = stack.pop();
+    evmc_uint256be condition = stack.pop();
+    if (!is_nonzero(condition))
+        NEXT();
+
+    size_t index = 0;
+    if (!find_jumpdest(analysis, dest, index))
+        return evmc_make_result(EVMC_BAD_JUMP_DESTINATION, 0, 0, nullptr, 0);
+    instr = &analysis.instructions[index];
+    DISPATCH();
+}
+
+op_msize:
+{
+    TRACE_STEP();
+    evmc_uint256be value = to_uint256(memory.size);
+    stack.push(value);
+    NEXT();
+}
+
+op_jumpdest:
+    TRACE_STEP();
+    NEXT();
+
+op_push:
+    TRACE_STEP();
+    stack.push(analysis.push_values[instr->arg]);
+    NEXT();
+
+op_dup1:
+{
+    TRACE_STEP();
+    evmc_uint256be value = stack.pop();
+    stack.push(value);
+    stack.push(value);
+    NEXT();
+}
+
+op_call:
+{
+    TRACE_STEP();
+    evmc_message call_msg = {};
+    call_msg.gas = to_uint32(stack.pop());
+    call_msg.recipient = to_address(stack.pop());
+    call_msg.value = stack.pop();
+
+    uint32_t call_input_offset = to_uint32(stack.pop());
+    uint32_t call_input_size = to_uint32(stack.pop());
+    call_msg.input_data = memory.expand(call_input_offset, call_input_size);
+    call_msg.input_size = call_input_size;
+
+    uint32_t call_output_offset = to_uint32(stack.pop());
+    uint32_t call_output_size = to_uint32(stack.pop());
+    uint8_t* call_output_ptr = memory.expand(call_output_offset, call_output_size);
+
+    if (call_msg.input_data == nullptr || call_output_ptr == nullptr)
+        return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
+
+    evmc_result call_result = host->call(context, &call_msg);
+    if (prefetch != nullptr)
+        prefetch->invalidate();
+
+    evmc_uint256be value = to_uint256(call_result.status_code == EVMC_SUCCESS ? 1 : 0);
+    stack.push(value);
+
+    if (call_output_size > call_result.output_size)
+        call_output_size = static_cast<uint32_t>(call_result.output_size);
+    memory.store(call_output_offset, evmc_get_output_data(&call_result), call_output_size);
+
+    if (call_result.release != nullptr)
+        call_result.release(&call_result);
+    NEXT();
+}
+
+op_return:
+{
+    TRACE_STEP();
+    uint32_t output_offset = to_uint32(stack.pop());
+    uint32_t output_size = to_uint32(stack.pop());
+    uint8_t* output_ptr = memory.expand(output_offset, output_size);
+    if (output_ptr == nullptr)
+        return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
+
+    return evmc_make_host_output_result(host, context, EVMC_SUCCESS, gas_left, 0, output_ptr,
+                                        output_size);
+}
+
+op_revert:
+{
+    TRACE_STEP();
+    if (rev < EVMC_BYZANTIUM)
+        return evmc_make_result(EVMC_UNDEFINED_INSTRUCTION, 0, 0, nullptr, 0);
+    if (stack.pointer - stack.items < 2)
+        return evmc_make_result(EVMC_STACK_UNDERFLOW, 0, 0, nullptr, 0);
+
+    uint32_t output_offset = to_uint32(stack.pop());
+    uint32_t output_size = to_uint32(stack.pop());
+    uint8_t* output_ptr = memory.expand(output_offset, output_size);
+    if (output_ptr == nullptr)
+        return evmc_make_result(EVMC_FAILURE, 0, 0, nullptr, 0);
+
+    return evmc_make_host_output_result(host, context, EVMC_REVERT, gas_left, 0, output_ptr,
+                                        output_size);
+}
+}
+
+#undef TRACE_STEP
+#undef NEXT
+#undef DISPATCH
+#if EXAMPLE_VM_THREADED_DISPATCH
+#pragma GCC diagnostic pop
+#endif
+
+const LabelTable& threaded_labels()
+{
+    static const LabelTable labels = [] {
+        LabelTable table{};
+        execute_code<true>(evmc_tracer{}, nullptr, CodeAnalysis{}, nullptr, nullptr, EVMC_FRONTIER,
+                           nullptr, nullptr, 0, &table);
+        return table;
+    }();
+    return labels;
+}
+
+/// The implementation of the evmc_vm::release_code_analysis() method.
+void release_code_analysis(evmc_vm* /*instance*/, void* analysis)
+{
+    delete static_cast<CodeAnalysis*>(analysis);
+}
+
+/// The example implementation of the evmc_vm::execute() method.
+evmc_result execute(evmc_vm* instance,
+                    const evmc_host_interface* host,
+                    evmc_host_context* context,
+                    enum evmc_revision rev,
+                    const evmc_message* msg,
+                    const uint8_t* code,
+                    size_t code_size)
+{
+    auto* vm = static_cast<ExampleVM*>(instance);
+
+    if (vm->verbose > 0)
+        std::puts("execution started\n");
+
+    // Query the tracer once, use the callbacks of the empty tracer when not tracing.
+    const evmc_tracer* host_tracer =
+        host != nullptr && host->get_tracer != nullptr ? host->get_tracer(context) : nullptr;
+    const evmc_tracer tracer = host_tracer != nullptr ? *host_tracer : evmc_tracer{};
+    if (tracer.on_call_start != nullptr)
+        tracer.on_call_start(tracer.context, msg);
+
+    StoragePrefetch prefetch;
+    const bool use_prefetch =
+        vm->prefetch_storage && host != nullptr && host->get_storage_batch != nullptr;
+    if (use_prefetch)
+        prefetch.fetch(host, context, msg, code, code_size);
+
+    // Reuse the analysis cached by the Host in the slot or cache the new one.
+    CodeAnalysis local_analysis;
+    CodeAnalysis* analysis = &local_analysis;
+    evmc_code_analysis_slot* slot = msg->code_analysis;
+    if (slot != nullptr && slot->analysis != nullptr)
+        analysis = static_cast<CodeAnalysis*>(slot->analysis);
+    else
+    {
+        if (slot != nullptr)
+            slot->analysis = analysis = new CodeAnalysis;
+        analyze(*analysis, code, code_size);
+    }
+
+    const evmc_result result =
+        vm->threaded_dispatch ?
+            execute_code<true>(tracer, use_prefetch ? &prefetch : nullptr, *analysis, host,
+                               context, rev, msg, code, code_size) :
+            execute_code<false>(tracer, use_prefetch ? &prefetch : nullptr, *analysis, host,
+                                context, rev, msg, code, code_size);
+
+    if (tracer.on_call_end != nullptr)
+        tracer.on_call_end(tracer.context, msg->depth, &result);
+    return result;
+}
 
 /// @cond internal
 #if !defined(PROJECT_VERSION)
@@ -384,8 +884,8 @@ evmc_result execute(evmc_vm* instance,
 /// @endcond
 
 ExampleVM::ExampleVM()
-  : evmc_vm{EVMC_ABI_VERSION, "example_vm",       PROJECT_VERSION, ::destroy,
-            ::execute,        ::get_capabilities, ::set_option}
+  : evmc_vm{EVMC_ABI_VERSION,   "example_vm", PROJECT_VERSION,         ::destroy, ::execute,
+            ::get_capabilities, ::set_option, ::release_code_analysis, nullptr}
 {}
 }  // namespace
 
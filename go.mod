@@ -1,3 +1,3 @@
-module github.com/ethereum/evmc/v12
+module github.com/ethereum/evmc/v13
 
 go 1.11
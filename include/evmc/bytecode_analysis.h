@@ -0,0 +1,138 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+/**
+ * EVM Bytecode Analysis
+ *
+ * The single pass analysis of EVM 1 bytecode built on top of the instruction metrics tables.
+ * It splits the code into basic blocks with summed static gas costs and stack requirements,
+ * so a VM can charge gas and check the stack once per block instead of once per instruction.
+ *
+ * @defgroup bytecode_analysis EVM Bytecode Analysis
+ * @{
+ */
+#pragma once
+
+#include <evmc/evmc.h>
+#include <evmc/utils.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The basic block of EVM bytecode.
+ *
+ * The block starts at the beginning of the code or at a JUMPDEST instruction.
+ * The block ends after an instruction which terminates the execution or changes
+ * the control flow (STOP, JUMP, JUMPI, RETURN, REVERT, INVALID, SELFDESTRUCT or an undefined
+ * instruction), before the next JUMPDEST or at the end of the code.
+ */
+struct evmc_basic_block
+{
+    /** The code offset of the first instruction of the block. */
+    size_t begin;
+
+    /** The code offset after the last instruction of the block (including its push data). */
+    size_t end;
+
+    /** The sum of the static gas costs of the instructions in the block. */
+    int64_t gas_cost;
+
+    /** The minimum EVM stack height required at the block entry. */
+    int32_t stack_height_required;
+
+    /** The maximum EVM stack height growth relative to the height at the block entry. */
+    int32_t stack_height_max_growth;
+
+    /** The EVM stack height change caused by executing the whole block. */
+    int32_t stack_height_change;
+};
+
+/**
+ * The result of the bytecode analysis.
+ *
+ * Created by evmc_analyze_bytecode() and released with evmc_release_bytecode_analysis().
+ */
+struct evmc_bytecode_analysis
+{
+    /** The array of basic blocks, ordered by code offsets. */
+    const struct evmc_basic_block* blocks;
+
+    /** The number of basic blocks. */
+    size_t num_blocks;
+
+    /**
+     * The bitmap of valid jump destinations.
+     *
+     * The bit (offset % 64) of the word (offset / 64) is set if the code offset is
+     * a JUMPDEST instruction (i.e. not the push data). The array has (code_size + 63) / 64 words.
+     */
+    const uint64_t* jumpdest_map;
+
+    /** The size of the analysed code. */
+    size_t code_size;
+};
+
+/**
+ * Analyses the EVM bytecode.
+ *
+ * @param revision   The EVM revision defining the instruction set and the gas costs.
+ * @param code       The bytecode. MAY be NULL only if code_size is 0.
+ * @param code_size  The bytecode size.
+ * @return           The analysis result or NULL in case of memory allocation failure
+ *                   (including the allocation size overflow) or an invalid EVM revision provided.
+ */
+EVMC_EXPORT struct evmc_bytecode_analysis* evmc_analyze_bytecode(enum evmc_revision revision,
+                                                                  const uint8_t* code,
+                                                                  size_t code_size);
+
+/**
+ * Releases the analysis result created by evmc_analyze_bytecode().
+ *
+ * @param analysis  The analysis result. MAY be NULL.
+ */
+EVMC_EXPORT void evmc_release_bytecode_analysis(struct evmc_bytecode_analysis* analysis);
+
+/**
+ * Computes the bitmaps of valid jump destinations and of push data of the EVM bytecode.
+ *
+ * The code is processed in 64-byte chunks using the AVX2 (x86-64, selected at runtime
+ * depending on the CPU) or NEON (AArch64) instructions, with the portable fallback
+ * for other architectures. The bitmaps have the layout of evmc_bytecode_analysis::jumpdest_map.
+ *
+ * @param code           The bytecode. MAY be NULL only if code_size is 0.
+ * @param code_size      The bytecode size.
+ * @param jumpdest_map   The output bitmap of the JUMPDEST instructions (excluding push data).
+ *                       MUST have space for (code_size + 63) / 64 words.
+ * @param push_data_map  The output bitmap of the PUSH instructions data bytes. MAY be NULL.
+ *                       Otherwise, MUST have space for (code_size + 63) / 64 words.
+ */
+EVMC_EXPORT void evmc_analyze_jumpdests(const uint8_t* code,
+                                        size_t code_size,
+                                        uint64_t* jumpdest_map,
+                                        uint64_t* push_data_map);
+
+/**
+ * Checks if the code offset is a valid jump destination.
+ *
+ * @param analysis  The analysis result.
+ * @param offset    The code offset.
+ * @return          true if the offset is the offset of a JUMPDEST instruction.
+ */
+static inline bool evmc_is_jumpdest(const struct evmc_bytecode_analysis* analysis, size_t offset)
+{
+    return offset < analysis->code_size &&
+           ((analysis->jumpdest_map[offset / 64] >> (offset % 64)) & 1) != 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
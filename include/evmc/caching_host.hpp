@@ -0,0 +1,347 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.hpp>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace evmc
+{
+/// The least-recently-used cache of a fixed capacity.
+///
+/// @tparam Hash  The hash function of the keys.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache
+{
+    using Entry = std::pair<Key, Value>;
+
+    /// The entries, the most recently used first.
+    std::list<Entry> m_entries;
+
+    /// The index of the entries by their keys.
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> m_index;
+
+    size_t m_capacity;
+
+public:
+    /// Constructor.
+    /// @param capacity  The maximum number of entries. Nothing is cached if 0.
+    explicit LruCache(size_t capacity) noexcept : m_capacity{capacity} {}
+
+    /// The number of the cached entries.
+    size_t size() const noexcept { return m_index.size(); }
+
+    /// The maximum number of the cached entries.
+    size_t capacity() const noexcept { return m_capacity; }
+
+    /// Returns the pointer to the cached value or null if not cached.
+    ///
+    /// The entry becomes the most recently used. The pointer is valid until the entry is evicted.
+    Value* get(const Key& key) noexcept
+    {
+        const auto it = m_index.find(key);
+        if (it == m_index.end())
+            return nullptr;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &it->second->second;
+    }
+
+    /// Inserts or updates the entry and returns the reference to its value.
+    ///
+    /// If the cache is full the least recently used entry is evicted and its storage reused.
+    /// Must not be called if the capacity is 0.
+    Value& put(const Key& key, const Value& value)
+    {
+        if (auto* const cached = get(key); cached != nullptr)
+        {
+            *cached = value;
+            return *cached;
+        }
+
+        if (m_index.size() < m_capacity)
+            m_entries.emplace_front(key, value);
+        else
+        {
+            m_entries.splice(m_entries.begin(), m_entries, std::prev(m_entries.end()));
+            m_index.erase(m_entries.front().first);
+            m_entries.front() = {key, value};
+        }
+        m_index.emplace(key, m_entries.begin());
+        return m_entries.front().second;
+    }
+
+    /// Removes the entry if cached.
+    void erase(const Key& key) noexcept
+    {
+        const auto it = m_index.find(key);
+        if (it == m_index.end())
+            return;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+
+    /// Removes all the entries.
+    void clear() noexcept
+    {
+        m_index.clear();
+        m_entries.clear();
+    }
+};
+
+/// The Host decorator caching the account and the storage queries.
+///
+/// Memoizes the results of account_exists(), get_balance(), get_code_size(), get_code_hash()
+/// and get_storage() of the wrapped Host in the LRU caches, so repeated queries
+/// of the same accounts and storage slots (e.g. BALANCE, EXTCODEHASH or SLOAD in loops
+/// or via proxy contracts) do not reach the wrapped Host, which may be an expensive callback
+/// into the client's state (as for a HostContext in a VM). The caches are kept valid
+/// only within a single execution frame:
+/// - set_storage() writes through and caches the new value,
+/// - selfdestruct() invalidates the cached data of the account and the beneficiary,
+/// - call() clears all the caches, because the nested executions modify the state
+///   through the client's Host, not this one (e.g. a re-entrant SSTORE into the caller
+///   or a DELEGATECALL writing the storage of a proxy).
+///
+/// The owner of the CachingHost must call clear() when the frame using it is reverted
+/// (the written values are cached) and between the transactions. Any other modification
+/// of the state not done through this Host requires invalidate() or clear().
+///
+/// @tparam HashPolicy  The hash function template of the caches, e.g. evmc::seeded_hash
+///                     if the queried addresses and keys may be crafted to collide.
+template <template <typename> class HashPolicy>
+class BasicCachingHost : public Host
+{
+    /// The cached data of an account. Each field is cached independently.
+    struct CachedAccount
+    {
+        std::optional<bool> exists;
+        std::optional<uint256be> balance;
+        std::optional<size_t> code_size;
+        std::optional<bytes32> code_hash;
+    };
+
+    HostInterface& m_host;
+    mutable LruCache<address, CachedAccount, HashPolicy<address>> m_accounts;
+    mutable LruCache<StorageSlot, bytes32, HashPolicy<StorageSlot>> m_storage;
+
+    /// Returns the cached field of the account, querying the wrapped Host if not cached.
+    template <typename T, typename QueryFn>
+    T get_account_field(const address& addr,
+                        std::optional<T> CachedAccount::*field,
+                        QueryFn query) const
+    {
+        if (m_accounts.capacity() == 0)
+            return query();
+
+        auto* acc = m_accounts.get(addr);
+        if (acc == nullptr)
+            acc = &m_accounts.put(addr, {});
+        else if (const auto& cached = acc->*field; cached.has_value())
+            return *cached;
+
+        const auto value = query();
+        acc->*field = value;
+        return value;
+    }
+
+public:
+    /// The default capacity of the caches.
+    static constexpr size_t default_capacity = 4096;
+
+    /// Constructor.
+    /// @param host                The Host to forward the methods to. Must outlive
+    ///                            the CachingHost.
+    /// @param accounts_capacity   The maximum number of the cached accounts.
+    /// @param storage_capacity    The maximum number of the cached storage values.
+    explicit BasicCachingHost(HostInterface& host,
+                              size_t accounts_capacity = default_capacity,
+                              size_t storage_capacity = default_capacity) noexcept
+      : m_host{host}, m_accounts{accounts_capacity}, m_storage{storage_capacity}
+    {}
+
+    /// The number of the cached accounts.
+    size_t num_cached_accounts() const noexcept { return m_accounts.size(); }
+
+    /// The number of the cached storage values.
+    size_t num_cached_storage_values() const noexcept { return m_storage.size(); }
+
+    /// Invalidates the cached data of the account. The cached storage is kept.
+    void invalidate(const address& addr) noexcept { m_accounts.erase(addr); }
+
+    /// Invalidates the cached storage value.
+    void invalidate(const address& addr, const bytes32& key) noexcept
+    {
+        m_storage.erase({addr, key});
+    }
+
+    /// Invalidates all the cached data.
+    void clear() noexcept
+    {
+        m_accounts.clear();
+        m_storage.clear();
+    }
+
+    bool account_exists(const address& addr) const noexcept override
+    {
+        return get_account_field(addr, &CachedAccount::exists,
+                                 [&] { return m_host.account_exists(addr); });
+    }
+
+    bytes32 get_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        if (m_storage.capacity() == 0)
+            return m_host.get_storage(addr, key);
+
+        const StorageSlot slot{addr, key};
+        if (const auto* const cached = m_storage.get(slot); cached != nullptr)
+            return *cached;
+        return m_storage.put(slot, m_host.get_storage(addr, key));
+    }
+
+    evmc_storage_status set_storage(const address& addr,
+                                    const bytes32& key,
+                                    const bytes32& value) noexcept override
+    {
+        const auto status = m_host.set_storage(addr, key, value);
+        if (m_storage.capacity() != 0)
+            m_storage.put({addr, key}, value);
+        return status;
+    }
+
+    uint256be get_balance(const address& addr) const noexcept override
+    {
+        return get_account_field(addr, &CachedAccount::balance,
+                                 [&] { return m_host.get_balance(addr); });
+    }
+
+    size_t get_code_size(const address& addr) const noexcept override
+    {
+        return get_account_field(addr, &CachedAccount::code_size,
+                                 [&] { return m_host.get_code_size(addr); });
+    }
+
+    bytes32 get_code_hash(const address& addr) const noexcept override
+    {
+        return get_account_field(addr, &CachedAccount::code_hash,
+                                 [&] { return m_host.get_code_hash(addr); });
+    }
+
+    size_t copy_code(const address& addr,
+                     size_t code_offset,
+                     uint8_t* buffer_data,
+                     size_t buffer_size) const noexcept override
+    {
+        return m_host.copy_code(addr, code_offset, buffer_data, buffer_size);
+    }
+
+    bool selfdestruct(const address& addr, const address& beneficiary) noexcept override
+    {
+        invalidate(addr);
+        invalidate(beneficiary);
+        return m_host.selfdestruct(addr, beneficiary);
+    }
+
+    Result call(const evmc_message& msg) noexcept override
+    {
+        auto result = m_host.call(msg);
+        clear();
+        return result;
+    }
+
+    evmc_tx_context get_tx_context() const noexcept override { return m_host.get_tx_context(); }
+
+    bytes32 get_block_hash(int64_t block_number) const noexcept override
+    {
+        return m_host.get_block_hash(block_number);
+    }
+
+    void emit_log(const address& addr,
+                  const uint8_t* data,
+                  size_t data_size,
+                  const bytes32 topics[],
+                  size_t topics_count) noexcept override
+    {
+        m_host.emit_log(addr, data, data_size, topics, topics_count);
+    }
+
+    evmc_access_status access_account(const address& addr) noexcept override
+    {
+        return m_host.access_account(addr);
+    }
+
+    evmc_access_status access_storage(const address& addr, const bytes32& key) noexcept override
+    {
+        return m_host.access_storage(addr, key);
+    }
+
+    bytes32 get_transient_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        return m_host.get_transient_storage(addr, key);
+    }
+
+    void set_transient_storage(const address& addr,
+                               const bytes32& key,
+                               const bytes32& value) noexcept override
+    {
+        m_host.set_transient_storage(addr, key, value);
+    }
+
+    void get_storage_batch(const evmc_storage_key keys[],
+                           bytes32 values[],
+                           size_t count) const noexcept override
+    {
+        if (m_storage.capacity() == 0)
+        {
+            m_host.get_storage_batch(keys, values, count);
+            return;
+        }
+
+        // Query the entries not cached with a single batch.
+        std::vector<size_t> misses;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (const auto* const cached = m_storage.get({keys[i].address, keys[i].key});
+                cached != nullptr)
+                values[i] = *cached;
+            else
+                misses.push_back(i);
+        }
+        if (misses.empty())
+            return;
+
+        std::vector<evmc_storage_key> miss_keys;
+        miss_keys.reserve(misses.size());
+        for (const auto i : misses)
+            miss_keys.push_back(keys[i]);
+        std::vector<bytes32> miss_values(misses.size());
+        m_host.get_storage_batch(miss_keys.data(), miss_values.data(), miss_keys.size());
+
+        for (size_t j = 0; j < misses.size(); ++j)
+        {
+            values[misses[j]] = miss_values[j];
+            m_storage.put({miss_keys[j].address, miss_keys[j].key}, miss_values[j]);
+        }
+    }
+
+    bool get_code_view(const address& addr, evmc_code_view& view) const noexcept override
+    {
+        return m_host.get_code_view(addr, view);
+    }
+
+    uint8_t* allocate_output(size_t size) noexcept override { return m_host.allocate_output(size); }
+
+    const evmc_tracer* get_tracer() noexcept override { return m_host.get_tracer(); }
+
+    const evmc_tx_initcode* get_tx_initcode(const bytes32& hash) const noexcept override
+    {
+        return m_host.get_tx_initcode(hash);
+    }
+};
+
+/// The Host decorator caching the account and the storage queries in the FNV-1a based caches.
+using CachingHost = BasicCachingHost<std::hash>;
+}  // namespace evmc
@@ -0,0 +1,453 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/mocked_host.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace evmc
+{
+/// The thread-safe mocked EVMC Host for the concurrent executions against the shared state.
+///
+/// Multiple VM instances (or threads of the same VM) may execute sibling transactions
+/// through the same Host. The accounts are distributed over num_shards maps by the hash
+/// of the address, each guarded by its own reader-writer lock (lock striping), so
+/// the executions accessing different accounts rarely contend and the read-only queries
+/// of the same account run in parallel.
+///
+/// The records (calls, LOGs, selfdestructs, block hashes and account accesses), the sets
+/// of the warm accounts and storage slots (EIP-2929) and the transient storage (EIP-1153)
+/// are kept per thread without locking, as if each thread executed a separate transaction.
+/// A thread executing a sequence of transactions calls begin_transaction() before each of
+/// them. The records of all the threads are merged on demand, e.g. recorded_logs(),
+/// when no executions are running. The MockedAccount::transient_storage is not used.
+///
+/// The state modifications are applied to the shared state immediately, the conflicting
+/// modifications of the concurrent executions are not detected (see evmc::ParallelExecutor).
+/// The tx_context, block_hash and call_result must not be modified during the executions.
+///
+/// @tparam HashPolicy  The hash function template of the maps, see BasicMockedHost.
+template <template <typename> class HashPolicy>
+class BasicConcurrentMockedHost : public Host
+{
+public:
+    /// The type of the mocked accounts.
+    using MockedAccount = BasicMockedAccount<HashPolicy>;
+
+    /// LOG record.
+    using log_record = MockedCallsAndLogs::log_record;
+
+    /// The number of the account shards.
+    static constexpr size_t num_shards = 16;
+
+    /// The EVMC transaction context to be returned by get_tx_context().
+    evmc_tx_context tx_context = {};
+
+    /// The block header hash value to be returned by get_block_hash().
+    bytes32 block_hash = {};
+
+    /// The call result to be returned by the call() method.
+    evmc_result call_result = {};
+
+private:
+    /// The accounts of a shard and their lock. Aligned to avoid false sharing of the locks.
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<address, MockedAccount, HashPolicy<address>> accounts;
+    };
+
+    /// The records of a thread.
+    struct ThreadRecords : MockedCallsAndLogs
+    {
+        using MockedCallsAndLogs::record_call;
+        using MockedCallsAndLogs::record_log;
+
+        std::vector<int64_t> blockhashes;
+        std::vector<address> account_accesses;
+        std::unordered_map<address, std::vector<address>> selfdestructs;
+        std::unordered_set<address, HashPolicy<address>> accessed_accounts;
+        std::unordered_set<StorageSlot, HashPolicy<StorageSlot>> accessed_storage;
+        std::unordered_map<StorageSlot, bytes32, HashPolicy<StorageSlot>> transient_storage;
+    };
+
+    /// The source of the record generations, unique across all the Host instances.
+    static inline std::atomic<uint64_t> s_next_generation{1};
+
+    std::array<Shard, num_shards> m_shards;
+
+    /// The records of the threads, by the thread id.
+    mutable std::unordered_map<std::thread::id, std::unique_ptr<ThreadRecords>> m_records;
+    mutable std::shared_mutex m_records_mutex;
+
+    /// The generation of m_records, renewed by clear_records(). It identifies the records
+    /// cached by the threads, also after the Host address is reused by another instance.
+    uint64_t m_records_generation = s_next_generation++;
+
+    Shard& shard(const address& addr) noexcept
+    {
+        return m_shards[HashPolicy<address>{}(addr) % num_shards];
+    }
+
+    const Shard& shard(const address& addr) const noexcept
+    {
+        return m_shards[HashPolicy<address>{}(addr) % num_shards];
+    }
+
+    /// Returns the records of the calling thread, creating them on the first use.
+    ///
+    /// The records of the Host used last by the thread are cached in a thread-local variable,
+    /// so the m_records_mutex is only taken on the first use and when switching the Hosts.
+    ThreadRecords& thread_records() const
+    {
+        thread_local struct
+        {
+            uint64_t generation = 0;
+            ThreadRecords* records = nullptr;
+        } cache;
+
+        if (cache.generation == m_records_generation)
+            return *cache.records;
+
+        cache = {m_records_generation, &find_thread_records()};
+        return *cache.records;
+    }
+
+    /// Finds the records of the calling thread in m_records, creating them if needed.
+    ThreadRecords& find_thread_records() const
+    {
+        const auto id = std::this_thread::get_id();
+        {
+            const std::shared_lock lock{m_records_mutex};
+            if (const auto it = m_records.find(id); it != m_records.end())
+                return *it->second;
+        }
+        const std::unique_lock lock{m_records_mutex};
+        auto& records = m_records[id];
+        if (!records)
+            records = std::make_unique<ThreadRecords>();
+        return *records;
+    }
+
+    /// Records an account access in the records of the calling thread.
+    /// @return  True if the account has been accessed by the thread before.
+    bool record_account_access(const address& addr) const
+    {
+        auto& records = thread_records();
+        if (records.account_accesses.size() < MockedHost::max_recorded_account_accesses)
+            records.account_accesses.emplace_back(addr);
+        return !records.accessed_accounts.insert(addr).second;
+    }
+
+    /// Calls the function with the account under the shared lock of its shard.
+    /// Returns the default value if the account does not exist.
+    template <typename T, typename Fn>
+    T read_account(const address& addr, T default_value, Fn fn) const
+    {
+        const auto& s = shard(addr);
+        const std::shared_lock lock{s.mutex};
+        const auto it = s.accounts.find(addr);
+        return it != s.accounts.end() ? fn(it->second) : default_value;
+    }
+
+public:
+    /// Calls the function with the account under the exclusive lock of its shard,
+    /// creating the account if needed. Use it to set up and modify the state.
+    /// The function must not call the methods of this Host.
+    template <typename Fn>
+    decltype(auto) with_account(const address& addr, Fn fn)
+    {
+        auto& s = shard(addr);
+        const std::unique_lock lock{s.mutex};
+        return fn(s.accounts[addr]);
+    }
+
+    /// Returns the copy of the account or nothing if the account does not exist.
+    std::optional<MockedAccount> get_account(const address& addr) const
+    {
+        return read_account(addr, std::optional<MockedAccount>{},
+                            [](const MockedAccount& acc) { return std::optional{acc}; });
+    }
+
+    /// The number of the accounts.
+    size_t num_accounts() const
+    {
+        size_t n = 0;
+        for (const auto& s : m_shards)
+        {
+            const std::shared_lock lock{s.mutex};
+            n += s.accounts.size();
+        }
+        return n;
+    }
+
+    /// Returns the calls of all the threads. Must not be called during the executions.
+    std::vector<evmc_message> recorded_calls() const
+    {
+        std::vector<evmc_message> calls;
+        for (const auto& [id, records] : m_records)
+        {
+            calls.insert(calls.end(), records->recorded_calls.begin(),
+                         records->recorded_calls.end());
+        }
+        return calls;
+    }
+
+    /// Returns the LOGs of all the threads. Must not be called during the executions.
+    ///
+    /// The LOGs of a thread are in the order of the emission. The LOG data and topics
+    /// stay valid until clear_records().
+    std::vector<log_record> recorded_logs() const
+    {
+        std::vector<log_record> logs;
+        for (const auto& [id, records] : m_records)
+            logs.insert(logs.end(), records->recorded_logs.begin(), records->recorded_logs.end());
+        return logs;
+    }
+
+    /// Returns the SELFDESTRUCTs of all the threads as a map
+    /// selfdestructed_address => [beneficiary1, beneficiary2, ...].
+    /// Must not be called during the executions.
+    std::unordered_map<address, std::vector<address>> recorded_selfdestructs() const
+    {
+        std::unordered_map<address, std::vector<address>> selfdestructs;
+        for (const auto& [id, records] : m_records)
+        {
+            for (const auto& [addr, beneficiaries] : records->selfdestructs)
+            {
+                auto& merged = selfdestructs[addr];
+                merged.insert(merged.end(), beneficiaries.begin(), beneficiaries.end());
+            }
+        }
+        return selfdestructs;
+    }
+
+    /// Returns the block numbers requested by get_block_hash() in all the threads.
+    /// Must not be called during the executions.
+    std::vector<int64_t> recorded_blockhashes() const
+    {
+        std::vector<int64_t> blockhashes;
+        for (const auto& [id, records] : m_records)
+        {
+            blockhashes.insert(blockhashes.end(), records->blockhashes.begin(),
+                               records->blockhashes.end());
+        }
+        return blockhashes;
+    }
+
+    /// Starts a new transaction executed by the calling thread.
+    ///
+    /// Clears the warm accounts and storage slots and the transient storage of the calling
+    /// thread. The other records of the thread are kept.
+    void begin_transaction()
+    {
+        auto& records = thread_records();
+        records.accessed_accounts.clear();
+        records.accessed_storage.clear();
+        records.transient_storage.clear();
+    }
+
+    /// Clears the records, the warm accounts and storage slots and the transient storage
+    /// of all the threads, e.g. between the batches of transactions.
+    /// Must not be called during the executions.
+    void clear_records()
+    {
+        const std::unique_lock lock{m_records_mutex};
+        m_records.clear();
+        m_records_generation = s_next_generation++;
+    }
+
+    /// Returns true if an account exists (EVMC Host method).
+    bool account_exists(const address& addr) const noexcept override
+    {
+        record_account_access(addr);
+        return read_account(addr, false, [](const MockedAccount&) { return true; });
+    }
+
+    /// Get the account's storage value at the given key (EVMC Host method).
+    bytes32 get_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        record_account_access(addr);
+        return read_account(addr, bytes32{}, [&key](const MockedAccount& acc) {
+            const auto it = acc.storage.find(key);
+            return it != acc.storage.end() ? it->second.current : bytes32{};
+        });
+    }
+
+    /// Set the account's storage value (EVMC Host method).
+    ///
+    /// Creates the account if it does not exist, as the MockedHost::set_storage().
+    evmc_storage_status set_storage(const address& addr,
+                                    const bytes32& key,
+                                    const bytes32& value) noexcept override
+    {
+        record_account_access(addr);
+        return with_account(addr, [&key, &value](MockedAccount& acc) {
+            auto& s = acc.storage[key];
+            const auto status = compute_storage_status(s.original, s.current, value);
+            s.current = value;
+            return status;
+        });
+    }
+
+    /// Get the account's balance (EVMC Host method).
+    uint256be get_balance(const address& addr) const noexcept override
+    {
+        record_account_access(addr);
+        return read_account(addr, uint256be{},
+                            [](const MockedAccount& acc) { return acc.balance; });
+    }
+
+    /// Get the account's code size (EVMC host method).
+    size_t get_code_size(const address& addr) const noexcept override
+    {
+        record_account_access(addr);
+        return read_account(addr, size_t{0},
+                            [](const MockedAccount& acc) { return acc.code.size(); });
+    }
+
+    /// Get the account's code hash (EVMC host method).
+    bytes32 get_code_hash(const address& addr) const noexcept override
+    {
+        record_account_access(addr);
+        return read_account(addr, bytes32{},
+                            [](const MockedAccount& acc) { return acc.codehash; });
+    }
+
+    /// Copy the account's code to the given buffer (EVMC host method).
+    size_t copy_code(const address& addr,
+                     size_t code_offset,
+                     uint8_t* buffer_data,
+                     size_t buffer_size) const noexcept override
+    {
+        record_account_access(addr);
+        return read_account(addr, size_t{0}, [=](const MockedAccount& acc) {
+            const auto& code = acc.code;
+            if (code_offset >= code.size())
+                return size_t{0};
+            const auto n = std::min(buffer_size, code.size() - code_offset);
+            if (n > 0)
+                std::copy_n(&code[code_offset], n, buffer_data);
+            return n;
+        });
+    }
+
+    /// Get the view of the account's code (EVMC host method).
+    ///
+    /// The view references the MockedAccount::code directly and stays valid
+    /// as long as the account's code is not modified.
+    bool get_code_view(const address& addr, evmc_code_view& view) const noexcept override
+    {
+        record_account_access(addr);
+        view = read_account(addr, evmc_code_view{}, [](const MockedAccount& acc) {
+            return evmc_code_view{acc.code.data(), acc.code.size(), acc.codehash};
+        });
+        return true;
+    }
+
+    /// Selfdestruct the account (EVMC host method).
+    ///
+    /// @return  True if the account has not been selfdestructed by the calling thread yet.
+    bool selfdestruct(const address& addr, const address& beneficiary) noexcept override
+    {
+        record_account_access(addr);
+        auto& beneficiaries = thread_records().selfdestructs[addr];
+        beneficiaries.emplace_back(beneficiary);
+        return beneficiaries.size() == 1;
+    }
+
+    /// Call/create other contract (EVMC host method).
+    Result call(const evmc_message& msg) noexcept override
+    {
+        record_account_access(msg.recipient);
+        thread_records().record_call(msg);
+        return Result{call_result};
+    }
+
+    /// Get transaction context (EVMC host method).
+    evmc_tx_context get_tx_context() const noexcept override { return tx_context; }
+
+    /// Get the block header hash (EVMC host method).
+    bytes32 get_block_hash(int64_t block_number) const noexcept override
+    {
+        thread_records().blockhashes.emplace_back(block_number);
+        return block_hash;
+    }
+
+    /// Emit LOG (EVMC host method).
+    void emit_log(const address& addr,
+                  const uint8_t* data,
+                  size_t data_size,
+                  const bytes32 topics[],
+                  size_t topics_count) noexcept override
+    {
+        thread_records().record_log(addr, data, data_size, topics, topics_count);
+    }
+
+    /// Record an account access (EVMC host method).
+    ///
+    /// The account is warm if it has been accessed by the calling thread before
+    /// or it is a precompile, see MockedHost::access_account().
+    evmc_access_status access_account(const address& addr) noexcept override
+    {
+        const auto already_accessed = record_account_access(addr);
+
+        // Accessing precompiled contracts is always warm.
+        if (addr >= 0x0000000000000000000000000000000000000001_address &&
+            addr <= 0x0000000000000000000000000000000000000009_address)
+            return EVMC_ACCESS_WARM;
+
+        return already_accessed ? EVMC_ACCESS_WARM : EVMC_ACCESS_COLD;
+    }
+
+    /// Access the account's storage value at the given key (EVMC host method).
+    ///
+    /// The storage slot is warm if it has been accessed by the calling thread before
+    /// or its StorageValue::access_status in the shared state is warm (e.g. to mock
+    /// the access list). The shared state is not modified.
+    evmc_access_status access_storage(const address& addr, const bytes32& key) noexcept override
+    {
+        if (!thread_records().accessed_storage.insert({addr, key}).second)
+            return EVMC_ACCESS_WARM;
+        return read_account(addr, EVMC_ACCESS_COLD, [&key](const MockedAccount& acc) {
+            const auto it = acc.storage.find(key);
+            return it != acc.storage.end() ? it->second.access_status : EVMC_ACCESS_COLD;
+        });
+    }
+
+    /// Get account's transient storage (EVMC host method).
+    ///
+    /// The transient storage is kept per thread, see begin_transaction().
+    bytes32 get_transient_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        record_account_access(addr);
+        const auto& transient_storage = thread_records().transient_storage;
+        const auto it = transient_storage.find({addr, key});
+        return it != transient_storage.end() ? it->second : bytes32{};
+    }
+
+    /// Set account's transient storage (EVMC host method).
+    ///
+    /// The transient storage is kept per thread, the account is not created.
+    void set_transient_storage(const address& addr,
+                               const bytes32& key,
+                               const bytes32& value) noexcept override
+    {
+        record_account_access(addr);
+        thread_records().transient_storage[{addr, key}] = value;
+    }
+};
+
+/// Thread-safe mocked EVMC Host implementation with the FNV-1a based hash maps.
+using ConcurrentMockedHost = BasicConcurrentMockedHost<std::hash>;
+}  // namespace evmc
@@ -44,7 +44,7 @@ enum
      *
      * @see @ref versioning
      */
-    EVMC_ABI_VERSION = 12
+    EVMC_ABI_VERSION = 13
 };
 
 
@@ -89,6 +89,29 @@ enum evmc_flags
     EVMC_STATIC = 1 /**< Static call mode. */
 };
 
+/**
+ * The Host-owned storage for the VM's analysis of a code.
+ *
+ * The Host keeps one slot per code, keyed by the code hash, and passes it to the VM
+ * in evmc_message::code_analysis every time the code is executed. This way the VM's
+ * analysis of the code (e.g. jumpdest validation or basic blocks) survives between executions.
+ * The slot MUST only be passed to the same VM instance.
+ *
+ * The content of the analysis is opaque to the Host. When the Host drops the slot
+ * and the analysis is not NULL it MUST release it with evmc_vm::release_code_analysis.
+ */
+struct evmc_code_analysis_slot
+{
+    /**
+     * The VM-defined analysis of the code.
+     *
+     * Initially NULL. The VM MAY set it during the execution to be reused by
+     * following executions of the same code. The VM MUST NOT assume the analysis is used
+     * only with a single EVM revision.
+     */
+    void* analysis;
+};
+
 /**
  * The message describing an EVM call, including a zero-depth calls from a transaction origin.
  *
@@ -199,6 +222,13 @@ struct evmc_message
      * The length of the code to be executed.
      */
     size_t code_size;
+
+    /**
+     * The optional Host-owned cache slot for the analysis of the code to be executed.
+     *
+     * See ::evmc_code_analysis_slot. Ignored in evmc_call_fn(). This MAY be NULL.
+     */
+    struct evmc_code_analysis_slot* code_analysis;
 };
 
 /** The hashed initcode used for TXCREATE instruction. */
@@ -411,6 +441,23 @@ struct evmc_result;
  */
 typedef void (*evmc_release_result_fn)(const struct evmc_result* result);
 
+/** The maximum size of the output stored in evmc_result::inline_output. */
+enum
+{
+    /**
+     * Fits the single 256-bit word, the common output of view calls,
+     * e.g. a balance or a bool.
+     */
+    EVMC_INLINE_OUTPUT_MAX_SIZE = 32
+};
+
+/** The flags of the ::evmc_result. */
+enum evmc_result_flags
+{
+    /** The output is stored in evmc_result::inline_output. */
+    EVMC_RESULT_INLINE_OUTPUT = 1
+};
+
 /** The EVM code execution result. */
 struct evmc_result
 {
@@ -440,9 +487,11 @@ struct evmc_result
      * field is ::EVMC_SUCCESS) or from REVERT opcode.
      *
      * The memory containing the output data is owned by EVM and has to be
-     * freed with evmc_result::release().
+     * freed with evmc_result::release(), unless it has been provided by the Host
+     * with evmc_host_interface::allocate_output().
      *
-     * This pointer MAY be NULL.
+     * This pointer MAY be NULL. For the output stored in evmc_result::inline_output
+     * this pointer is NULL or references the inline output of some copy of the result.
      * If evmc_result::output_size is 0 this pointer MUST NOT be dereferenced.
      */
     const uint8_t* output_data;
@@ -450,7 +499,8 @@ struct evmc_result
     /**
      * The size of the output data.
      *
-     * If evmc_result::output_data is NULL this MUST be 0.
+     * If evmc_result::output_data is NULL and the output is not stored in
+     * evmc_result::inline_output this MUST be 0.
      */
     size_t output_size;
 
@@ -493,10 +543,26 @@ struct evmc_result
      * to be optionally used by the evmc_result object creator.
      *
      * @see evmc_result_optional_data, evmc_get_optional_data().
-     *
-     * Also extends the size of the evmc_result to 64 bytes (full cache line).
      */
     uint8_t padding[4];
+
+    /**
+     * The result flags, the bitwise OR of ::evmc_result_flags values.
+     */
+    uint32_t flags;
+
+    /**
+     * The storage of the short output kept in the result itself.
+     *
+     * If evmc_result::flags has ::EVMC_RESULT_INLINE_OUTPUT set, the output of
+     * evmc_result::output_size bytes is stored here instead of the memory referenced by
+     * evmc_result::output_data. Such output is moved together with the result by value
+     * and requires no memory allocation nor evmc_result::release().
+     *
+     * Because the result may have been copied, evmc_result::output_data MUST NOT be
+     * used to access the inline output. Use evmc_get_output_data() instead.
+     */
+    uint8_t inline_output[EVMC_INLINE_OUTPUT_MAX_SIZE];
 };
 
 
@@ -527,6 +593,43 @@ typedef evmc_bytes32 (*evmc_get_storage_fn)(struct evmc_host_context* context,
                                             const evmc_address* address,
                                             const evmc_bytes32* key);
 
+/**
+ * The reference to an account storage entry.
+ *
+ * Used to describe a single item of a batched storage query.
+ */
+typedef struct evmc_storage_key
+{
+    /** The address of the account. */
+    evmc_address address;
+
+    /** The index of the account's storage entry. */
+    evmc_bytes32 key;
+} evmc_storage_key;
+
+/**
+ * Get storage batch callback function.
+ *
+ * This callback function is used by a VM to query multiple storage entries at once.
+ * The effect is the same as calling ::evmc_get_storage_fn for each of the keys in order,
+ * but the Host is free to resolve the entries concurrently (e.g. by issuing a single
+ * parallel database read) instead of serving them one round-trip at a time.
+ *
+ * This callback is optional and MAY be NULL. The VM MUST fall back to
+ * evmc_host_interface::get_storage in such case.
+ *
+ * @param context  The Host execution context.
+ * @param keys     The array of storage entries to query.
+ * @param values   The output array of storage values. Must have room for @p count items.
+ *                 The value at index i corresponds to the entry keys[i] and is null bytes
+ *                 if the account does not exist.
+ * @param count    The number of items in @p keys and @p values.
+ */
+typedef void (*evmc_get_storage_batch_fn)(struct evmc_host_context* context,
+                                          const evmc_storage_key* keys,
+                                          evmc_bytes32* values,
+                                          size_t count);
+
 /**
  * Get transient storage callback function.
  *
@@ -741,6 +844,204 @@ typedef size_t (*evmc_copy_code_fn)(struct evmc_host_context* context,
                                     uint8_t* buffer_data,
                                     size_t buffer_size);
 
+/**
+ * The read-only view of an account's code provided by the Host.
+ */
+typedef struct evmc_code_view
+{
+    /**
+     * The pointer to the code.
+     *
+     * MAY be NULL if code_size is 0.
+     */
+    const uint8_t* code;
+
+    /** The size of the code. */
+    size_t code_size;
+
+    /**
+     * The hash of the code.
+     *
+     * Follows the rules of ::evmc_get_code_hash_fn: keccak256 of empty data for existing
+     * accounts without code and null bytes for non-existing accounts.
+     */
+    evmc_bytes32 code_hash;
+} evmc_code_view;
+
+/**
+ * Get code view callback function.
+ *
+ * This callback function is used by a VM to access the code of the given account
+ * without copying it (e.g. for EXTCODECOPY or to execute it in DELEGATECALL).
+ * It replaces a sequence of ::evmc_get_code_size_fn, ::evmc_get_code_hash_fn
+ * and ::evmc_copy_code_fn calls.
+ *
+ * The code referenced by the view MUST stay valid and unchanged until the VM execution
+ * which has requested it (the ::evmc_execute_fn call) returns.
+ *
+ * This callback is optional and MAY be NULL. The Host MAY also decline to provide
+ * the view for any account by returning false. In both cases the VM MUST fall back to
+ * evmc_host_interface::copy_code.
+ *
+ * @param context  The pointer to the Host execution context.
+ * @param address  The address of the account.
+ * @param view     The pointer to the view to be filled by the Host.
+ * @return         true if the view has been provided, false otherwise.
+ */
+typedef bool (*evmc_get_code_view_fn)(struct evmc_host_context* context,
+                                      const evmc_address* address,
+                                      evmc_code_view* view);
+
+/**
+ * Allocate output callback function.
+ *
+ * This callback function is used by a VM to place the output of the execution
+ * (RETURN or REVERT data) in memory owned by the Host (e.g. an arena reset after every
+ * transaction) instead of allocating a buffer released with evmc_result::release().
+ *
+ * The memory MUST stay valid at least until the Host has finished using the ::evmc_result
+ * of the execution (the ::evmc_execute_fn call) which has requested it. The VM MUST NOT free
+ * it. The ::evmc_result having the output in this memory SHOULD have evmc_result::release
+ * set to NULL, so releasing such result is a no-op.
+ *
+ * This callback is optional and MAY be NULL. The Host MAY also decline to provide
+ * the memory by returning NULL. In both cases the VM MUST allocate the output by itself.
+ *
+ * @param context  The pointer to the Host execution context.
+ * @param size     The size of the output in bytes. Greater than 0.
+ * @return         The pointer to the writable memory of the requested size or NULL.
+ */
+typedef uint8_t* (*evmc_allocate_output_fn)(struct evmc_host_context* context, size_t size);
+
+/**
+ * The opaque type representing the tracer context.
+ *
+ * The Host provides it in evmc_tracer::context and the VM passes it back
+ * to every tracer callback. The VM MUST NOT dereference the pointer.
+ */
+struct evmc_tracer_context;
+
+/**
+ * The callback invoked by the VM when it starts the execution of a message.
+ *
+ * @param context  The tracer context.
+ * @param msg      The message being executed.
+ */
+typedef void (*evmc_trace_call_start_fn)(struct evmc_tracer_context* context,
+                                         const struct evmc_message* msg);
+
+/**
+ * The callback invoked by the VM before executing each instruction.
+ *
+ * @param context       The tracer context.
+ * @param depth         The call depth of the execution, see evmc_message::depth.
+ * @param pc            The code offset of the instruction.
+ * @param opcode        The instruction opcode.
+ * @param gas_left      The gas left before executing the instruction.
+ * @param stack_height  The number of the EVM stack items.
+ * @param stack_top     The pointer to the top EVM stack item. NULL if the stack is empty.
+ *                      Valid only for the duration of the callback.
+ */
+typedef void (*evmc_trace_step_fn)(struct evmc_tracer_context* context,
+                                   int32_t depth,
+                                   uint32_t pc,
+                                   uint8_t opcode,
+                                   int64_t gas_left,
+                                   uint32_t stack_height,
+                                   const evmc_uint256be* stack_top);
+
+/**
+ * The callback invoked by the VM when it modifies the storage of an account.
+ *
+ * @param context  The tracer context.
+ * @param depth    The call depth of the execution, see evmc_message::depth.
+ * @param address  The address of the account.
+ * @param key      The storage key.
+ * @param value    The new storage value.
+ */
+typedef void (*evmc_trace_storage_fn)(struct evmc_tracer_context* context,
+                                      int32_t depth,
+                                      const evmc_address* address,
+                                      const evmc_bytes32* key,
+                                      const evmc_bytes32* value);
+
+/**
+ * The callback invoked by the VM when it finishes the execution of a message.
+ *
+ * @param context  The tracer context.
+ * @param depth    The call depth of the execution, see evmc_message::depth.
+ * @param result   The execution result. Valid only for the duration of the callback.
+ */
+typedef void (*evmc_trace_call_end_fn)(struct evmc_tracer_context* context,
+                                       int32_t depth,
+                                       const struct evmc_result* result);
+
+/**
+ * The execution tracer.
+ *
+ * The set of callbacks a Host provides to a VM with evmc_host_interface::get_tracer to observe
+ * the execution. Every callback is optional and MAY be NULL, so tracers interested only in
+ * some of the events do not pay for the others.
+ */
+struct evmc_tracer
+{
+    /** The tracer context passed to the callbacks. */
+    struct evmc_tracer_context* context;
+
+    /** The callback of the message execution start. MAY be NULL. */
+    evmc_trace_call_start_fn on_call_start;
+
+    /** The callback of the instruction execution. MAY be NULL. */
+    evmc_trace_step_fn on_step;
+
+    /** The callback of the storage modification. MAY be NULL. */
+    evmc_trace_storage_fn on_storage;
+
+    /** The callback of the message execution end. MAY be NULL. */
+    evmc_trace_call_end_fn on_call_end;
+};
+
+/**
+ * Get tracer callback function.
+ *
+ * This callback function is used by a VM to obtain the execution tracer of the Host.
+ * The VM SHOULD query it once at the start of the execution and report the events of this
+ * execution to the tracer. The tracer MUST remain valid for the duration of the execution.
+ * Because the Host provides the tracer per execution context, executions running concurrently
+ * in other contexts are not affected.
+ *
+ * This callback is optional and MAY be NULL. The Host MAY also return NULL if the execution
+ * is not traced.
+ *
+ * @param context  The pointer to the Host execution context.
+ * @return         The pointer to the tracer or NULL.
+ */
+typedef const struct evmc_tracer* (*evmc_get_tracer_fn)(struct evmc_host_context* context);
+
+/**
+ * Get transaction initcode callback function.
+ *
+ * This callback function is used by a VM to find the transaction initcode by its hash
+ * (e.g. for the TXCREATE instruction) instead of searching the evmc_tx_context::initcodes
+ * array linearly. The Host SHOULD index the initcodes once per transaction
+ * (e.g. with evmc::TxInitcodeIndex), so the cost of the lookup does not grow with the number
+ * of the initcodes.
+ *
+ * The returned initcode MUST stay valid as long as the evmc_tx_context::initcodes array
+ * of the transaction. If the array contains multiple initcodes of the same hash,
+ * the first one is returned.
+ *
+ * This callback is optional and MAY be NULL. In this case the VM MUST search
+ * the evmc_tx_context::initcodes array.
+ *
+ * @param context  The pointer to the Host execution context.
+ * @param hash     The hash of the initcode.
+ * @return         The pointer to the initcode or NULL if the transaction has no initcode
+ *                 of this hash.
+ */
+typedef const evmc_tx_initcode* (*evmc_get_tx_initcode_fn)(struct evmc_host_context* context,
+                                                           const evmc_bytes32* hash);
+
 /**
  * Selfdestruct callback function.
  *
@@ -890,6 +1191,41 @@ struct evmc_host_interface
 
     /** Set transient storage callback function. */
     evmc_set_transient_storage_fn set_transient_storage;
+
+    /**
+     * Get storage batch callback function.
+     *
+     * Optional, MAY be NULL.
+     */
+    evmc_get_storage_batch_fn get_storage_batch;
+
+    /**
+     * Get code view callback function.
+     *
+     * Optional, MAY be NULL.
+     */
+    evmc_get_code_view_fn get_code_view;
+
+    /**
+     * Allocate output callback function.
+     *
+     * Optional, MAY be NULL.
+     */
+    evmc_allocate_output_fn allocate_output;
+
+    /**
+     * Get tracer callback function.
+     *
+     * Optional, MAY be NULL.
+     */
+    evmc_get_tracer_fn get_tracer;
+
+    /**
+     * Get transaction initcode callback function.
+     *
+     * Optional, MAY be NULL.
+     */
+    evmc_get_tx_initcode_fn get_tx_initcode;
 };
 
 
@@ -1084,6 +1420,58 @@ typedef struct evmc_result (*evmc_execute_fn)(struct evmc_vm* vm,
                                               uint8_t const* code,
                                               size_t code_size);
 
+/**
+ * The execution request of a batch.
+ *
+ * Describes a single execution as the ::evmc_execute_fn arguments do.
+ */
+struct evmc_execution_request
+{
+    /** The requested EVM specification revision. */
+    enum evmc_revision rev;
+
+    /** The call parameters. MUST NOT be NULL. */
+    const struct evmc_message* msg;
+
+    /** The reference to the code to be executed. MAY be NULL. */
+    const uint8_t* code;
+
+    /** The length of the code. If evmc_execution_request::code is NULL this MUST be 0. */
+    size_t code_size;
+};
+
+/**
+ * Executes the batch of requests within the single Host context.
+ *
+ * The requests are executed in order and the result is equivalent to executing every request
+ * with ::evmc_execute_fn one after another. This allows the Client to cross the language
+ * boundary once for many executions (e.g. all transactions of a block) and gives the VM
+ * the opportunity to prepare the execution of the following requests (e.g. analyse their code)
+ * in advance.
+ *
+ * @param vm        The VM instance. This argument MUST NOT be NULL.
+ * @param host      The Host interface. See ::evmc_execute_fn.
+ * @param context   The opaque pointer to the Host execution context. See ::evmc_execute_fn.
+ * @param requests  The array of the execution requests.
+ * @param count     The number of the execution requests.
+ * @param results   The output array of the results of the requests. MUST have space for
+ *                  @p count results. The Client MUST release every result.
+ */
+typedef void (*evmc_execute_batch_fn)(struct evmc_vm* vm,
+                                      const struct evmc_host_interface* host,
+                                      struct evmc_host_context* context,
+                                      const struct evmc_execution_request* requests,
+                                      size_t count,
+                                      struct evmc_result* results);
+
+/**
+ * Releases the code analysis created by the VM instance.
+ *
+ * @param vm        The VM instance which has created the analysis.
+ * @param analysis  The evmc_code_analysis_slot::analysis value. Not NULL.
+ */
+typedef void (*evmc_release_code_analysis_fn)(struct evmc_vm* vm, void* analysis);
+
 /**
  * Possible capabilities of a VM.
  */
@@ -1135,6 +1523,10 @@ typedef evmc_capabilities_flagset (*evmc_get_capabilities_fn)(struct evmc_vm* vm
  * The VM instance.
  *
  * Defines the base struct of the VM implementation.
+ *
+ * On 64-bit platforms the struct is 72 bytes, so it spans two 64-byte cache lines.
+ * All fields except the optional evmc_vm::execute_batch fit in the first cache line,
+ * and execute_batch is read only once per batch of executions.
  */
 struct evmc_vm
 {
@@ -1194,6 +1586,22 @@ struct evmc_vm
      * If the VM does not support this feature the pointer can be NULL.
      */
     evmc_set_option_fn set_option;
+
+    /**
+     * Optional pointer to function releasing the code analysis (see ::evmc_code_analysis_slot).
+     *
+     * If the VM does not use the evmc_message::code_analysis slots the pointer can be NULL.
+     * Such VM MUST NOT modify the slots.
+     */
+    evmc_release_code_analysis_fn release_code_analysis;
+
+    /**
+     * Optional pointer to function executing the batch of requests.
+     *
+     * If the VM does not provide it the pointer can be NULL,
+     * in which case evmc_execute_batch() executes the requests one by one.
+     */
+    evmc_execute_batch_fn execute_batch;
 };
 
 /* END Python CFFI declarations */
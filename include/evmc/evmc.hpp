@@ -7,11 +7,15 @@
 #include <evmc/helpers.h>
 #include <evmc/hex.hpp>
 
+#include <algorithm>
+#include <forward_list>
 #include <functional>
 #include <initializer_list>
 #include <ostream>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 static_assert(EVMC_LATEST_STABLE_REVISION <= EVMC_MAX_REVISION,
               "latest stable revision ill-defined");
@@ -165,8 +169,46 @@ inline constexpr uint64_t fnv1a_by64(uint64_t h, uint64_t x) noexcept
     return (h ^ x) * prime;
 }
 }  // namespace fnv
+}  // namespace evmc
+
 
+namespace std
+{
+/// Hash operator template specialization for evmc::address. Needed for unordered containers.
+template <>
+struct hash<evmc::address>
+{
+    /// Hash operator using FNV1a-based folding.
+    constexpr size_t operator()(const evmc::address& s) const noexcept
+    {
+        using namespace evmc;
+        using namespace fnv;
+        return static_cast<size_t>(fnv1a_by64(
+            fnv1a_by64(fnv1a_by64(fnv::offset_basis, load64le(&s.bytes[0])), load64le(&s.bytes[8])),
+            load32le(&s.bytes[16])));
+    }
+};
 
+/// Hash operator template specialization for evmc::bytes32. Needed for unordered containers.
+template <>
+struct hash<evmc::bytes32>
+{
+    /// Hash operator using FNV1a-based folding.
+    constexpr size_t operator()(const evmc::bytes32& s) const noexcept
+    {
+        using namespace evmc;
+        using namespace fnv;
+        return static_cast<size_t>(
+            fnv1a_by64(fnv1a_by64(fnv1a_by64(fnv1a_by64(fnv::offset_basis, load64le(&s.bytes[0])),
+                                             load64le(&s.bytes[8])),
+                                  load64le(&s.bytes[16])),
+                       load64le(&s.bytes[24])));
+    }
+};
+}  // namespace std
+
+namespace evmc
+{
 /// The "equal to" comparison operator for the evmc::address type.
 inline constexpr bool operator==(const address& a, const address& b) noexcept
 {
@@ -276,6 +318,34 @@ inline constexpr bytes32::operator bool() const noexcept
     return !is_zero(*this);
 }
 
+/// The account storage slot: the account address and the storage key.
+struct StorageSlot
+{
+    /// The address of the account.
+    address addr;
+
+    /// The storage key.
+    bytes32 key;
+};
+
+/// Equal operator.
+inline constexpr bool operator==(const StorageSlot& a, const StorageSlot& b) noexcept
+{
+    return a.addr == b.addr && a.key == b.key;
+}
+
+/// Not-equal operator.
+inline constexpr bool operator!=(const StorageSlot& a, const StorageSlot& b) noexcept
+{
+    return !(a == b);
+}
+
+/// Less-than operator. Orders the slots by the address first, then by the key.
+inline constexpr bool operator<(const StorageSlot& a, const StorageSlot& b) noexcept
+{
+    return a.addr < b.addr || (a.addr == b.addr && a.key < b.key);
+}
+
 namespace literals
 {
 /// Converts a raw literal into value of type T.
@@ -321,6 +391,8 @@ inline const char* to_string(evmc_revision rev) noexcept
 /// Alias for evmc_make_result().
 constexpr auto make_result = evmc_make_result;
 
+class HostInterface;
+
 /// @copydoc evmc_result
 ///
 /// This is a RAII wrapper for evmc_result and objects of this type
@@ -337,7 +409,8 @@ public:
 
     /// Creates the result from the provided arguments.
     ///
-    /// The provided output is copied to memory allocated with malloc()
+    /// The output of at most ::EVMC_INLINE_OUTPUT_MAX_SIZE bytes is stored in the result itself.
+    /// The longer output is copied to memory allocated with malloc()
     /// and the evmc_result::release function is set to one invoking free().
     ///
     /// @param _status_code  The status code.
@@ -351,7 +424,29 @@ public:
                     const uint8_t* _output_data,
                     size_t _output_size) noexcept
       : evmc_result{make_result(_status_code, _gas_left, _gas_refund, _output_data, _output_size)}
-    {}
+    {
+        rebase_inline_output();
+    }
+
+    /// Creates the result with the output placed in the Host memory.
+    ///
+    /// The provided output is copied to memory provided by HostInterface::allocate_output().
+    /// The Host owns this memory so the evmc_result::release function is not set
+    /// and destroying this object is a no-op. If the Host declines to provide the memory
+    /// this behaves as the constructor without the Host.
+    ///
+    /// @param host          The Host.
+    /// @param _status_code  The status code.
+    /// @param _gas_left     The amount of gas left.
+    /// @param _gas_refund   The amount of refunded gas.
+    /// @param _output_data  The pointer to the output.
+    /// @param _output_size  The output size.
+    explicit Result(HostInterface& host,
+                    evmc_status_code _status_code,
+                    int64_t _gas_left,
+                    int64_t _gas_refund,
+                    const uint8_t* _output_data,
+                    size_t _output_size) noexcept;
 
     /// Creates the result without output.
     ///
@@ -382,7 +477,7 @@ public:
     /// Converting constructor from raw evmc_result.
     ///
     /// This object takes ownership of the resources of @p res.
-    explicit Result(const evmc_result& res) noexcept : evmc_result{res} {}
+    explicit Result(const evmc_result& res) noexcept : evmc_result{res} { rebase_inline_output(); }
 
     /// Destructor responsible for automatically releasing attached resources.
     ~Result() noexcept
@@ -395,6 +490,7 @@ public:
     Result(Result&& other) noexcept : evmc_result{other}
     {
         other.release = nullptr;  // Disable releasing of the rvalue object.
+        rebase_inline_output();
     }
 
     /// Move assignment operator.
@@ -408,9 +504,13 @@ public:
         this->~Result();                           // Release this object.
         static_cast<evmc_result&>(*this) = other;  // Copy data.
         other.release = nullptr;                   // Disable releasing of the rvalue object.
+        rebase_inline_output();
         return *this;
     }
 
+    /// Is the output stored in the result itself (see ::EVMC_RESULT_INLINE_OUTPUT).
+    bool has_inline_output() const noexcept { return (flags & EVMC_RESULT_INLINE_OUTPUT) != 0; }
+
     /// Access the result object as a referenced to ::evmc_result.
     evmc_result& raw() noexcept { return *this; }
 
@@ -427,10 +527,84 @@ public:
     /// @return  The copy of this object converted to raw evmc_result.
     evmc_result release_raw() noexcept
     {
-        const auto out = evmc_result{*this};  // Copy data.
-        this->release = nullptr;              // Disable releasing of this object.
+        auto out = evmc_result{*this};  // Copy data.
+        this->release = nullptr;        // Disable releasing of this object.
+        if (has_inline_output())
+            out.output_data = nullptr;  // Do not reference the inline output of this object.
         return out;
     }
+
+private:
+    /// Points the output_data to the inline output of this object, if it has one,
+    /// so the output is accessed the same way as the output in the allocated memory.
+    void rebase_inline_output() noexcept
+    {
+        if (has_inline_output())
+            output_data = inline_output;
+    }
+};
+
+
+/// Finds the transaction initcode by its hash with the linear search
+/// of the evmc_tx_context::initcodes array.
+///
+/// @return  The pointer to the first initcode of the hash or null if not found.
+inline const evmc_tx_initcode* find_tx_initcode(const evmc_tx_context& tx_context,
+                                                const bytes32& hash) noexcept
+{
+    for (size_t i = 0; i < tx_context.initcodes_count; ++i)
+    {
+        if (tx_context.initcodes[i].hash == hash)
+            return &tx_context.initcodes[i];
+    }
+    return nullptr;
+}
+
+/// The index of the transaction initcodes by their hashes.
+///
+/// The Host builds it once per transaction from the evmc_tx_context::initcodes array
+/// to implement HostInterface::get_tx_initcode(). The lookup is the binary search
+/// of the initcodes sorted by their hashes, so TXCREATE does not scan all the initcodes
+/// of the transaction. The index references the array, which must outlive it.
+class TxInitcodeIndex
+{
+    /// The pointers to the initcodes sorted by the hash, stable for equal hashes.
+    std::vector<const evmc_tx_initcode*> m_sorted;
+
+public:
+    /// Creates the empty index.
+    TxInitcodeIndex() noexcept = default;
+
+    /// Creates the index of the initcodes array.
+    explicit TxInitcodeIndex(const evmc_tx_initcode* initcodes, size_t count)
+    {
+        m_sorted.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            m_sorted.push_back(&initcodes[i]);
+        std::stable_sort(m_sorted.begin(), m_sorted.end(), [](const auto* a, const auto* b) {
+            return bytes32{a->hash} < bytes32{b->hash};
+        });
+    }
+
+    /// Creates the index of the initcodes of the transaction.
+    explicit TxInitcodeIndex(const evmc_tx_context& tx_context)
+      : TxInitcodeIndex{tx_context.initcodes, tx_context.initcodes_count}
+    {}
+
+    /// The number of the indexed initcodes.
+    size_t size() const noexcept { return m_sorted.size(); }
+
+    /// Finds the initcode by its hash.
+    ///
+    /// @return  The pointer to the first initcode of the hash in the indexed array
+    ///          or null if not found.
+    const evmc_tx_initcode* find(const bytes32& hash) const noexcept
+    {
+        const auto it = std::lower_bound(
+            m_sorted.begin(), m_sorted.end(), hash,
+            [](const evmc_tx_initcode* a, const bytes32& h) { return bytes32{a->hash} < h; });
+        return it != m_sorted.end() && (*it)->hash == hash ? *it : nullptr;
+    }
 };
 
 
@@ -499,8 +673,66 @@ public:
     virtual void set_transient_storage(const address& addr,
                                        const bytes32& key,
                                        const bytes32& value) noexcept = 0;
+
+    /// @copydoc evmc_host_interface::get_storage_batch
+    ///
+    /// The default implementation queries the entries one by one with get_storage().
+    virtual void get_storage_batch(const evmc_storage_key keys[],
+                                   bytes32 values[],
+                                   size_t count) const noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+            values[i] = get_storage(keys[i].address, keys[i].key);
+    }
+
+    /// @copydoc evmc_host_interface::get_code_view
+    ///
+    /// The default implementation declines to provide the view.
+    virtual bool get_code_view(const address& /*addr*/, evmc_code_view& /*view*/) const noexcept
+    {
+        return false;
+    }
+
+    /// @copydoc evmc_host_interface::allocate_output
+    ///
+    /// The default implementation declines to provide the memory.
+    virtual uint8_t* allocate_output(size_t /*size*/) noexcept { return nullptr; }
+
+    /// @copydoc evmc_host_interface::get_tracer
+    ///
+    /// The default implementation does not trace the execution.
+    virtual const evmc_tracer* get_tracer() noexcept { return nullptr; }
+
+    /// @copydoc evmc_host_interface::get_tx_initcode
+    ///
+    /// The default implementation searches the initcodes of get_tx_context() linearly.
+    virtual const evmc_tx_initcode* get_tx_initcode(const bytes32& hash) const noexcept
+    {
+        return find_tx_initcode(get_tx_context(), hash);
+    }
 };
 
+inline Result::Result(HostInterface& host,
+                      evmc_status_code _status_code,
+                      int64_t _gas_left,
+                      int64_t _gas_refund,
+                      const uint8_t* _output_data,
+                      size_t _output_size) noexcept
+  : Result{_status_code, _gas_left, _gas_refund}
+{
+    if (_output_size == 0)
+        return;
+
+    if (auto* const buffer = host.allocate_output(_output_size); buffer != nullptr)
+    {
+        std::copy_n(_output_data, _output_size, buffer);
+        output_data = buffer;
+        output_size = _output_size;
+    }
+    else
+        *this = Result{_status_code, _gas_left, _gas_refund, _output_data, _output_size};
+}
+
 
 /// Wrapper around EVMC host context / host interface.
 ///
@@ -510,6 +742,26 @@ class HostContext : public HostInterface
     const evmc_host_interface* host = nullptr;
     evmc_host_context* context = nullptr;
 
+    /// The copy of the account code backing the views provided by get_code_view().
+    struct CodeCopy
+    {
+        bytes32 code_hash;  ///< The code hash reported by the Host when the copy was made.
+        bytes code;         ///< The copied code.
+    };
+
+    /// The copies of the account codes backing the views provided by get_code_view()
+    /// when the Host does not provide them, the latest copy of each account first.
+    /// The code is copied again when its hash or size changes, e.g. after CREATE2
+    /// at a selfdestructed address. The older copies are kept and the list nodes never move,
+    /// so the views stay valid for the lifetime of the HostContext.
+    mutable std::unordered_map<address, std::forward_list<CodeCopy>> code_copies;
+
+    /// The transaction context cached by the first get_tx_context().
+    mutable evmc_tx_context tx_context = {};
+
+    /// Whether the tx_context has been fetched from the Host.
+    mutable bool tx_context_cached = false;
+
 public:
     /// Default constructor for null Host context.
     HostContext() = default;
@@ -572,7 +824,21 @@ public:
     }
 
     /// @copydoc HostInterface::get_tx_context()
-    evmc_tx_context get_tx_context() const noexcept final { return host->get_tx_context(context); }
+    ///
+    /// The transaction context is constant during an execution, so it is fetched from the Host
+    /// only once and the cached copy is returned by the subsequent calls. A HostContext
+    /// is created per execution, so the cache is per call frame: each nested CALL or CREATE
+    /// is started by the Host as a separate execution and fetches the context again.
+    /// The VM cannot tell which nested executions belong to the same transaction.
+    evmc_tx_context get_tx_context() const noexcept final
+    {
+        if (!tx_context_cached)
+        {
+            tx_context = host->get_tx_context(context);
+            tx_context_cached = true;
+        }
+        return tx_context;
+    }
 
     bytes32 get_block_hash(int64_t number) const noexcept final
     {
@@ -609,6 +875,73 @@ public:
     {
         host->set_transient_storage(context, &address, &key, &value);
     }
+
+    /// @copydoc HostInterface::get_storage_batch()
+    ///
+    /// Falls back to a get_storage() loop if the Host does not provide the batched callback.
+    void get_storage_batch(const evmc_storage_key keys[],
+                           bytes32 values[],
+                           size_t count) const noexcept final
+    {
+        if (host->get_storage_batch != nullptr)
+            return host->get_storage_batch(context, keys, values, count);
+        for (size_t i = 0; i < count; ++i)
+            values[i] = host->get_storage(context, &keys[i].address, &keys[i].key);
+    }
+
+    /// @copydoc HostInterface::get_code_view()
+    ///
+    /// If the Host does not provide the view, the code is copied with copy_code()
+    /// to a buffer owned by this HostContext. Therefore, this never fails and the view stays
+    /// valid at least as long as this HostContext object.
+    bool get_code_view(const address& address, evmc_code_view& view) const noexcept final
+    {
+        if (host->get_code_view != nullptr && host->get_code_view(context, &address, &view))
+            return true;
+
+        const auto code_hash = host->get_code_hash(context, &address);
+        const auto code_size = host->get_code_size(context, &address);
+        auto& copies = code_copies[address];
+        if (copies.empty() || copies.front().code_hash != code_hash ||
+            copies.front().code.size() != code_size)
+        {
+            auto& copy = copies.emplace_front(CodeCopy{code_hash, bytes(code_size, 0)}).code;
+            copy.resize(host->copy_code(context, &address, 0, copy.data(), copy.size()));
+        }
+
+        const auto& code = copies.front().code;
+        view.code = code.data();
+        view.code_size = code.size();
+        view.code_hash = code_hash;
+        return true;
+    }
+
+    /// @copydoc HostInterface::allocate_output()
+    ///
+    /// Returns null if the Host does not provide the callback.
+    uint8_t* allocate_output(size_t size) noexcept final
+    {
+        return host->allocate_output != nullptr ? host->allocate_output(context, size) : nullptr;
+    }
+
+    /// @copydoc HostInterface::get_tracer()
+    ///
+    /// Returns null if the Host does not provide the callback.
+    const evmc_tracer* get_tracer() noexcept final
+    {
+        return host->get_tracer != nullptr ? host->get_tracer(context) : nullptr;
+    }
+
+    /// @copydoc HostInterface::get_tx_initcode()
+    ///
+    /// Searches the initcodes of the cached transaction context linearly
+    /// if the Host does not provide the callback.
+    const evmc_tx_initcode* get_tx_initcode(const bytes32& hash) const noexcept final
+    {
+        if (host->get_tx_initcode != nullptr)
+            return host->get_tx_initcode(context, &hash);
+        return find_tx_initcode(get_tx_context(), hash);
+    }
 };
 
 
@@ -643,6 +976,235 @@ public:
     }
 };
 
+/// The statically dispatched alternative of the evmc::Host base class.
+///
+/// The Host implementation derives from HostCRTP<Derived> and defines the methods
+/// of the same signatures as the evmc::HostInterface, but not virtual.
+/// The ::evmc_host_interface provided by get_interface() consists of the trampolines
+/// calling the Derived methods directly, so there is a single indirect call per Host method
+/// (the C callback) instead of two and the Derived methods can be inlined into the trampolines.
+///
+/// The optional Host methods (get_storage_batch(), get_code_view(), allocate_output(),
+/// get_tracer() and get_tx_initcode()) have the default implementations as
+/// in the evmc::HostInterface, which the Derived class may hide by its own methods.
+///
+/// @tparam Derived  The Host implementation class (the CRTP pattern).
+template <typename Derived>
+class HostCRTP
+{
+public:
+    /// Provides access to the host interface of the Derived class.
+    /// @returns  Reference to the host interface object.
+    static const evmc_host_interface& get_interface() noexcept;
+
+    /// Converts the Host object to the opaque host context pointer.
+    /// @returns  Pointer to evmc_host_context.
+    evmc_host_context* to_context() noexcept
+    {
+        return reinterpret_cast<evmc_host_context*>(static_cast<Derived*>(this));
+    }
+
+    /// Converts the opaque host context pointer back to the Derived object.
+    static Derived* from_context(evmc_host_context* context) noexcept
+    {
+        return reinterpret_cast<Derived*>(context);
+    }
+
+    /// @copydoc HostInterface::get_storage_batch
+    void get_storage_batch(const evmc_storage_key keys[],
+                           bytes32 values[],
+                           size_t count) const noexcept
+    {
+        const auto& self = static_cast<const Derived&>(*this);
+        for (size_t i = 0; i < count; ++i)
+            values[i] = self.get_storage(keys[i].address, keys[i].key);
+    }
+
+    /// @copydoc HostInterface::get_code_view
+    bool get_code_view(const address& /*addr*/, evmc_code_view& /*view*/) const noexcept
+    {
+        return false;
+    }
+
+    /// @copydoc HostInterface::allocate_output
+    uint8_t* allocate_output(size_t /*size*/) noexcept { return nullptr; }
+
+    /// @copydoc HostInterface::get_tracer
+    const evmc_tracer* get_tracer() noexcept { return nullptr; }
+
+    /// @copydoc HostInterface::get_tx_initcode
+    const evmc_tx_initcode* get_tx_initcode(const bytes32& hash) const noexcept
+    {
+        return find_tx_initcode(static_cast<const Derived&>(*this).get_tx_context(), hash);
+    }
+
+private:
+    static bool account_exists(evmc_host_context* h, const evmc_address* addr) noexcept
+    {
+        return from_context(h)->account_exists(*addr);
+    }
+
+    static evmc_bytes32 get_storage(evmc_host_context* h,
+                                    const evmc_address* addr,
+                                    const evmc_bytes32* key) noexcept
+    {
+        return from_context(h)->get_storage(*addr, *key);
+    }
+
+    static evmc_storage_status set_storage(evmc_host_context* h,
+                                           const evmc_address* addr,
+                                           const evmc_bytes32* key,
+                                           const evmc_bytes32* value) noexcept
+    {
+        return from_context(h)->set_storage(*addr, *key, *value);
+    }
+
+    static evmc_uint256be get_balance(evmc_host_context* h, const evmc_address* addr) noexcept
+    {
+        return from_context(h)->get_balance(*addr);
+    }
+
+    static size_t get_code_size(evmc_host_context* h, const evmc_address* addr) noexcept
+    {
+        return from_context(h)->get_code_size(*addr);
+    }
+
+    static evmc_bytes32 get_code_hash(evmc_host_context* h, const evmc_address* addr) noexcept
+    {
+        return from_context(h)->get_code_hash(*addr);
+    }
+
+    static size_t copy_code(evmc_host_context* h,
+                            const evmc_address* addr,
+                            size_t code_offset,
+                            uint8_t* buffer_data,
+                            size_t buffer_size) noexcept
+    {
+        return from_context(h)->copy_code(*addr, code_offset, buffer_data, buffer_size);
+    }
+
+    static bool selfdestruct(evmc_host_context* h,
+                             const evmc_address* addr,
+                             const evmc_address* beneficiary) noexcept
+    {
+        return from_context(h)->selfdestruct(*addr, *beneficiary);
+    }
+
+    static evmc_result call(evmc_host_context* h, const evmc_message* msg) noexcept
+    {
+        return from_context(h)->call(*msg).release_raw();
+    }
+
+    static evmc_tx_context get_tx_context(evmc_host_context* h) noexcept
+    {
+        return from_context(h)->get_tx_context();
+    }
+
+    static evmc_bytes32 get_block_hash(evmc_host_context* h, int64_t block_number) noexcept
+    {
+        return from_context(h)->get_block_hash(block_number);
+    }
+
+    static void emit_log(evmc_host_context* h,
+                         const evmc_address* addr,
+                         const uint8_t* data,
+                         size_t data_size,
+                         const evmc_bytes32 topics[],
+                         size_t num_topics) noexcept
+    {
+        from_context(h)->emit_log(*addr, data, data_size, static_cast<const bytes32*>(topics),
+                                  num_topics);
+    }
+
+    static evmc_access_status access_account(evmc_host_context* h,
+                                             const evmc_address* addr) noexcept
+    {
+        return from_context(h)->access_account(*addr);
+    }
+
+    static evmc_access_status access_storage(evmc_host_context* h,
+                                             const evmc_address* addr,
+                                             const evmc_bytes32* key) noexcept
+    {
+        return from_context(h)->access_storage(*addr, *key);
+    }
+
+    static evmc_bytes32 get_transient_storage(evmc_host_context* h,
+                                              const evmc_address* addr,
+                                              const evmc_bytes32* key) noexcept
+    {
+        return from_context(h)->get_transient_storage(*addr, *key);
+    }
+
+    static void set_transient_storage(evmc_host_context* h,
+                                      const evmc_address* addr,
+                                      const evmc_bytes32* key,
+                                      const evmc_bytes32* value) noexcept
+    {
+        from_context(h)->set_transient_storage(*addr, *key, *value);
+    }
+
+    static void get_storage_batch(evmc_host_context* h,
+                                  const evmc_storage_key* keys,
+                                  evmc_bytes32* values,
+                                  size_t count) noexcept
+    {
+        from_context(h)->get_storage_batch(keys, static_cast<bytes32*>(values), count);
+    }
+
+    static bool get_code_view(evmc_host_context* h,
+                              const evmc_address* addr,
+                              evmc_code_view* view) noexcept
+    {
+        return from_context(h)->get_code_view(*addr, *view);
+    }
+
+    static uint8_t* allocate_output(evmc_host_context* h, size_t size) noexcept
+    {
+        return from_context(h)->allocate_output(size);
+    }
+
+    static const evmc_tracer* get_tracer(evmc_host_context* h) noexcept
+    {
+        return from_context(h)->get_tracer();
+    }
+
+    static const evmc_tx_initcode* get_tx_initcode(evmc_host_context* h,
+                                                   const evmc_bytes32* hash) noexcept
+    {
+        return from_context(h)->get_tx_initcode(*hash);
+    }
+};
+
+template <typename Derived>
+inline const evmc_host_interface& HostCRTP<Derived>::get_interface() noexcept
+{
+    static constexpr evmc_host_interface interface = {
+        &HostCRTP::account_exists,
+        &HostCRTP::get_storage,
+        &HostCRTP::set_storage,
+        &HostCRTP::get_balance,
+        &HostCRTP::get_code_size,
+        &HostCRTP::get_code_hash,
+        &HostCRTP::copy_code,
+        &HostCRTP::selfdestruct,
+        &HostCRTP::call,
+        &HostCRTP::get_tx_context,
+        &HostCRTP::get_block_hash,
+        &HostCRTP::emit_log,
+        &HostCRTP::access_account,
+        &HostCRTP::access_storage,
+        &HostCRTP::get_transient_storage,
+        &HostCRTP::set_transient_storage,
+        &HostCRTP::get_storage_batch,
+        &HostCRTP::get_code_view,
+        &HostCRTP::allocate_output,
+        &HostCRTP::get_tracer,
+        &HostCRTP::get_tx_initcode,
+    };
+    return interface;
+}
+
 
 /// @copybrief evmc_vm
 ///
@@ -734,6 +1296,19 @@ public:
         return execute(Host::get_interface(), host.to_context(), rev, msg, code, code_size);
     }
 
+    /// Convenient variant of the VM::execute() that takes reference to the Host
+    /// derived from evmc::HostCRTP.
+    template <typename Derived>
+    Result execute(HostCRTP<Derived>& host,
+                   evmc_revision rev,
+                   const evmc_message& msg,
+                   const uint8_t* code,
+                   size_t code_size) noexcept
+    {
+        return execute(HostCRTP<Derived>::get_interface(), host.to_context(), rev, msg, code,
+                       code_size);
+    }
+
     /// Executes code without the Host context.
     ///
     /// The same as
@@ -751,6 +1326,50 @@ public:
             m_instance->execute(m_instance, nullptr, nullptr, rev, &msg, code, code_size)};
     }
 
+    /// @copydoc evmc_release_code_analysis()
+    void release_code_analysis(evmc_code_analysis_slot& slot) noexcept
+    {
+        evmc_release_code_analysis(m_instance, &slot);
+    }
+
+    /// Executes the batch of requests within the single Host context.
+    ///
+    /// Falls back to executing the requests one by one if the VM does not support batches.
+    /// @see evmc_execute_batch().
+    std::vector<Result> execute_batch(const evmc_host_interface& host,
+                                      evmc_host_context* ctx,
+                                      const evmc_execution_request* requests,
+                                      size_t count)
+    {
+        // Allocate everything up front so that no result is leaked if the allocation fails.
+        std::vector<Result> results;
+        results.reserve(count);
+        std::vector<evmc_result> raw_results(count);
+        evmc_execute_batch(m_instance, &host, ctx, requests, count, raw_results.data());
+
+        for (const auto& r : raw_results)
+            results.emplace_back(r);
+        return results;
+    }
+
+    /// Convenient variant of the VM::execute_batch() that takes reference to evmc::Host.
+    std::vector<Result> execute_batch(Host& host,
+                                      const std::vector<evmc_execution_request>& requests)
+    {
+        return execute_batch(Host::get_interface(), host.to_context(), requests.data(),
+                             requests.size());
+    }
+
+    /// Convenient variant of the VM::execute_batch() that takes reference to the Host
+    /// derived from evmc::HostCRTP.
+    template <typename Derived>
+    std::vector<Result> execute_batch(HostCRTP<Derived>& host,
+                                      const std::vector<evmc_execution_request>& requests)
+    {
+        return execute_batch(HostCRTP<Derived>::get_interface(), host.to_context(),
+                             requests.data(), requests.size());
+    }
+
     /// Returns the pointer to C EVMC struct representing the VM.
     ///
     /// Gives access to the C EVMC VM struct to allow advanced interaction with the VM not supported
@@ -877,6 +1496,37 @@ inline void set_transient_storage(evmc_host_context* h,
 {
     Host::from_context(h)->set_transient_storage(*addr, *key, *value);
 }
+
+inline bool get_code_view(evmc_host_context* h,
+                          const evmc_address* addr,
+                          evmc_code_view* view) noexcept
+{
+    return Host::from_context(h)->get_code_view(*addr, *view);
+}
+
+inline void get_storage_batch(evmc_host_context* h,
+                              const evmc_storage_key* keys,
+                              evmc_bytes32* values,
+                              size_t count) noexcept
+{
+    Host::from_context(h)->get_storage_batch(keys, static_cast<bytes32*>(values), count);
+}
+
+inline uint8_t* allocate_output(evmc_host_context* h, size_t size) noexcept
+{
+    return Host::from_context(h)->allocate_output(size);
+}
+
+inline const evmc_tracer* get_tracer(evmc_host_context* h) noexcept
+{
+    return Host::from_context(h)->get_tracer();
+}
+
+inline const evmc_tx_initcode* get_tx_initcode(evmc_host_context* h,
+                                               const evmc_bytes32* hash) noexcept
+{
+    return Host::from_context(h)->get_tx_initcode(*hash);
+}
 }  // namespace internal
 
 inline const evmc_host_interface& Host::get_interface() noexcept
@@ -898,6 +1548,11 @@ inline const evmc_host_interface& Host::get_interface() noexcept
         ::evmc::internal::access_storage,
         ::evmc::internal::get_transient_storage,
         ::evmc::internal::set_transient_storage,
+        ::evmc::internal::get_storage_batch,
+        ::evmc::internal::get_code_view,
+        ::evmc::internal::allocate_output,
+        ::evmc::internal::get_tracer,
+        ::evmc::internal::get_tx_initcode,
     };
     return interface;
 }
@@ -924,35 +1579,15 @@ inline std::ostream& operator<<(std::ostream& os, evmc_revision rev)
 
 namespace std
 {
-/// Hash operator template specialization for evmc::address. Needed for unordered containers.
-template <>
-struct hash<evmc::address>
-{
-    /// Hash operator using FNV1a-based folding.
-    constexpr size_t operator()(const evmc::address& s) const noexcept
-    {
-        using namespace evmc;
-        using namespace fnv;
-        return static_cast<size_t>(fnv1a_by64(
-            fnv1a_by64(fnv1a_by64(fnv::offset_basis, load64le(&s.bytes[0])), load64le(&s.bytes[8])),
-            load32le(&s.bytes[16])));
-    }
-};
-
-/// Hash operator template specialization for evmc::bytes32. Needed for unordered containers.
+/// Hash operator template specialization for evmc::StorageSlot. Needed for unordered containers.
 template <>
-struct hash<evmc::bytes32>
+struct hash<evmc::StorageSlot>
 {
-    /// Hash operator using FNV1a-based folding.
-    constexpr size_t operator()(const evmc::bytes32& s) const noexcept
+    /// Hash operator combining the hashes of the address and the key.
+    constexpr size_t operator()(const evmc::StorageSlot& s) const noexcept
     {
-        using namespace evmc;
-        using namespace fnv;
-        return static_cast<size_t>(
-            fnv1a_by64(fnv1a_by64(fnv1a_by64(fnv1a_by64(fnv::offset_basis, load64le(&s.bytes[0])),
-                                             load64le(&s.bytes[8])),
-                                  load64le(&s.bytes[16])),
-                       load64le(&s.bytes[24])));
+        return static_cast<size_t>(evmc::fnv::fnv1a_by64(hash<evmc::address>{}(s.addr),
+                                                         hash<evmc::bytes32>{}(s.key)));
     }
 };
 }  // namespace std
@@ -0,0 +1,362 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.hpp>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace evmc
+{
+/// The hash map with open addressing and linear probing.
+///
+/// Entries are kept in a single flat array and an insert does not allocate unless the map grows.
+/// The slot occupancy flags are kept in a separate byte array, because a flag inside the slot
+/// would misalign the 64-byte slots of the evmc::bytes32 keys and values with the cache lines
+/// and no key value can serve as the empty slot marker. A lookup therefore usually touches
+/// a cache line of the slots and a cache line of the flags (covering 64 slots).
+/// This is intended for small, fixed-size keys like evmc::address and evmc::bytes32 and cheap
+/// to move values.
+///
+/// The interface is a subset of std::unordered_map. The main differences:
+/// - any insert may invalidate all iterators, pointers and references to the entries,
+/// - erase may move other entries (invalidates iterators, pointers and references),
+/// - the value_type is std::pair<Key, T> (the key is not const, but must not be modified).
+///
+/// @tparam Key       The key type. Must be default constructible.
+/// @tparam T         The mapped type. Must be default constructible.
+/// @tparam Hash      The hash function. The default std::hash<evmc::bytes32> and
+///                   std::hash<evmc::address> are FNV-1a based. The map keeps an instance,
+///                   so stateful hash functions (e.g. evmc::seeded_hash) are supported.
+/// @tparam KeyEqual  The key equality comparison.
+template <typename Key,
+          typename T,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class flat_hash_map
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    /// The iterator over the occupied slots.
+    template <typename MapT, typename ValueT>
+    class basic_iterator
+    {
+        MapT* m_map = nullptr;
+        size_t m_index = 0;
+
+        void skip_empty() noexcept
+        {
+            while (m_index < m_map->m_used.size() && !m_map->m_used[m_index])
+                ++m_index;
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = flat_hash_map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueT*;
+        using reference = ValueT&;
+
+        basic_iterator() noexcept = default;
+
+        basic_iterator(MapT* map, size_t index) noexcept : m_map{map}, m_index{index}
+        {
+            skip_empty();
+        }
+
+        /// Conversion from iterator to const_iterator.
+        template <typename OtherMapT, typename OtherValueT>
+        basic_iterator(  // NOLINT(hicpp-explicit-conversions)
+            const basic_iterator<OtherMapT, OtherValueT>& other) noexcept
+          : m_map{other.m_map}, m_index{other.m_index}
+        {}
+
+        reference operator*() const noexcept { return m_map->m_slots[m_index]; }
+        pointer operator->() const noexcept { return &m_map->m_slots[m_index]; }
+
+        basic_iterator& operator++() noexcept
+        {
+            ++m_index;
+            skip_empty();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const basic_iterator& other) const noexcept
+        {
+            return m_index == other.m_index;
+        }
+        bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
+
+        template <typename, typename>
+        friend class basic_iterator;
+        friend class flat_hash_map;
+    };
+
+public:
+    using iterator = basic_iterator<flat_hash_map, value_type>;
+    using const_iterator = basic_iterator<const flat_hash_map, const value_type>;
+
+    flat_hash_map() = default;
+
+    /// Constructs the empty map using the given hash function instance.
+    explicit flat_hash_map(const Hash& hash) : m_hash{hash} {}
+
+    /// Constructs the map with the given entries.
+    flat_hash_map(std::initializer_list<value_type> init, const Hash& hash = Hash{})
+      : m_hash{hash}
+    {
+        reserve(init.size());
+        for (const auto& [key, value] : init)
+            (*this)[key] = value;
+    }
+
+    iterator begin() noexcept { return {this, 0}; }
+    iterator end() noexcept { return {this, m_slots.size()}; }
+    const_iterator begin() const noexcept { return {this, 0}; }
+    const_iterator end() const noexcept { return {this, m_slots.size()}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /// Returns true if the map has no entries.
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    /// Returns the number of entries.
+    size_t size() const noexcept { return m_size; }
+
+    /// Returns the number of slots.
+    size_t bucket_count() const noexcept { return m_slots.size(); }
+
+    /// Returns the hash function instance.
+    hasher hash_function() const { return m_hash; }
+
+    /// Removes all entries. The memory is kept for reuse.
+    void clear() noexcept
+    {
+        for (size_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_used[i])
+            {
+                m_slots[i] = value_type{};
+                m_used[i] = false;
+            }
+        }
+        m_size = 0;
+    }
+
+    /// Makes room for at least the given number of entries without growing.
+    void reserve(size_t count)
+    {
+        size_t capacity = min_capacity;
+        while (capacity * max_load_num < count * max_load_den)
+            capacity *= 2;
+        if (capacity > m_slots.size())
+            rehash(capacity);
+    }
+
+    /// Finds the entry with the given key.
+    iterator find(const Key& key) noexcept { return {this, find_index(key)}; }
+
+    /// Finds the entry with the given key.
+    const_iterator find(const Key& key) const noexcept { return {this, find_index(key)}; }
+
+    /// Returns the number of entries with the given key (0 or 1).
+    size_t count(const Key& key) const noexcept { return find_index(key) != m_slots.size(); }
+
+    /// Returns the reference to the value with the given key.
+    /// @throws std::out_of_range  If there is no such entry.
+    T& at(const Key& key)
+    {
+        const auto index = find_index(key);
+        if (index == m_slots.size())
+            throw std::out_of_range{"flat_hash_map::at"};
+        return m_slots[index].second;
+    }
+
+    /// Returns the reference to the value with the given key.
+    /// @throws std::out_of_range  If there is no such entry.
+    const T& at(const Key& key) const
+    {
+        const auto index = find_index(key);
+        if (index == m_slots.size())
+            throw std::out_of_range{"flat_hash_map::at"};
+        return m_slots[index].second;
+    }
+
+    /// Returns the reference to the value with the given key,
+    /// inserting the default constructed value if the key is not present.
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    /// Inserts the value constructed from the arguments if the key is not present.
+    /// @return  The iterator to the entry with the key and the flag if the insert took place.
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        if (const auto index = find_index(key); index != m_slots.size())
+            return {iterator{this, index}, false};
+
+        if ((m_size + 1) * max_load_den > m_slots.size() * max_load_num)
+            rehash(m_slots.empty() ? min_capacity : m_slots.size() * 2);
+
+        auto index = ideal_index(key);
+        while (m_used[index])
+            index = (index + 1) & mask();
+
+        m_slots[index] = value_type{key, T{std::forward<Args>(args)...}};
+        m_used[index] = true;
+        ++m_size;
+        return {iterator{this, index}, true};
+    }
+
+    /// Inserts the entry if the key is not present.
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    /// Inserts the entry if the key is not present.
+    std::pair<iterator, bool> emplace(const Key& key, const T& value)
+    {
+        return try_emplace(key, value);
+    }
+
+    /// Removes the entry with the given key.
+    /// @return  The number of removed entries (0 or 1).
+    size_t erase(const Key& key) noexcept
+    {
+        auto hole = find_index(key);
+        if (hole == m_slots.size())
+            return 0;
+
+        // Backward shift deletion: move the following entries of the probe sequence
+        // into the hole unless they are already at or after their ideal position.
+        for (auto next = (hole + 1) & mask(); m_used[next]; next = (next + 1) & mask())
+        {
+            const auto ideal = ideal_index(m_slots[next].first);
+            const auto in_place = (next > hole) ? (ideal > hole && ideal <= next) :
+                                                  (ideal > hole || ideal <= next);
+            if (!in_place)
+            {
+                m_slots[hole] = std::move(m_slots[next]);
+                hole = next;
+            }
+        }
+
+        m_slots[hole] = value_type{};
+        m_used[hole] = false;
+        --m_size;
+        return 1;
+    }
+
+    /// Equal operator. The maps are equal if they contain the same set of entries.
+    friend bool operator==(const flat_hash_map& a, const flat_hash_map& b) noexcept
+    {
+        if (a.size() != b.size())
+            return false;
+        for (const auto& [key, value] : a)
+        {
+            const auto it = b.find(key);
+            if (it == b.end() || !(it->second == value))
+                return false;
+        }
+        return true;
+    }
+
+    /// Not-equal operator.
+    friend bool operator!=(const flat_hash_map& a, const flat_hash_map& b) noexcept
+    {
+        return !(a == b);
+    }
+
+private:
+    /// The smallest number of slots allocated.
+    static constexpr size_t min_capacity = 8;
+
+    /// The maximum load factor as a fraction: 3/4.
+    static constexpr size_t max_load_num = 3;
+    static constexpr size_t max_load_den = 4;
+
+    /// The slots. The size is always a power of 2.
+    std::vector<value_type> m_slots;
+
+    /// The slot occupancy flags.
+    std::vector<uint8_t> m_used;
+
+    /// The number of entries.
+    size_t m_size = 0;
+
+    /// The hash function instance.
+    Hash m_hash;
+
+    /// The shift selecting the top log2(number of slots) bits of the scrambled hash.
+    unsigned m_shift = 64;
+
+    size_t mask() const noexcept { return m_slots.size() - 1; }
+
+    /// Returns the first slot of the probe sequence of the key.
+    /// The hash is scrambled by the Fibonacci multiplicative hashing to spread weak hash bits.
+    size_t ideal_index(const Key& key) const noexcept
+    {
+        const auto h = static_cast<uint64_t>(m_hash(key)) * 0x9e3779b97f4a7c15;
+        return static_cast<size_t>(h >> m_shift);
+    }
+
+    /// Returns the slot index of the key or the number of slots if not found.
+    size_t find_index(const Key& key) const noexcept
+    {
+        if (m_size == 0)
+            return m_slots.size();
+
+        for (auto index = ideal_index(key); m_used[index]; index = (index + 1) & mask())
+        {
+            if (KeyEqual{}(m_slots[index].first, key))
+                return index;
+        }
+        return m_slots.size();
+    }
+
+    /// Moves all the entries to the new array of slots of the given size.
+    void rehash(size_t capacity)
+    {
+        auto old_slots = std::move(m_slots);
+        auto old_used = std::move(m_used);
+        m_slots = std::vector<value_type>(capacity);
+        m_used = std::vector<uint8_t>(capacity);
+        m_shift = 64;
+        for (auto c = capacity; c > 1; c /= 2)
+            --m_shift;
+
+        for (size_t i = 0; i < old_slots.size(); ++i)
+        {
+            if (!old_used[i])
+                continue;
+            auto index = ideal_index(old_slots[i].first);
+            while (m_used[index])
+                index = (index + 1) & mask();
+            m_slots[index] = std::move(old_slots[i]);
+            m_used[index] = true;
+        }
+    }
+};
+}  // namespace evmc
@@ -100,6 +100,46 @@ static inline struct evmc_result evmc_execute(struct evmc_vm* vm,
     return vm->execute(vm, host, context, rev, msg, code, code_size);
 }
 
+/**
+ * Releases the code analysis kept in the slot, if any, and resets the slot.
+ *
+ * @see evmc_code_analysis_slot, evmc_release_code_analysis_fn.
+ */
+static inline void evmc_release_code_analysis(struct evmc_vm* vm,
+                                              struct evmc_code_analysis_slot* slot)
+{
+    if (slot->analysis != NULL && vm->release_code_analysis != NULL)
+        vm->release_code_analysis(vm, slot->analysis);
+    slot->analysis = NULL;
+}
+
+/**
+ * Executes the batch of requests in the VM instance.
+ *
+ * Uses evmc_vm::execute_batch if provided. Otherwise, executes the requests one by one.
+ *
+ * @see evmc_execute_batch_fn.
+ */
+static inline void evmc_execute_batch(struct evmc_vm* vm,
+                                      const struct evmc_host_interface* host,
+                                      struct evmc_host_context* context,
+                                      const struct evmc_execution_request* requests,
+                                      size_t count,
+                                      struct evmc_result* results)
+{
+    if (vm->execute_batch != NULL)
+    {
+        vm->execute_batch(vm, host, context, requests, count, results);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const struct evmc_execution_request* r = &requests[i];
+        results[i] = vm->execute(vm, host, context, r->rev, r->msg, r->code, r->code_size);
+    }
+}
+
 /// The evmc_result release function using free() for releasing the memory.
 ///
 /// This function is used in the evmc_make_result(),
@@ -113,7 +153,9 @@ static void evmc_free_result_memory(const struct evmc_result* result)
 
 /// Creates the result from the provided arguments.
 ///
-/// The provided output is copied to memory allocated with malloc()
+/// The output of at most ::EVMC_INLINE_OUTPUT_MAX_SIZE bytes is copied to
+/// evmc_result::inline_output and the evmc_result::release function is not set.
+/// The longer output is copied to memory allocated with malloc()
 /// and the evmc_result::release function is set to one invoking free().
 ///
 /// In case of memory allocation failure, the result has all fields zeroed
@@ -133,7 +175,13 @@ static inline struct evmc_result evmc_make_result(enum evmc_status_code status_c
     struct evmc_result result;
     memset(&result, 0, sizeof(result));
 
-    if (output_size != 0)
+    if (output_size != 0 && output_size <= EVMC_INLINE_OUTPUT_MAX_SIZE)
+    {
+        memcpy(result.inline_output, output_data, output_size);
+        result.output_size = output_size;
+        result.flags = EVMC_RESULT_INLINE_OUTPUT;
+    }
+    else if (output_size != 0)
     {
         uint8_t* buffer = (uint8_t*)malloc(output_size);
 
@@ -155,6 +203,60 @@ static inline struct evmc_result evmc_make_result(enum evmc_status_code status_c
     return result;
 }
 
+/// Creates the result from the provided arguments with the output placed in the Host memory.
+///
+/// The provided output is copied to memory allocated with evmc_host_interface::allocate_output()
+/// and the evmc_result::release function is set to NULL as the Host owns this memory.
+/// If the Host does not provide the allocate_output() callback or declines the allocation
+/// this falls back to evmc_make_result().
+///
+/// @param host         The Host interface. MAY be NULL.
+/// @param context      The Host execution context.
+/// @param status_code  The status code.
+/// @param gas_left     The amount of gas left.
+/// @param gas_refund   The amount of refunded gas.
+/// @param output_data  The pointer to the output.
+/// @param output_size  The output size.
+static inline struct evmc_result evmc_make_host_output_result(
+    const struct evmc_host_interface* host,
+    struct evmc_host_context* context,
+    enum evmc_status_code status_code,
+    int64_t gas_left,
+    int64_t gas_refund,
+    const uint8_t* output_data,
+    size_t output_size)
+{
+    uint8_t* buffer = NULL;
+    if (output_size != 0 && host != NULL && host->allocate_output != NULL)
+        buffer = host->allocate_output(context, output_size);
+    if (buffer == NULL)
+        return evmc_make_result(status_code, gas_left, gas_refund, output_data, output_size);
+
+    struct evmc_result result;
+    memset(&result, 0, sizeof(result));
+    memcpy(buffer, output_data, output_size);
+    result.status_code = status_code;
+    result.gas_left = gas_left;
+    result.gas_refund = gas_refund;
+    result.output_data = buffer;
+    result.output_size = output_size;
+    return result;
+}
+
+/**
+ * Returns the pointer to the output of the execution result.
+ *
+ * This is evmc_result::inline_output for the output stored inline
+ * (see ::EVMC_RESULT_INLINE_OUTPUT) and evmc_result::output_data otherwise.
+ *
+ * @param result  The result object. MUST NOT be NULL.
+ */
+static inline const uint8_t* evmc_get_output_data(const struct evmc_result* result)
+{
+    return (result->flags & EVMC_RESULT_INLINE_OUTPUT) ? result->inline_output :
+                                                         result->output_data;
+}
+
 /**
  * Releases the resources allocated to the execution result.
  *
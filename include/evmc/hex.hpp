@@ -5,27 +5,315 @@
 
 #include <evmc/bytes.hpp>
 #include <evmc/filter_iterator.hpp>
+#include <array>
 #include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define EVMC_HEX_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define EVMC_HEX_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace evmc
 {
+namespace internal
+{
+/// The lowercase hex digits.
+inline constexpr char hex_digits[] = "0123456789abcdef";
+
+/// The table of the values of the hex digits indexed by the character code.
+/// The non-hex characters map to 0xff.
+inline constexpr auto hex_digit_values = [] {
+    std::array<uint8_t, 256> t{};
+    for (auto& v : t)
+        v = 0xff;
+    for (uint8_t i = 0; i < 10; ++i)
+        t[size_t{'0'} + i] = i;
+    for (uint8_t i = 0; i < 6; ++i)
+    {
+        t[size_t{'a'} + i] = static_cast<uint8_t>(10 + i);
+        t[size_t{'A'} + i] = static_cast<uint8_t>(10 + i);
+    }
+    return t;
+}();
+
+/// Encodes the bytes as hex into the output of 2 * size characters.
+inline void hex_encode_scalar(const uint8_t* in, size_t size, char* out) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        out[2 * i] = hex_digits[in[i] >> 4];
+        out[2 * i + 1] = hex_digits[in[i] & 0xf];
+    }
+}
+
+/// Decodes the 2 * size hex digits from the input into the output of size bytes.
+/// Returns false if a non-hex digit is encountered.
+inline bool hex_decode_scalar(const char* in, size_t size, uint8_t* out) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        const auto hi = hex_digit_values[static_cast<uint8_t>(in[2 * i])];
+        const auto lo = hex_digit_values[static_cast<uint8_t>(in[2 * i + 1])];
+        if ((hi | lo) > 0xf)
+            return false;
+        out[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
+
+#if EVMC_HEX_X86
+/// Converts the 16 hex digits to their values. Clears the valid mask for non-hex digits.
+__attribute__((target("ssse3"))) inline __m128i hex_digits_to_values_ssse3(
+    __m128i c, __m128i& valid) noexcept
+{
+    // The signed comparisons also reject the characters above 0x7f.
+    const auto lc = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    const auto is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    const auto is_letter = _mm_and_si128(_mm_cmpgt_epi8(lc, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmplt_epi8(lc, _mm_set1_epi8('f' + 1)));
+    valid = _mm_and_si128(valid, _mm_or_si128(is_digit, is_letter));
+    return _mm_or_si128(_mm_and_si128(is_digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+                        _mm_and_si128(is_letter, _mm_sub_epi8(lc, _mm_set1_epi8('a' - 10))));
+}
+
+/// Encodes the bytes as hex using SSSE3, 16 bytes per iteration.
+__attribute__((target("ssse3"))) inline void hex_encode_ssse3(const uint8_t* in,
+                                                               size_t size,
+                                                               char* out) noexcept
+{
+    const auto lut = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex_digits));
+    const auto mask = _mm_set1_epi8(0xf);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+        const auto hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(b, 4), mask));
+        const auto lo = _mm_shuffle_epi8(lut, _mm_and_si128(b, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[2 * i]), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[2 * i + 16]), _mm_unpackhi_epi8(hi, lo));
+    }
+    hex_encode_scalar(&in[i], size - i, &out[2 * i]);
+}
+
+/// Decodes the hex digits using SSSE3, 16 digits per iteration.
+__attribute__((target("ssse3"))) inline bool hex_decode_ssse3(const char* in,
+                                                               size_t size,
+                                                               uint8_t* out) noexcept
+{
+    // Multiplies the high nibbles by 16 and adds the low nibbles.
+    const auto nibble_weights = _mm_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        auto valid = _mm_set1_epi8(-1);
+        const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[2 * i]));
+        const auto v = hex_digits_to_values_ssse3(c, valid);
+        if (_mm_movemask_epi8(valid) != 0xffff)
+            return false;
+        const auto r = _mm_maddubs_epi16(v, nibble_weights);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(&out[i]), _mm_packus_epi16(r, r));
+    }
+    return hex_decode_scalar(&in[2 * i], size - i, &out[i]);
+}
+
+/// Encodes the bytes as hex using AVX2, 32 bytes per iteration.
+__attribute__((target("avx2"))) inline void hex_encode_avx2(const uint8_t* in,
+                                                             size_t size,
+                                                             char* out) noexcept
+{
+    const auto lut =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex_digits)));
+    const auto mask = _mm256_set1_epi8(0xf);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i]));
+        const auto hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(b, 4), mask));
+        const auto lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(b, mask));
+        // The unpacking works within the 128-bit lanes: reorder the lanes of the results.
+        const auto first = _mm256_unpacklo_epi8(hi, lo);
+        const auto second = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[2 * i]),
+                            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[2 * i + 32]),
+                            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    hex_encode_ssse3(&in[i], size - i, &out[2 * i]);
+}
+
+/// Decodes the hex digits using AVX2, 32 digits per iteration.
+__attribute__((target("avx2"))) inline bool hex_decode_avx2(const char* in,
+                                                             size_t size,
+                                                             uint8_t* out) noexcept
+{
+    const auto nibble_weights = _mm256_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[2 * i]));
+        const auto lc = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+        const auto is_digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)),
+                                               _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+        const auto is_letter = _mm256_and_si256(_mm256_cmpgt_epi8(lc, _mm256_set1_epi8('a' - 1)),
+                                                _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lc));
+        if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) != -1)
+            return false;
+        const auto v = _mm256_or_si256(
+            _mm256_and_si256(is_digit, _mm256_sub_epi8(c, _mm256_set1_epi8('0'))),
+            _mm256_and_si256(is_letter, _mm256_sub_epi8(lc, _mm256_set1_epi8('a' - 10))));
+        const auto r = _mm256_maddubs_epi16(v, nibble_weights);
+        // The packing works within the 128-bit lanes: gather the low halves of the lanes.
+        const auto p = _mm256_permute4x64_epi64(_mm256_packus_epi16(r, r), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), _mm256_castsi256_si128(p));
+    }
+    return hex_decode_ssse3(&in[2 * i], size - i, &out[i]);
+}
+
+/// The hex implementations by the instruction set extensions available in the CPU.
+enum class HexImpl
+{
+    scalar,
+    ssse3,
+    avx2,
+};
+
+/// Detects the best hex implementation for the CPU once.
+inline HexImpl hex_impl() noexcept
+{
+    static const auto impl = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return HexImpl::avx2;
+        if (__builtin_cpu_supports("ssse3"))
+            return HexImpl::ssse3;
+        return HexImpl::scalar;
+    }();
+    return impl;
+}
+#elif EVMC_HEX_NEON
+/// Converts the 16 hex digits to their values. Clears the valid mask for non-hex digits.
+inline uint8x16_t hex_digits_to_values_neon(uint8x16_t c, uint8x16_t& valid) noexcept
+{
+    // The unsigned underflow of the subtraction rejects the characters below the range.
+    const auto digit = vsubq_u8(c, vdupq_n_u8('0'));
+    const auto letter = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    const auto is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+    const auto is_letter = vcltq_u8(letter, vdupq_n_u8(6));
+    valid = vandq_u8(valid, vorrq_u8(is_digit, is_letter));
+    return vbslq_u8(is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+}
+
+/// Encodes the bytes as hex using NEON, 16 bytes per iteration.
+inline void hex_encode_neon(const uint8_t* in, size_t size, char* out) noexcept
+{
+    const auto lut = vld1q_u8(reinterpret_cast<const uint8_t*>(hex_digits));
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto b = vld1q_u8(&in[i]);
+        uint8x16x2_t digits;
+        digits.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(b, 4));
+        digits.val[1] = vqtbl1q_u8(lut, vandq_u8(b, vdupq_n_u8(0xf)));
+        vst2q_u8(reinterpret_cast<uint8_t*>(&out[2 * i]), digits);  // Interleaves the digits.
+    }
+    hex_encode_scalar(&in[i], size - i, &out[2 * i]);
+}
+
+/// Decodes the hex digits using NEON, 32 digits per iteration.
+inline bool hex_decode_neon(const char* in, size_t size, uint8_t* out) noexcept
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto c = vld2q_u8(reinterpret_cast<const uint8_t*>(&in[2 * i]));  // Deinterleaves.
+        auto valid = vdupq_n_u8(0xff);
+        const auto hi = hex_digits_to_values_neon(c.val[0], valid);
+        const auto lo = hex_digits_to_values_neon(c.val[1], valid);
+        if (vminvq_u8(valid) != 0xff)
+            return false;
+        vst1q_u8(&out[i], vorrq_u8(vshlq_n_u8(hi, 4), lo));
+    }
+    return hex_decode_scalar(&in[2 * i], size - i, &out[i]);
+}
+#endif
+
+/// Encodes the bytes as hex into the output of 2 * size characters
+/// using the fastest implementation available.
+inline void hex_encode(const uint8_t* in, size_t size, char* out) noexcept
+{
+#if EVMC_HEX_X86
+    switch (hex_impl())
+    {
+    case HexImpl::avx2:
+        return hex_encode_avx2(in, size, out);
+    case HexImpl::ssse3:
+        return hex_encode_ssse3(in, size, out);
+    case HexImpl::scalar:
+        break;
+    }
+    return hex_encode_scalar(in, size, out);
+#elif EVMC_HEX_NEON
+    return hex_encode_neon(in, size, out);
+#else
+    return hex_encode_scalar(in, size, out);
+#endif
+}
+
+/// Decodes the 2 * size hex digits into the output of size bytes
+/// using the fastest implementation available.
+inline bool hex_decode(const char* in, size_t size, uint8_t* out) noexcept
+{
+#if EVMC_HEX_X86
+    switch (hex_impl())
+    {
+    case HexImpl::avx2:
+        return hex_decode_avx2(in, size, out);
+    case HexImpl::ssse3:
+        return hex_decode_ssse3(in, size, out);
+    case HexImpl::scalar:
+        break;
+    }
+    return hex_decode_scalar(in, size, out);
+#elif EVMC_HEX_NEON
+    return hex_decode_neon(in, size, out);
+#else
+    return hex_decode_scalar(in, size, out);
+#endif
+}
+}  // namespace internal
+
 /// Encode a byte to a hex string.
 inline std::string hex(uint8_t b) noexcept
 {
-    static constexpr auto hex_digits = "0123456789abcdef";
-    return {hex_digits[b >> 4], hex_digits[b & 0xf]};
+    return {internal::hex_digits[b >> 4], internal::hex_digits[b & 0xf]};
+}
+
+/// Encodes bytes as hex into the caller's buffer.
+///
+/// Uses the SIMD instructions (SSSE3 or AVX2 selected at runtime on x86-64, NEON on AArch64)
+/// if available. Does not allocate.
+///
+/// @param bs   The bytes to encode.
+/// @param out  The output buffer of at least 2 * bs.size() characters.
+/// @return     The pointer past the last written character. No null terminator is written.
+inline char* hex_to(bytes_view bs, char* out) noexcept
+{
+    internal::hex_encode(bs.data(), bs.size(), out);
+    return out + 2 * bs.size();
 }
 
 /// Encodes bytes as hex string.
 inline std::string hex(bytes_view bs)
 {
-    std::string str;
-    str.reserve(bs.size() * 2);
-    for (const auto b : bs)
-        str += hex(b);
+    std::string str(bs.size() * 2, '\0');
+    hex_to(bs, str.data());
     return str;
 }
 
@@ -94,16 +382,42 @@ inline bool validate_hex(std::string_view hex) noexcept
     return from_hex(hex.begin(), hex.end(), noop_output_iterator{});
 }
 
+/// Decodes hex encoded string into the caller's buffer.
+///
+/// Accepts the same input as from_hex(): an even number of hex digits with the optional 0x prefix.
+/// Uses the SIMD instructions if available like hex_to(). Does not allocate.
+///
+/// @param hex       The hex encoded string.
+/// @param out       The output buffer.
+/// @param out_size  The size of the output buffer.
+/// @return          The number of decoded bytes or std::nullopt if the input is invalid
+///                  or the output buffer is too small. The output buffer contents are unspecified
+///                  in case of failure.
+inline std::optional<size_t> from_hex_into(std::string_view hex,
+                                           uint8_t* out,
+                                           size_t out_size) noexcept
+{
+    if (hex.size() >= 2 && hex[0] == '0' && hex[1] == 'x')
+        hex.remove_prefix(2);
+    if (hex.size() % 2 != 0 || hex.size() / 2 > out_size)
+        return {};
+    const auto size = hex.size() / 2;
+    if (!internal::hex_decode(hex.data(), size, out))
+        return {};
+    return size;
+}
+
 /// Decodes hex encoded string to bytes.
 ///
 /// In case the input is invalid the returned value is std::nullopt.
 /// This can happen if a non-hex digit or odd number of digits is encountered.
 inline std::optional<bytes> from_hex(std::string_view hex)
 {
-    bytes bs;
-    bs.reserve(hex.size() / 2);
-    if (!from_hex(hex.begin(), hex.end(), std::back_inserter(bs)))
+    bytes bs(hex.size() / 2, 0);
+    const auto size = from_hex_into(hex, bs.data(), bs.size());
+    if (!size)
         return {};
+    bs.resize(*size);
     return bs;
 }
 
@@ -220,6 +220,136 @@ EVMC_EXPORT const struct evmc_instruction_metrics* evmc_get_instruction_metrics_
  */
 EVMC_EXPORT const char* const* evmc_get_instruction_names_table(enum evmc_revision revision);
 
+/**
+ * The flags of an EVM 1 instruction, see evmc_instruction_descriptor::flags.
+ */
+enum evmc_instruction_flags
+{
+    /** The instruction is defined in the EVM revision. */
+    EVMC_INSTRUCTION_DEFINED = 1 << 0,
+
+    /** The instruction always ends the execution (e.g. STOP, RETURN). */
+    EVMC_INSTRUCTION_TERMINATOR = 1 << 1,
+
+    /** The instruction is a jump (JUMP or JUMPI). */
+    EVMC_INSTRUCTION_JUMP = 1 << 2,
+
+    /**
+     * The instruction may charge gas in addition to the static gas cost
+     * (e.g. memory expansion, data copying or the cold account and storage access).
+     */
+    EVMC_INSTRUCTION_DYNAMIC_GAS = 1 << 3
+};
+
+/**
+ * The packed descriptor of an EVM 1 instruction.
+ *
+ * This combines the evmc_instruction_metrics with the information needed by interpreters
+ * to decode and dispatch the instruction in a single 6-byte entry.
+ */
+struct evmc_instruction_descriptor
+{
+    /** The instruction static gas cost. */
+    int16_t gas_cost;
+
+    /** The minimum number of the EVM stack items required for the instruction. */
+    int8_t stack_height_required;
+
+    /** The EVM stack height change caused by the instruction execution. */
+    int8_t stack_height_change;
+
+    /** The size of the instruction immediate data in bytes (e.g. 1-32 for PUSH1-PUSH32). */
+    uint8_t immediate_size;
+
+    /** The bitset of ::evmc_instruction_flags. */
+    uint8_t flags;
+};
+
+/**
+ * Get the table of the EVM 1 instruction descriptors.
+ *
+ * @param revision  The EVM revision.
+ * @return          The pointer to the array of 256 instruction descriptors. Null pointer in case
+ *                  an invalid EVM revision provided.
+ */
+EVMC_EXPORT const struct evmc_instruction_descriptor* evmc_get_instruction_descriptor_table(
+    enum evmc_revision revision);
+
+/**
+ * The gas cost and the gas refund of SSTORE for an ::evmc_storage_status.
+ */
+struct evmc_storage_cost
+{
+    /** The gas cost of SSTORE, not including the cold storage slot access cost. */
+    int32_t gas_cost;
+
+    /** The gas refund, added to the refund counter. It may be negative. */
+    int32_t gas_refund;
+};
+
+/**
+ * The number of the values of ::evmc_storage_status.
+ */
+enum
+{
+    EVMC_STORAGE_STATUS_COUNT = EVMC_STORAGE_MODIFIED_RESTORED + 1
+};
+
+/**
+ * The gas schedule of an EVM revision: the parameters of the dynamic gas costs
+ * charged by the instructions in addition to their static gas costs.
+ */
+struct evmc_gas_schedule
+{
+    /**
+     * The cost of the access to a warm account or storage slot (EIP-2929).
+     * This is the static gas cost of the accessing instructions since ::EVMC_BERLIN.
+     * Zero before ::EVMC_BERLIN.
+     */
+    int32_t warm_access_cost;
+
+    /**
+     * The cost of the access to a cold account (EIP-2929). The instructions accessing
+     * a cold account charge the difference to warm_access_cost as the dynamic gas cost.
+     * Zero before ::EVMC_BERLIN.
+     */
+    int32_t cold_account_access_cost;
+
+    /**
+     * The cost of the access to a cold storage slot (EIP-2929). SLOAD of a cold slot charges
+     * the difference to warm_access_cost, SSTORE of a cold slot charges it in addition
+     * to the cost from the sstore table. Zero before ::EVMC_BERLIN.
+     */
+    int32_t cold_sload_cost;
+
+    /**
+     * SSTORE fails if the gas left does not exceed this amount (EIP-2200).
+     * Zero before ::EVMC_ISTANBUL.
+     */
+    int32_t sstore_sentry_gas;
+
+    /** The linear cost of a word of the memory expansion. */
+    int32_t memory_word_cost;
+
+    /** The divisor of the quadratic cost of the memory expansion. */
+    int32_t memory_quadratic_divisor;
+
+    /** The cost of a word of the data copied by the *COPY instructions. */
+    int32_t copy_word_cost;
+
+    /** The SSTORE gas costs and refunds indexed by ::evmc_storage_status. */
+    struct evmc_storage_cost sstore[EVMC_STORAGE_STATUS_COUNT];
+};
+
+/**
+ * Get the gas schedule of the EVM revision.
+ *
+ * @param revision  The EVM revision.
+ * @return          The pointer to the gas schedule. Null pointer in case
+ *                  an invalid EVM revision provided.
+ */
+EVMC_EXPORT const struct evmc_gas_schedule* evmc_get_gas_schedule(enum evmc_revision revision);
+
 #ifdef __cplusplus
 }
 #endif
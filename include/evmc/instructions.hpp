@@ -0,0 +1,449 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/instructions.h>
+#include <array>
+
+namespace evmc
+{
+/// Checks if the instruction is defined in the revision of the descriptor table.
+constexpr bool is_defined(const evmc_instruction_descriptor& d) noexcept
+{
+    return (d.flags & EVMC_INSTRUCTION_DEFINED) != 0;
+}
+
+/// Checks if the instruction always ends the execution.
+constexpr bool is_terminator(const evmc_instruction_descriptor& d) noexcept
+{
+    return (d.flags & EVMC_INSTRUCTION_TERMINATOR) != 0;
+}
+
+/// Checks if the instruction is a jump.
+constexpr bool is_jump(const evmc_instruction_descriptor& d) noexcept
+{
+    return (d.flags & EVMC_INSTRUCTION_JUMP) != 0;
+}
+
+/// Checks if the instruction may charge gas in addition to the static gas cost.
+constexpr bool has_dynamic_gas(const evmc_instruction_descriptor& d) noexcept
+{
+    return (d.flags & EVMC_INSTRUCTION_DYNAMIC_GAS) != 0;
+}
+
+/// The table of the 256 instruction descriptors of an EVM revision.
+using InstructionTable = std::array<evmc_instruction_descriptor, 256>;
+
+/// The table of the 256 instruction names of an EVM revision. Null for undefined instructions.
+using InstructionNames = std::array<const char*, 256>;
+
+namespace internal
+{
+constexpr uint8_t DEFINED = EVMC_INSTRUCTION_DEFINED;
+constexpr uint8_t TERMINATOR = EVMC_INSTRUCTION_TERMINATOR;
+constexpr uint8_t JUMP = EVMC_INSTRUCTION_JUMP;
+constexpr uint8_t DYNAMIC_GAS = EVMC_INSTRUCTION_DYNAMIC_GAS;
+
+/// Defines the instruction in the table.
+constexpr void define(InstructionTable& table,
+                      int opcode,
+                      int gas_cost,
+                      int stack_height_required,
+                      int stack_height_change,
+                      uint8_t flags = 0) noexcept
+{
+    auto& d = table[static_cast<size_t>(opcode)];
+    d.gas_cost = static_cast<int16_t>(gas_cost);
+    d.stack_height_required = static_cast<int8_t>(stack_height_required);
+    d.stack_height_change = static_cast<int8_t>(stack_height_change);
+    d.immediate_size = 0;
+    d.flags = static_cast<uint8_t>(DEFINED | flags);
+}
+
+/// Changes the static gas cost of the instruction.
+constexpr void reprice(InstructionTable& table,
+                       int opcode,
+                       int gas_cost,
+                       uint8_t flags = 0) noexcept
+{
+    auto& d = table[static_cast<size_t>(opcode)];
+    d.gas_cost = static_cast<int16_t>(gas_cost);
+    d.flags = static_cast<uint8_t>(d.flags | flags);
+}
+}  // namespace internal
+
+/// Creates the table of the instruction descriptors of the EVM revision.
+///
+/// The table is built starting from ::EVMC_FRONTIER by applying the changes of the following
+/// revisions. It is equal to the one returned by evmc_get_instruction_descriptor_table().
+constexpr InstructionTable make_instruction_table(evmc_revision rev) noexcept
+{
+    using namespace internal;
+    InstructionTable t{};
+
+    define(t, OP_STOP, 0, 0, 0, TERMINATOR);
+    define(t, OP_ADD, 3, 2, -1);
+    define(t, OP_MUL, 5, 2, -1);
+    define(t, OP_SUB, 3, 2, -1);
+    define(t, OP_DIV, 5, 2, -1);
+    define(t, OP_SDIV, 5, 2, -1);
+    define(t, OP_MOD, 5, 2, -1);
+    define(t, OP_SMOD, 5, 2, -1);
+    define(t, OP_ADDMOD, 8, 3, -2);
+    define(t, OP_MULMOD, 8, 3, -2);
+    define(t, OP_EXP, 10, 2, -1, DYNAMIC_GAS);
+    define(t, OP_SIGNEXTEND, 5, 2, -1);
+    for (const auto op : {OP_LT, OP_GT, OP_SLT, OP_SGT, OP_EQ, OP_AND, OP_OR, OP_XOR, OP_BYTE})
+        define(t, op, 3, 2, -1);
+    define(t, OP_ISZERO, 3, 1, 0);
+    define(t, OP_NOT, 3, 1, 0);
+    define(t, OP_KECCAK256, 30, 2, -1, DYNAMIC_GAS);
+    for (const auto op : {OP_ADDRESS, OP_ORIGIN, OP_CALLER, OP_CALLVALUE, OP_CALLDATASIZE,
+                          OP_CODESIZE, OP_GASPRICE, OP_COINBASE, OP_TIMESTAMP, OP_NUMBER,
+                          OP_PREVRANDAO, OP_GASLIMIT, OP_PC, OP_MSIZE, OP_GAS})
+        define(t, op, 2, 0, 1);
+    define(t, OP_BALANCE, 20, 1, 0);
+    define(t, OP_CALLDATALOAD, 3, 1, 0);
+    define(t, OP_CALLDATACOPY, 3, 3, -3, DYNAMIC_GAS);
+    define(t, OP_CODECOPY, 3, 3, -3, DYNAMIC_GAS);
+    define(t, OP_EXTCODESIZE, 20, 1, 0);
+    define(t, OP_EXTCODECOPY, 20, 4, -4, DYNAMIC_GAS);
+    define(t, OP_BLOCKHASH, 20, 1, 0);
+    define(t, OP_POP, 2, 1, -1);
+    define(t, OP_MLOAD, 3, 1, 0, DYNAMIC_GAS);
+    define(t, OP_MSTORE, 3, 2, -2, DYNAMIC_GAS);
+    define(t, OP_MSTORE8, 3, 2, -2, DYNAMIC_GAS);
+    define(t, OP_SLOAD, 50, 1, 0);
+    define(t, OP_SSTORE, 0, 2, -2, DYNAMIC_GAS);
+    define(t, OP_JUMP, 8, 1, -1, JUMP);
+    define(t, OP_JUMPI, 10, 2, -2, JUMP);
+    define(t, OP_JUMPDEST, 1, 0, 0);
+    for (int n = 1; n <= 32; ++n)
+    {
+        define(t, OP_PUSH1 + n - 1, 3, 0, 1);
+        t[static_cast<size_t>(OP_PUSH1 + n - 1)].immediate_size = static_cast<uint8_t>(n);
+    }
+    for (int n = 1; n <= 16; ++n)
+    {
+        define(t, OP_DUP1 + n - 1, 3, n, 1);
+        define(t, OP_SWAP1 + n - 1, 3, n + 1, 0);
+    }
+    for (int n = 0; n <= 4; ++n)
+        define(t, OP_LOG0 + n, 375 * (n + 1), n + 2, -(n + 2), DYNAMIC_GAS);
+    define(t, OP_CREATE, 32000, 3, -2, DYNAMIC_GAS);
+    define(t, OP_CALL, 40, 7, -6, DYNAMIC_GAS);
+    define(t, OP_CALLCODE, 40, 7, -6, DYNAMIC_GAS);
+    define(t, OP_RETURN, 0, 2, -2, TERMINATOR | DYNAMIC_GAS);
+    define(t, OP_INVALID, 0, 0, 0, TERMINATOR);
+    define(t, OP_SELFDESTRUCT, 0, 1, -1, TERMINATOR);
+
+    if (rev >= EVMC_HOMESTEAD)
+        define(t, OP_DELEGATECALL, 40, 6, -5, DYNAMIC_GAS);
+
+    if (rev >= EVMC_TANGERINE_WHISTLE)  // EIP-150
+    {
+        reprice(t, OP_BALANCE, 400);
+        reprice(t, OP_EXTCODESIZE, 700);
+        reprice(t, OP_EXTCODECOPY, 700);
+        reprice(t, OP_SLOAD, 200);
+        reprice(t, OP_CALL, 700);
+        reprice(t, OP_CALLCODE, 700);
+        reprice(t, OP_DELEGATECALL, 700);
+        reprice(t, OP_SELFDESTRUCT, 5000, DYNAMIC_GAS);
+    }
+
+    if (rev >= EVMC_BYZANTIUM)
+    {
+        define(t, OP_RETURNDATASIZE, 2, 0, 1);
+        define(t, OP_RETURNDATACOPY, 3, 3, -3, DYNAMIC_GAS);
+        define(t, OP_STATICCALL, 700, 6, -5, DYNAMIC_GAS);
+        define(t, OP_REVERT, 0, 2, -2, TERMINATOR | DYNAMIC_GAS);
+    }
+
+    if (rev >= EVMC_CONSTANTINOPLE)
+    {
+        define(t, OP_SHL, 3, 2, -1);
+        define(t, OP_SHR, 3, 2, -1);
+        define(t, OP_SAR, 3, 2, -1);
+        define(t, OP_EXTCODEHASH, 400, 1, 0);
+        define(t, OP_CREATE2, 32000, 4, -3, DYNAMIC_GAS);
+    }
+
+    if (rev >= EVMC_ISTANBUL)  // EIP-1884
+    {
+        reprice(t, OP_BALANCE, 700);
+        reprice(t, OP_EXTCODEHASH, 700);
+        reprice(t, OP_SLOAD, 800);
+        define(t, OP_CHAINID, 2, 0, 1);
+        define(t, OP_SELFBALANCE, 5, 0, 1);
+    }
+
+    if (rev >= EVMC_BERLIN)  // EIP-2929: the warm access costs, the cold access is dynamic.
+    {
+        for (const auto op : {OP_BALANCE, OP_EXTCODESIZE, OP_EXTCODECOPY, OP_EXTCODEHASH, OP_SLOAD,
+                              OP_CALL, OP_CALLCODE, OP_DELEGATECALL, OP_STATICCALL})
+            reprice(t, op, 100, DYNAMIC_GAS);
+    }
+
+    if (rev >= EVMC_LONDON)
+        define(t, OP_BASEFEE, 2, 0, 1);
+
+    if (rev >= EVMC_SHANGHAI)
+        define(t, OP_PUSH0, 2, 0, 1);
+
+    return t;
+}
+
+/// Creates the table of the instruction names of the EVM revision.
+///
+/// It is equal to the one returned by evmc_get_instruction_names_table().
+constexpr InstructionNames make_instruction_names(evmc_revision rev) noexcept
+{
+    constexpr const char* push_names[] = {
+        "PUSH1",  "PUSH2",  "PUSH3",  "PUSH4",  "PUSH5",  "PUSH6",  "PUSH7",  "PUSH8",
+        "PUSH9",  "PUSH10", "PUSH11", "PUSH12", "PUSH13", "PUSH14", "PUSH15", "PUSH16",
+        "PUSH17", "PUSH18", "PUSH19", "PUSH20", "PUSH21", "PUSH22", "PUSH23", "PUSH24",
+        "PUSH25", "PUSH26", "PUSH27", "PUSH28", "PUSH29", "PUSH30", "PUSH31", "PUSH32",
+    };
+    constexpr const char* dup_names[] = {
+        "DUP1", "DUP2",  "DUP3",  "DUP4",  "DUP5",  "DUP6",  "DUP7",  "DUP8",
+        "DUP9", "DUP10", "DUP11", "DUP12", "DUP13", "DUP14", "DUP15", "DUP16",
+    };
+    constexpr const char* swap_names[] = {
+        "SWAP1", "SWAP2",  "SWAP3",  "SWAP4",  "SWAP5",  "SWAP6",  "SWAP7",  "SWAP8",
+        "SWAP9", "SWAP10", "SWAP11", "SWAP12", "SWAP13", "SWAP14", "SWAP15", "SWAP16",
+    };
+    constexpr const char* log_names[] = {"LOG0", "LOG1", "LOG2", "LOG3", "LOG4"};
+
+    InstructionNames n{};
+    n[OP_STOP] = "STOP";
+    n[OP_ADD] = "ADD";
+    n[OP_MUL] = "MUL";
+    n[OP_SUB] = "SUB";
+    n[OP_DIV] = "DIV";
+    n[OP_SDIV] = "SDIV";
+    n[OP_MOD] = "MOD";
+    n[OP_SMOD] = "SMOD";
+    n[OP_ADDMOD] = "ADDMOD";
+    n[OP_MULMOD] = "MULMOD";
+    n[OP_EXP] = "EXP";
+    n[OP_SIGNEXTEND] = "SIGNEXTEND";
+    n[OP_LT] = "LT";
+    n[OP_GT] = "GT";
+    n[OP_SLT] = "SLT";
+    n[OP_SGT] = "SGT";
+    n[OP_EQ] = "EQ";
+    n[OP_ISZERO] = "ISZERO";
+    n[OP_AND] = "AND";
+    n[OP_OR] = "OR";
+    n[OP_XOR] = "XOR";
+    n[OP_NOT] = "NOT";
+    n[OP_BYTE] = "BYTE";
+    n[OP_KECCAK256] = "KECCAK256";
+    n[OP_ADDRESS] = "ADDRESS";
+    n[OP_BALANCE] = "BALANCE";
+    n[OP_ORIGIN] = "ORIGIN";
+    n[OP_CALLER] = "CALLER";
+    n[OP_CALLVALUE] = "CALLVALUE";
+    n[OP_CALLDATALOAD] = "CALLDATALOAD";
+    n[OP_CALLDATASIZE] = "CALLDATASIZE";
+    n[OP_CALLDATACOPY] = "CALLDATACOPY";
+    n[OP_CODESIZE] = "CODESIZE";
+    n[OP_CODECOPY] = "CODECOPY";
+    n[OP_GASPRICE] = "GASPRICE";
+    n[OP_EXTCODESIZE] = "EXTCODESIZE";
+    n[OP_EXTCODECOPY] = "EXTCODECOPY";
+    n[OP_BLOCKHASH] = "BLOCKHASH";
+    n[OP_COINBASE] = "COINBASE";
+    n[OP_TIMESTAMP] = "TIMESTAMP";
+    n[OP_NUMBER] = "NUMBER";
+    n[OP_PREVRANDAO] = rev >= EVMC_PARIS ? "PREVRANDAO" : "DIFFICULTY";
+    n[OP_GASLIMIT] = "GASLIMIT";
+    n[OP_POP] = "POP";
+    n[OP_MLOAD] = "MLOAD";
+    n[OP_MSTORE] = "MSTORE";
+    n[OP_MSTORE8] = "MSTORE8";
+    n[OP_SLOAD] = "SLOAD";
+    n[OP_SSTORE] = "SSTORE";
+    n[OP_JUMP] = "JUMP";
+    n[OP_JUMPI] = "JUMPI";
+    n[OP_PC] = "PC";
+    n[OP_MSIZE] = "MSIZE";
+    n[OP_GAS] = "GAS";
+    n[OP_JUMPDEST] = "JUMPDEST";
+    for (size_t i = 0; i < 32; ++i)
+        n[OP_PUSH1 + i] = push_names[i];
+    for (size_t i = 0; i < 16; ++i)
+    {
+        n[OP_DUP1 + i] = dup_names[i];
+        n[OP_SWAP1 + i] = swap_names[i];
+    }
+    for (size_t i = 0; i < 5; ++i)
+        n[OP_LOG0 + i] = log_names[i];
+    n[OP_CREATE] = "CREATE";
+    n[OP_CALL] = "CALL";
+    n[OP_CALLCODE] = "CALLCODE";
+    n[OP_RETURN] = "RETURN";
+    n[OP_INVALID] = "INVALID";
+    n[OP_SELFDESTRUCT] = "SELFDESTRUCT";
+
+    if (rev >= EVMC_HOMESTEAD)
+        n[OP_DELEGATECALL] = "DELEGATECALL";
+
+    if (rev >= EVMC_BYZANTIUM)
+    {
+        n[OP_RETURNDATASIZE] = "RETURNDATASIZE";
+        n[OP_RETURNDATACOPY] = "RETURNDATACOPY";
+        n[OP_STATICCALL] = "STATICCALL";
+        n[OP_REVERT] = "REVERT";
+    }
+
+    if (rev >= EVMC_CONSTANTINOPLE)
+    {
+        n[OP_SHL] = "SHL";
+        n[OP_SHR] = "SHR";
+        n[OP_SAR] = "SAR";
+        n[OP_EXTCODEHASH] = "EXTCODEHASH";
+        n[OP_CREATE2] = "CREATE2";
+    }
+
+    if (rev >= EVMC_ISTANBUL)
+    {
+        n[OP_CHAINID] = "CHAINID";
+        n[OP_SELFBALANCE] = "SELFBALANCE";
+    }
+
+    if (rev >= EVMC_LONDON)
+        n[OP_BASEFEE] = "BASEFEE";
+
+    if (rev >= EVMC_SHANGHAI)
+        n[OP_PUSH0] = "PUSH0";
+
+    return n;
+}
+
+/// The constexpr table of the instruction descriptors of the EVM revision.
+template <evmc_revision Rev>
+inline constexpr InstructionTable instruction_table = make_instruction_table(Rev);
+
+/// The constexpr table of the instruction names of the EVM revision.
+template <evmc_revision Rev>
+inline constexpr InstructionNames instruction_names = make_instruction_names(Rev);
+
+/// Returns the descriptor of the instruction in the EVM revision.
+///
+/// This is usable in constant expressions, e.g. to fold the gas costs into
+/// the code of an interpreter loop specialized for the revision.
+template <evmc_revision Rev>
+constexpr const evmc_instruction_descriptor& get_instruction_descriptor(uint8_t opcode) noexcept
+{
+    return instruction_table<Rev>[opcode];
+}
+
+/// Creates the gas schedule of the EVM revision.
+///
+/// The SSTORE costs and refunds are derived from the storage gas parameters of the revision
+/// following EIP-1283, EIP-2200, EIP-2929 and EIP-3529. It is equal to the one returned by
+/// evmc_get_gas_schedule().
+constexpr evmc_gas_schedule make_gas_schedule(evmc_revision rev) noexcept
+{
+    evmc_gas_schedule g{};
+    g.memory_word_cost = 3;
+    g.memory_quadratic_divisor = 512;
+    g.copy_word_cost = 3;
+
+    int32_t warm_access = 0;  // The cost of the no-op SSTORE, the net metering if non-zero.
+    int32_t set = 20000;
+    int32_t reset = 5000;
+    int32_t clear = 15000;
+    if (rev == EVMC_CONSTANTINOPLE)
+        warm_access = 200;
+    if (rev >= EVMC_ISTANBUL)
+    {
+        warm_access = 800;
+        g.sstore_sentry_gas = 2300;
+    }
+    if (rev >= EVMC_BERLIN)
+    {
+        warm_access = 100;
+        g.warm_access_cost = warm_access;
+        g.cold_account_access_cost = 2600;
+        g.cold_sload_cost = 2100;
+        reset -= g.cold_sload_cost;
+    }
+    if (rev >= EVMC_LONDON)
+        clear = 4800;
+
+    auto& c = g.sstore;
+    if (warm_access == 0)  // Only the current and the new values matter.
+    {
+        c[EVMC_STORAGE_ASSIGNED] = {reset, 0};
+        c[EVMC_STORAGE_ADDED] = {set, 0};
+        c[EVMC_STORAGE_DELETED] = {reset, clear};
+        c[EVMC_STORAGE_MODIFIED] = {reset, 0};
+        c[EVMC_STORAGE_DELETED_ADDED] = {set, 0};
+        c[EVMC_STORAGE_MODIFIED_DELETED] = {reset, clear};
+        c[EVMC_STORAGE_DELETED_RESTORED] = {set, 0};
+        c[EVMC_STORAGE_ADDED_DELETED] = {reset, clear};
+        c[EVMC_STORAGE_MODIFIED_RESTORED] = {reset, 0};
+    }
+    else
+    {
+        c[EVMC_STORAGE_ASSIGNED] = {warm_access, 0};
+        c[EVMC_STORAGE_ADDED] = {set, 0};
+        c[EVMC_STORAGE_DELETED] = {reset, clear};
+        c[EVMC_STORAGE_MODIFIED] = {reset, 0};
+        c[EVMC_STORAGE_DELETED_ADDED] = {warm_access, -clear};
+        c[EVMC_STORAGE_MODIFIED_DELETED] = {warm_access, clear};
+        c[EVMC_STORAGE_DELETED_RESTORED] = {warm_access, reset - warm_access - clear};
+        c[EVMC_STORAGE_ADDED_DELETED] = {warm_access, set - warm_access};
+        c[EVMC_STORAGE_MODIFIED_RESTORED] = {warm_access, reset - warm_access};
+    }
+    return g;
+}
+
+/// The constexpr gas schedule of the EVM revision.
+template <evmc_revision Rev>
+inline constexpr evmc_gas_schedule gas_schedule = make_gas_schedule(Rev);
+
+/// Returns the number of the 32-byte words needed to hold the given number of bytes.
+constexpr uint64_t num_words(uint64_t size) noexcept
+{
+    return (size + 31) / 32;
+}
+
+/// Returns the total cost of the memory of the given number of words.
+///
+/// The number of words is expected to be limited by the gas available, e.g. below 2^32,
+/// so the computation does not overflow.
+constexpr int64_t memory_cost(const evmc_gas_schedule& g, uint64_t words) noexcept
+{
+    const auto w = static_cast<int64_t>(words);
+    return w * g.memory_word_cost + w * w / g.memory_quadratic_divisor;
+}
+
+/// Returns the cost of the memory expansion from the current to the new number of words.
+/// Zero if the memory is not expanded.
+constexpr int64_t memory_expansion_cost(const evmc_gas_schedule& g,
+                                        uint64_t current_words,
+                                        uint64_t new_words) noexcept
+{
+    return new_words > current_words ? memory_cost(g, new_words) - memory_cost(g, current_words) :
+                                       0;
+}
+
+/// Returns the cost of the words copied by the *COPY instructions for the data size in bytes.
+constexpr int64_t copy_cost(const evmc_gas_schedule& g, uint64_t size) noexcept
+{
+    return static_cast<int64_t>(num_words(size)) * g.copy_word_cost;
+}
+
+/// Returns the SSTORE gas cost and refund of the storage status.
+/// The cost of the cold storage slot access is not included.
+constexpr const evmc_storage_cost& sstore_cost(const evmc_gas_schedule& g,
+                                               evmc_storage_status status) noexcept
+{
+    return g.sstore[status];
+}
+}  // namespace evmc
@@ -0,0 +1,423 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace evmc
+{
+/// The Host methods measured by the evmc::BasicInstrumentedHost.
+enum class HostMethod
+{
+    account_exists,
+    get_storage,
+    set_storage,
+    get_balance,
+    get_code_size,
+    get_code_hash,
+    copy_code,
+    selfdestruct,
+    call,
+    get_tx_context,
+    get_block_hash,
+    emit_log,
+    access_account,
+    access_storage,
+    get_transient_storage,
+    set_transient_storage,
+    get_storage_batch,
+    get_code_view,
+    allocate_output,
+    get_tx_initcode,
+};
+
+/// The number of the evmc::HostMethod values.
+constexpr size_t num_host_methods = static_cast<size_t>(HostMethod::get_tx_initcode) + 1;
+
+/// Returns the name of the Host method.
+inline const char* to_string(HostMethod method) noexcept
+{
+    constexpr const char* names[num_host_methods] = {
+        "account_exists",
+        "get_storage",
+        "set_storage",
+        "get_balance",
+        "get_code_size",
+        "get_code_hash",
+        "copy_code",
+        "selfdestruct",
+        "call",
+        "get_tx_context",
+        "get_block_hash",
+        "emit_log",
+        "access_account",
+        "access_storage",
+        "get_transient_storage",
+        "set_transient_storage",
+        "get_storage_batch",
+        "get_code_view",
+        "allocate_output",
+        "get_tx_initcode",
+    };
+    return names[static_cast<size_t>(method)];
+}
+
+/// The calls and the latency statistics of a Host method.
+struct HostMethodStats
+{
+    /// The number of the latency histogram buckets. The bucket i counts the latencies
+    /// in the range [2^i, 2^(i+1)) nanoseconds, the bucket 0 all the latencies below 2 ns
+    /// and the last bucket all the latencies above.
+    static constexpr size_t num_buckets = 32;
+
+    uint64_t count = 0;     ///< The number of the calls.
+    uint64_t sampled = 0;   ///< The number of the calls with the latency measured.
+    uint64_t total_ns = 0;  ///< The cumulative latency of the sampled calls.
+    uint64_t max_ns = 0;    ///< The maximum latency of the sampled calls.
+
+    /// The histogram of the sampled latencies.
+    std::array<uint64_t, num_buckets> histogram{};
+
+    /// The mean latency in nanoseconds.
+    double mean_ns() const noexcept
+    {
+        return sampled != 0 ? static_cast<double>(total_ns) / static_cast<double>(sampled) : 0;
+    }
+
+    /// The cumulative latency of all the calls in nanoseconds, extrapolated from the samples.
+    double estimated_total_ns() const noexcept
+    {
+        return mean_ns() * static_cast<double>(count);
+    }
+
+    /// The approximate latency percentile in nanoseconds.
+    ///
+    /// The value is interpolated within the histogram bucket, so the error is below 2x.
+    ///
+    /// @param q  The quantile in the range [0, 1], e.g. 0.99 for the 99th percentile.
+    double percentile_ns(double q) const noexcept
+    {
+        if (sampled == 0)
+            return 0;
+        const auto rank = q * static_cast<double>(sampled);
+        double cumulative = 0;
+        for (size_t i = 0; i < num_buckets; ++i)
+        {
+            const auto n = static_cast<double>(histogram[i]);
+            if (n != 0 && cumulative + n >= rank)
+            {
+                const auto lower = i == 0 ? 0.0 : static_cast<double>(uint64_t{1} << i);
+                const auto upper = std::min(static_cast<double>(uint64_t{1} << (i + 1)),
+                                            static_cast<double>(max_ns));
+                return lower + (upper - lower) * std::max(rank - cumulative, 0.0) / n;
+            }
+            cumulative += n;
+        }
+        return static_cast<double>(max_ns);
+    }
+};
+
+/// Returns the index of the calling thread, assigned once in the order of the first use.
+inline size_t thread_index() noexcept
+{
+    static std::atomic<size_t> next{0};
+    thread_local const size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+/// The Host decorator counting the calls and measuring the latency of the Host methods.
+///
+/// Forwards all the Host methods to the wrapped Host, so the time of an execution can be
+/// split between the VM and the Host state access. The latency of call() includes
+/// the nested execution, so the Host methods called from the nested execution through
+/// the same InstrumentedHost are also included in the call() latency.
+///
+/// The calls are counted exactly. The latency is measured with the Clock for one of every
+/// sample_period calls of a method, to keep the overhead low for the frequent cheap methods.
+/// The statistics are kept in the lock-free counters sharded by the thread, so the
+/// InstrumentedHost of a thread-safe Host can be used by multiple threads.
+/// The statistics are pulled with stats() at any time.
+///
+/// @tparam Clock  The clock of the latency measurements, e.g. std::chrono::steady_clock.
+template <typename Clock>
+class BasicInstrumentedHost : public Host
+{
+    /// The counters of a Host method in a shard.
+    struct Counters
+    {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sampled{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+        std::array<std::atomic<uint64_t>, HostMethodStats::num_buckets> histogram{};
+    };
+
+    /// The counters of all the methods updated by the threads with the same shard index.
+    struct alignas(64) Shard
+    {
+        std::array<Counters, num_host_methods> methods;
+    };
+
+    static constexpr size_t num_shards = 8;
+
+    HostInterface& m_host;
+    uint64_t m_sample_mask;
+    std::unique_ptr<Shard[]> m_shards{new Shard[num_shards]};
+
+    /// The scoped measurement of a Host method call.
+    class Measurement
+    {
+        Counters& m_counters;
+        bool m_sampled;
+        typename Clock::time_point m_start;
+
+    public:
+        Measurement(const BasicInstrumentedHost& host, HostMethod method) noexcept
+          : m_counters{host.m_shards[thread_index() % num_shards]
+                           .methods[static_cast<size_t>(method)]},
+            m_sampled{(m_counters.count.fetch_add(1, std::memory_order_relaxed) &
+                       host.m_sample_mask) == 0}
+        {
+            if (m_sampled)
+                m_start = Clock::now();
+        }
+
+        Measurement(const Measurement&) = delete;
+        Measurement& operator=(const Measurement&) = delete;
+
+        ~Measurement()
+        {
+            if (!m_sampled)
+                return;
+            const auto ns = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start)
+                    .count());
+            m_counters.sampled.fetch_add(1, std::memory_order_relaxed);
+            m_counters.total_ns.fetch_add(ns, std::memory_order_relaxed);
+            auto max = m_counters.max_ns.load(std::memory_order_relaxed);
+            while (ns > max &&
+                   !m_counters.max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+            {
+            }
+            m_counters.histogram[bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    /// Returns the histogram bucket of the latency: the index of the highest bit set.
+    static size_t bucket(uint64_t ns) noexcept
+    {
+        size_t i = 0;
+        while (ns > 1 && i < HostMethodStats::num_buckets - 1)
+        {
+            ns >>= 1;
+            ++i;
+        }
+        return i;
+    }
+
+    Measurement measure(HostMethod method) const noexcept { return {*this, method}; }
+
+public:
+    /// Constructor.
+    /// @param host           The Host to forward the methods to. Must outlive
+    ///                       the InstrumentedHost.
+    /// @param sample_period  The latency is measured for one of every sample_period calls
+    ///                       of a method. Rounded up to a power of 2. Every call if 0 or 1.
+    explicit BasicInstrumentedHost(HostInterface& host, uint64_t sample_period = 1)
+      : m_host{host}, m_sample_mask{0}
+    {
+        while (m_sample_mask + 1 < sample_period)
+            m_sample_mask = (m_sample_mask << 1) | 1;
+    }
+
+    /// The period of the latency sampling.
+    uint64_t sample_period() const noexcept { return m_sample_mask + 1; }
+
+    /// Returns the statistics of the Host method, merged from all the threads.
+    HostMethodStats stats(HostMethod method) const noexcept
+    {
+        HostMethodStats s;
+        for (size_t i = 0; i < num_shards; ++i)
+        {
+            const auto& c = m_shards[i].methods[static_cast<size_t>(method)];
+            s.count += c.count.load(std::memory_order_relaxed);
+            s.sampled += c.sampled.load(std::memory_order_relaxed);
+            s.total_ns += c.total_ns.load(std::memory_order_relaxed);
+            s.max_ns = std::max(s.max_ns, c.max_ns.load(std::memory_order_relaxed));
+            for (size_t b = 0; b < HostMethodStats::num_buckets; ++b)
+                s.histogram[b] += c.histogram[b].load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    /// Returns the statistics of all the Host methods, indexed by evmc::HostMethod.
+    std::array<HostMethodStats, num_host_methods> stats() const noexcept
+    {
+        std::array<HostMethodStats, num_host_methods> all;
+        for (size_t m = 0; m < num_host_methods; ++m)
+            all[m] = stats(static_cast<HostMethod>(m));
+        return all;
+    }
+
+    /// Resets all the statistics. Must not be called concurrently with the Host methods.
+    void reset() noexcept
+    {
+        for (size_t i = 0; i < num_shards; ++i)
+        {
+            for (auto& c : m_shards[i].methods)
+            {
+                c.count.store(0, std::memory_order_relaxed);
+                c.sampled.store(0, std::memory_order_relaxed);
+                c.total_ns.store(0, std::memory_order_relaxed);
+                c.max_ns.store(0, std::memory_order_relaxed);
+                for (auto& h : c.histogram)
+                    h.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool account_exists(const address& addr) const noexcept override
+    {
+        const auto m = measure(HostMethod::account_exists);
+        return m_host.account_exists(addr);
+    }
+
+    bytes32 get_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_storage);
+        return m_host.get_storage(addr, key);
+    }
+
+    evmc_storage_status set_storage(const address& addr,
+                                    const bytes32& key,
+                                    const bytes32& value) noexcept override
+    {
+        const auto m = measure(HostMethod::set_storage);
+        return m_host.set_storage(addr, key, value);
+    }
+
+    uint256be get_balance(const address& addr) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_balance);
+        return m_host.get_balance(addr);
+    }
+
+    size_t get_code_size(const address& addr) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_code_size);
+        return m_host.get_code_size(addr);
+    }
+
+    bytes32 get_code_hash(const address& addr) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_code_hash);
+        return m_host.get_code_hash(addr);
+    }
+
+    size_t copy_code(const address& addr,
+                     size_t code_offset,
+                     uint8_t* buffer_data,
+                     size_t buffer_size) const noexcept override
+    {
+        const auto m = measure(HostMethod::copy_code);
+        return m_host.copy_code(addr, code_offset, buffer_data, buffer_size);
+    }
+
+    bool selfdestruct(const address& addr, const address& beneficiary) noexcept override
+    {
+        const auto m = measure(HostMethod::selfdestruct);
+        return m_host.selfdestruct(addr, beneficiary);
+    }
+
+    Result call(const evmc_message& msg) noexcept override
+    {
+        const auto m = measure(HostMethod::call);
+        return m_host.call(msg);
+    }
+
+    evmc_tx_context get_tx_context() const noexcept override
+    {
+        const auto m = measure(HostMethod::get_tx_context);
+        return m_host.get_tx_context();
+    }
+
+    bytes32 get_block_hash(int64_t block_number) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_block_hash);
+        return m_host.get_block_hash(block_number);
+    }
+
+    void emit_log(const address& addr,
+                  const uint8_t* data,
+                  size_t data_size,
+                  const bytes32 topics[],
+                  size_t topics_count) noexcept override
+    {
+        const auto m = measure(HostMethod::emit_log);
+        m_host.emit_log(addr, data, data_size, topics, topics_count);
+    }
+
+    evmc_access_status access_account(const address& addr) noexcept override
+    {
+        const auto m = measure(HostMethod::access_account);
+        return m_host.access_account(addr);
+    }
+
+    evmc_access_status access_storage(const address& addr, const bytes32& key) noexcept override
+    {
+        const auto m = measure(HostMethod::access_storage);
+        return m_host.access_storage(addr, key);
+    }
+
+    bytes32 get_transient_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_transient_storage);
+        return m_host.get_transient_storage(addr, key);
+    }
+
+    void set_transient_storage(const address& addr,
+                               const bytes32& key,
+                               const bytes32& value) noexcept override
+    {
+        const auto m = measure(HostMethod::set_transient_storage);
+        m_host.set_transient_storage(addr, key, value);
+    }
+
+    void get_storage_batch(const evmc_storage_key keys[],
+                           bytes32 values[],
+                           size_t count) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_storage_batch);
+        m_host.get_storage_batch(keys, values, count);
+    }
+
+    bool get_code_view(const address& addr, evmc_code_view& view) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_code_view);
+        return m_host.get_code_view(addr, view);
+    }
+
+    uint8_t* allocate_output(size_t size) noexcept override
+    {
+        const auto m = measure(HostMethod::allocate_output);
+        return m_host.allocate_output(size);
+    }
+
+    const evmc_tracer* get_tracer() noexcept override { return m_host.get_tracer(); }
+
+    const evmc_tx_initcode* get_tx_initcode(const bytes32& hash) const noexcept override
+    {
+        const auto m = measure(HostMethod::get_tx_initcode);
+        return m_host.get_tx_initcode(hash);
+    }
+};
+
+/// The Host decorator measuring the Host methods with the std::chrono::steady_clock.
+using InstrumentedHost = BasicInstrumentedHost<std::chrono::steady_clock>;
+}  // namespace evmc
@@ -13,6 +13,8 @@
  */
 #pragma once
 
+#include <stddef.h>  /* Definition of size_t. */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -83,6 +85,14 @@ enum evmc_loader_error_code
  *
  * It is safe to call this function with the same filename argument multiple times
  * (the DLL is not going to be loaded multiple times).
+ * The create functions of the successfully loaded modules are cached by the filename,
+ * so the subsequent calls with the same filename do not access the DLL at all.
+ * See evmc_loader_clear_cache().
+ *
+ * If the `filename` is the name of a VM registered with evmc_register_vm(),
+ * the registered create function is returned and no DLL is loaded.
+ * This applies also to evmc_load_and_create() and evmc_load_and_configure(),
+ * e.g. the "evmone,O=2" configuration creates and configures the registered "evmone" VM.
  *
  * @param filename    The null terminated path (absolute or relative) to an EVMC module
  *                    (dynamically loaded library) containing the VM implementation.
@@ -154,6 +164,61 @@ struct evmc_vm* evmc_load_and_create(const char* filename, enum evmc_loader_erro
 struct evmc_vm* evmc_load_and_configure(const char* config,
                                         enum evmc_loader_error_code* error_code);
 
+/**
+ * Dynamically loads the EVMC module, then creates and configures the pool of VM instances.
+ *
+ * This is the equivalent of calling evmc_load_and_configure() @p count times,
+ * but the module is loaded and the configuration string is parsed only once.
+ * The function signals the same errors as evmc_load_and_configure().
+ * In case of error, the already created VM instances are destroyed, so either all
+ * or none of the VM instances are created.
+ *
+ * @param config      The path to the EVMC module with additional configuration options.
+ * @param vms         The output array of the created VM instances. Must have room for
+ *                    @p count items. The items are set to NULL in case of error.
+ * @param count       The number of the VM instances to create.
+ * @param error_code  The pointer to the error code. If not NULL the value is set to
+ *                    ::EVMC_LOADER_SUCCESS on success or any other error code as described above.
+ * @return            The number of the created VM instances: @p count on success, 0 in case
+ *                    of error.
+ */
+size_t evmc_load_and_configure_pool(const char* config,
+                                    struct evmc_vm* vms[],
+                                    size_t count,
+                                    enum evmc_loader_error_code* error_code);
+
+/**
+ * Registers the VM linked into the program under the given name.
+ *
+ * The loading functions resolve the registered name to the create function before
+ * trying to load the DLL of this name. This allows linking the VMs statically (e.g. to enable
+ * the link-time optimization across the Host and the VM) while still selecting
+ * and configuring them with the loader configuration strings.
+ * Registering the already registered name replaces its create function.
+ *
+ * @param name       The null terminated name of the VM. It is copied.
+ * @param create_fn  The VM create function.
+ * @return           ::EVMC_LOADER_SUCCESS on success, ::EVMC_LOADER_INVALID_ARGUMENT if
+ *                   the name is NULL or empty, the create function is NULL or
+ *                   the maximum number of registered VMs has been reached.
+ */
+enum evmc_loader_error_code evmc_register_vm(const char* name, evmc_create_fn create_fn);
+
+/**
+ * Removes the VM registered under the given name, see evmc_register_vm().
+ *
+ * Does nothing if no VM is registered under the name.
+ */
+void evmc_unregister_vm(const char* name);
+
+/**
+ * Clears the cache of the loaded EVMC modules.
+ *
+ * The subsequent loading functions will open the modules again. The modules are not unloaded,
+ * so the VM instances already created stay valid.
+ */
+void evmc_loader_clear_cache(void);
+
 /**
  * Returns the human-readable message describing the most recent error
  * that occurred in EVMC loading since the last call to this function.
@@ -4,10 +4,15 @@
 #pragma once
 
 #include <evmc/evmc.hpp>
+#include <evmc/flat_hash_map.hpp>
 #include <algorithm>
 #include <cassert>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
+#include <variant>
 #include <vector>
 
 namespace evmc
@@ -41,8 +46,148 @@ struct StorageValue
     {}
 };
 
+/// Returns the storage status of the modification of the storage value (EIP-2200).
+///
+/// @param original  The original value of the storage slot in the transaction.
+/// @param current   The current value of the storage slot.
+/// @param value     The new value of the storage slot.
+inline evmc_storage_status compute_storage_status(const bytes32& original,
+                                                  const bytes32& current,
+                                                  const bytes32& value) noexcept
+{
+    // Follow the EIP-2200 specification as closely as possible.
+    // https://eips.ethereum.org/EIPS/eip-2200
+    // Warning: this is not the most efficient implementation. The storage status can be
+    // figured out by combining only 4 checks:
+    // - original != current (dirty)
+    // - original == value (restored)
+    // - current != 0
+    // - value != 0
+
+    // Clause 1 is irrelevant:
+    // 1. "If gasleft is less than or equal to gas stipend,
+    //    fail the current call frame with ‘out of gas’ exception"
+
+    // 2. "If current value equals new value (this is a no-op)"
+    if (current == value)
+    {
+        // "SLOAD_GAS is deducted"
+        return EVMC_STORAGE_ASSIGNED;
+    }
+    // 3. "If current value does not equal new value"
+    else
+    {
+        // 3.1. "If original value equals current value
+        //      (this storage slot has not been changed by the current execution context)"
+        if (original == current)
+        {
+            // 3.1.1 "If original value is 0"
+            if (is_zero(original))
+            {
+                // "SSTORE_SET_GAS is deducted"
+                return EVMC_STORAGE_ADDED;
+            }
+            // 3.1.2 "Otherwise"
+            else
+            {
+                // "SSTORE_RESET_GAS gas is deducted"
+                auto st = EVMC_STORAGE_MODIFIED;
+
+                // "If new value is 0"
+                if (is_zero(value))
+                {
+                    // "add SSTORE_CLEARS_SCHEDULE gas to refund counter"
+                    st = EVMC_STORAGE_DELETED;
+                }
+
+                return st;
+            }
+        }
+        // 3.2. "If original value does not equal current value
+        //      (this storage slot is dirty),
+        //      SLOAD_GAS gas is deducted.
+        //      Apply both of the following clauses."
+        else
+        {
+            // Because we need to apply "both following clauses"
+            // we first collect information which clause is triggered
+            // then assign status code to combination of these clauses.
+            enum
+            {
+                None = 0,
+                RemoveClearsSchedule = 1 << 0,
+                AddClearsSchedule = 1 << 1,
+                RestoredBySet = 1 << 2,
+                RestoredByReset = 1 << 3,
+            };
+            int triggered_clauses = None;
+
+            // 3.2.1. "If original value is not 0"
+            if (!is_zero(original))
+            {
+                // 3.2.1.1. "If current value is 0"
+                if (is_zero(current))
+                {
+                    // "(also means that new value is not 0)"
+                    assert(!is_zero(value));
+                    // "remove SSTORE_CLEARS_SCHEDULE gas from refund counter"
+                    triggered_clauses |= RemoveClearsSchedule;
+                }
+                // 3.2.1.2. "If new value is 0"
+                if (is_zero(value))
+                {
+                    // "(also means that current value is not 0)"
+                    assert(!is_zero(current));
+                    // "add SSTORE_CLEARS_SCHEDULE gas to refund counter"
+                    triggered_clauses |= AddClearsSchedule;
+                }
+            }
+
+            // 3.2.2. "If original value equals new value (this storage slot is reset)"
+            // Except: we use term 'storage slot restored'.
+            if (original == value)
+            {
+                // 3.2.2.1. "If original value is 0"
+                if (is_zero(original))
+                {
+                    // "add SSTORE_SET_GAS - SLOAD_GAS to refund counter"
+                    triggered_clauses |= RestoredBySet;
+                }
+                // 3.2.2.2. "Otherwise"
+                else
+                {
+                    // "add SSTORE_RESET_GAS - SLOAD_GAS gas to refund counter"
+                    triggered_clauses |= RestoredByReset;
+                }
+            }
+
+            switch (triggered_clauses)
+            {
+            case RemoveClearsSchedule:
+                return EVMC_STORAGE_DELETED_ADDED;
+            case AddClearsSchedule:
+                return EVMC_STORAGE_MODIFIED_DELETED;
+            case RemoveClearsSchedule | RestoredByReset:
+                return EVMC_STORAGE_DELETED_RESTORED;
+            case RestoredBySet:
+                return EVMC_STORAGE_ADDED_DELETED;
+            case RestoredByReset:
+                return EVMC_STORAGE_MODIFIED_RESTORED;
+            case None:
+                return EVMC_STORAGE_ASSIGNED;
+            default:
+                assert(false);  // Other combinations are impossible.
+                return evmc_storage_status{};
+            }
+        }
+    }
+}
+
 /// Mocked account.
-struct MockedAccount
+///
+/// @tparam HashPolicy  The hash function template of the storage maps, see BasicMockedHost.
+template <template <typename> class HashPolicy>
+struct BasicMockedAccount
 {
     /// The account nonce.
     int nonce = 0;
@@ -57,10 +202,13 @@ struct MockedAccount
     uint256be balance;
 
     /// The account storage map.
-    std::unordered_map<bytes32, StorageValue> storage;
+    ///
+    /// This is the flat hash map, so inserting a new storage entry invalidates
+    /// references to the other entries.
+    flat_hash_map<bytes32, StorageValue, HashPolicy<bytes32>> storage;
 
     /// The account transient storage.
-    std::unordered_map<bytes32, bytes32> transient_storage;
+    flat_hash_map<bytes32, bytes32, HashPolicy<bytes32>> transient_storage;
 
     /// Helper method for setting balance by numeric type.
     void set_balance(uint64_t x) noexcept
@@ -71,21 +219,133 @@ struct MockedAccount
     }
 };
 
-/// Mocked EVMC Host implementation.
-class MockedHost : public Host
+/// Mocked account with the FNV-1a based storage maps.
+using MockedAccount = BasicMockedAccount<std::hash>;
+
+/// The bump allocator for short-lived byte buffers.
+///
+/// The memory is allocated in chunks and released all at once by reset(),
+/// which keeps the chunks for reuse. Therefore, after warming up,
+/// allocations do not reach the system allocator.
+class Arena
+{
+    /// The default size of a chunk.
+    static constexpr size_t chunk_size = 4096;
+
+    /// The allocated chunks.
+    std::vector<bytes> m_chunks;
+
+    /// The index of the chunk currently allocated from.
+    size_t m_current = 0;
+
+    /// The number of bytes allocated from the current chunk.
+    size_t m_offset = 0;
+
+public:
+    /// Allocates the memory of the given size.
+    /// The memory stays valid until reset() or the Arena destruction.
+    uint8_t* allocate(size_t size)
+    {
+        while (m_current < m_chunks.size())
+        {
+            auto& chunk = m_chunks[m_current];
+            if (chunk.size() - m_offset >= size)
+            {
+                auto* const ptr = &chunk[m_offset];
+                m_offset += size;
+                return ptr;
+            }
+            ++m_current;
+            m_offset = 0;
+        }
+
+        m_chunks.emplace_back(std::max(size, chunk_size), uint8_t{0});
+        m_offset = size;
+        return m_chunks.back().data();
+    }
+
+    /// Copies the array of the trivially copyable bytes-like objects to the arena.
+    ///
+    /// @return  The pointer to the copy. Null if the array is empty.
+    template <typename T>
+    const T* copy(const T* data, size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && alignof(T) == 1);
+        if (count == 0)
+            return nullptr;
+        auto* const ptr = reinterpret_cast<T*>(allocate(count * sizeof(T)));
+        std::copy_n(data, count, ptr);
+        return ptr;
+    }
+
+    /// Releases all the allocated memory at once. The chunks are kept for reuse.
+    void reset() noexcept
+    {
+        m_current = 0;
+        m_offset = 0;
+    }
+};
+
+/// The non-owning view of a contiguous array, e.g. of the memory of the evmc::Arena.
+template <typename T>
+class ArrayView
+{
+    const T* m_data = nullptr;
+    size_t m_size = 0;
+
+public:
+    /// Creates the empty view.
+    constexpr ArrayView() noexcept = default;
+
+    /// Creates the view of the array.
+    constexpr ArrayView(const T* data, size_t size) noexcept : m_data{data}, m_size{size} {}
+
+    /// The pointer to the first element.
+    constexpr const T* data() const noexcept { return m_data; }
+
+    /// The number of the elements.
+    constexpr size_t size() const noexcept { return m_size; }
+
+    /// Is the view empty.
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    /// The iterator to the first element.
+    constexpr const T* begin() const noexcept { return m_data; }
+
+    /// The iterator past the last element.
+    constexpr const T* end() const noexcept { return m_data + m_size; }
+
+    /// Returns the element at the index.
+    constexpr const T& operator[](size_t index) const noexcept { return m_data[index]; }
+
+    /// Equal operator comparing the elements.
+    friend bool operator==(const ArrayView& a, const ArrayView& b) noexcept
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+};
+
+/// The records of the calls and the LOGs of the evmc::MockedHost.
+///
+/// The call inputs and the data and the topics of the LOGs are copied to the record_arena,
+/// so recording does not allocate per call or LOG. The copy of the records has them copied
+/// to its own arena.
+class MockedCallsAndLogs
 {
 public:
     /// LOG record.
+    ///
+    /// The data and the topics are stored in the MockedHost::record_arena.
     struct log_record
     {
         /// The address of the account which created the log.
         address creator;
 
         /// The data attached to the log.
-        bytes data;
+        bytes_view data;
 
         /// The log topics.
-        std::vector<bytes32> topics;
+        ArrayView<bytes32> topics;
 
         /// Equal operator.
         bool operator==(const log_record& other) const noexcept
@@ -94,8 +354,104 @@ public:
         }
     };
 
+    /// The record of all call messages requested in the call() method.
+    /// The call inputs are copied to the MockedHost::record_arena.
+    std::vector<evmc_message> recorded_calls;
+
+    /// The default maximum number of entries in recorded_calls record.
+    /// This is arbitrary value useful in fuzzing when we don't want the record to explode.
+    static constexpr auto max_recorded_calls = 100;
+
+    /// The maximum number of entries in recorded_calls record. Unlimited if SIZE_MAX.
+    size_t recorded_calls_limit = max_recorded_calls;
+
+    /// The record of all LOGs passed to the emit_log() method.
+    std::vector<log_record> recorded_logs;
+
+    /// The arena for the data and the topics of the recorded_logs and the inputs
+    /// of the recorded_calls. The memory is reclaimed by MockedHost::clear_records(),
+    /// not when the records are reverted.
+    Arena record_arena;
+
+    MockedCallsAndLogs() = default;
+    MockedCallsAndLogs(MockedCallsAndLogs&&) = default;
+    MockedCallsAndLogs& operator=(MockedCallsAndLogs&&) = default;
+
+    /// Copy constructor. The records are copied to the arena of the copy.
+    MockedCallsAndLogs(const MockedCallsAndLogs& other)
+      : recorded_calls_limit{other.recorded_calls_limit}
+    {
+        copy_records(other);
+    }
+
+    /// Copy assignment. The records are copied to the arena of this object.
+    MockedCallsAndLogs& operator=(const MockedCallsAndLogs& other)
+    {
+        if (this != &other)
+        {
+            recorded_calls_limit = other.recorded_calls_limit;
+            recorded_calls.clear();
+            recorded_logs.clear();
+            record_arena.reset();
+            copy_records(other);
+        }
+        return *this;
+    }
+
+protected:
+    ~MockedCallsAndLogs() = default;
+
+    /// Records the call, unless over the recorded_calls_limit.
+    void record_call(const evmc_message& msg)
+    {
+        if (recorded_calls.size() < recorded_calls_limit)
+        {
+            auto& call_msg = recorded_calls.emplace_back(msg);
+            call_msg.input_data = record_arena.copy(msg.input_data, msg.input_size);
+        }
+    }
+
+    /// Records the LOG.
+    void record_log(const address& addr,
+                    const uint8_t* data,
+                    size_t data_size,
+                    const bytes32 topics[],
+                    size_t topics_count)
+    {
+        recorded_logs.push_back({addr, {record_arena.copy(data, data_size), data_size},
+                                 {record_arena.copy(topics, topics_count), topics_count}});
+    }
+
+private:
+    void copy_records(const MockedCallsAndLogs& other)
+    {
+        recorded_calls.reserve(other.recorded_calls.size());
+        for (const auto& msg : other.recorded_calls)
+            record_call(msg);
+        recorded_logs.reserve(other.recorded_logs.size());
+        for (const auto& log : other.recorded_logs)
+        {
+            record_log(log.creator, log.data.data(), log.data.size(), log.topics.data(),
+                       log.topics.size());
+        }
+    }
+};
+
+/// Mocked EVMC Host implementation.
+///
+/// @tparam HashPolicy  The hash function template of the accounts and storage maps
+///                     instantiated for evmc::address and evmc::bytes32 keys.
+///                     The default std::hash is the fastest, the evmc::seeded_hash
+///                     prevents the hash collision attacks via crafted keys.
+template <template <typename> class HashPolicy>
+class BasicMockedHost : public Host, public MockedCallsAndLogs
+{
+public:
+    /// The type of the mocked accounts.
+    using MockedAccount = BasicMockedAccount<HashPolicy>;
+
     /// The set of all accounts in the Host, organized by their addresses.
-    std::unordered_map<address, MockedAccount> accounts;
+    std::unordered_map<address, MockedAccount, HashPolicy<address>> accounts;
 
     /// The EVMC transaction context to be returned by get_tx_context().
     evmc_tx_context tx_context = {};
@@ -112,40 +468,308 @@ public:
     /// The record of all account accesses.
     mutable std::vector<address> recorded_account_accesses;
 
-    /// The maximum number of entries in recorded_account_accesses record.
+    /// The default maximum number of entries in recorded_account_accesses record.
     /// This is arbitrary value useful in fuzzing when we don't want the record to explode.
     static constexpr auto max_recorded_account_accesses = 200;
 
-    /// The record of all call messages requested in the call() method.
-    std::vector<evmc_message> recorded_calls;
-
-    /// The maximum number of entries in recorded_calls record.
-    /// This is arbitrary value useful in fuzzing when we don't want the record to explode.
-    static constexpr auto max_recorded_calls = 100;
+    /// The maximum number of entries in recorded_account_accesses record. Unlimited if SIZE_MAX.
+    size_t recorded_account_accesses_limit = max_recorded_account_accesses;
 
-    /// The record of all LOGs passed to the emit_log() method.
-    std::vector<log_record> recorded_logs;
+    /// The set of all accessed accounts, i.e. the accounts being ::EVMC_ACCESS_WARM.
+    ///
+    /// Unlike the recorded_account_accesses this is not bounded, so the access status
+    /// reported by access_account() stays correct for any number of accessed accounts.
+    mutable std::unordered_set<address, HashPolicy<address>> accessed_accounts;
 
     /// The record of all SELFDESTRUCTs from the selfdestruct() method
     /// as a map selfdestructed_address => [beneficiary1, beneficiary2, ...].
     std::unordered_map<address, std::vector<address>> recorded_selfdestructs;
 
+    /// Is the output memory provided to VMs by allocate_output().
+    /// Disabled by default, because then the outputs of the executions are only valid
+    /// as long as the MockedHost::output_arena is not reset.
+    bool output_arena_enabled = false;
+
+    /// The arena for the outputs of executions, see allocate_output().
+    Arena output_arena;
+
+    /// The execution tracer provided to VMs by get_tracer(). Not tracing if null.
+    const evmc_tracer* tracer = nullptr;
+
+    /// The identifier of a state snapshot, see snapshot().
+    using snapshot_id = size_t;
+
 private:
-    /// The copy of call inputs for the recorded_calls record.
-    std::vector<bytes> m_recorded_calls_inputs;
+    /// The index of the tx_context.initcodes for get_tx_initcode().
+    mutable TxInitcodeIndex m_tx_initcode_index;
+
+    /// The initcodes array of the m_tx_initcode_index.
+    mutable const evmc_tx_initcode* m_indexed_initcodes = nullptr;
+
+    /// The number of the initcodes of the m_tx_initcode_index.
+    mutable size_t m_indexed_initcodes_count = 0;
+
+    /// Journal entry: the account has been created.
+    struct AccountCreated
+    {
+        address addr;
+    };
+
+    /// Journal entry: the storage entry has been modified. No previous value if just created.
+    struct StorageChanged
+    {
+        address addr;
+        bytes32 key;
+        std::optional<StorageValue> prev;
+    };
+
+    /// Journal entry: the transient storage entry has been modified.
+    struct TransientStorageChanged
+    {
+        address addr;
+        bytes32 key;
+        std::optional<bytes32> prev;
+    };
+
+    /// Journal entry: the account balance has been modified.
+    struct BalanceChanged
+    {
+        address addr;
+        uint256be prev;
+    };
+
+    /// Journal entry: the account code has been modified.
+    struct CodeChanged
+    {
+        address addr;
+        bytes prev_code;
+        bytes32 prev_codehash;
+    };
+
+    /// Journal entry: the selfdestruct has been recorded.
+    struct SelfdestructRecorded
+    {
+        address addr;
+    };
+
+    /// Journal entry: the account has been accessed for the first time.
+    struct AccountAccessed
+    {
+        address addr;
+    };
+
+    using JournalEntry = std::variant<AccountCreated,
+                                      StorageChanged,
+                                      TransientStorageChanged,
+                                      BalanceChanged,
+                                      CodeChanged,
+                                      SelfdestructRecorded,
+                                      AccountAccessed>;
+
+    /// The state of the journal and of the records at the time of a snapshot.
+    struct Snapshot
+    {
+        size_t journal_size;
+        size_t num_blockhashes;
+        size_t num_account_accesses;
+        size_t num_calls;
+        size_t num_logs;
+    };
+
+    /// The journal of the state modifications. Only kept when there are active snapshots.
+    /// Mutable because account accesses are journaled also by the const Host methods.
+    mutable std::vector<JournalEntry> m_journal;
+
+    /// The active snapshots.
+    std::vector<Snapshot> m_snapshots;
+
+    /// Returns true if the state modifications must be journaled.
+    bool journaling() const noexcept { return !m_snapshots.empty(); }
+
+    /// Journal the account creation if the account does not exist.
+    /// Must be called before any access to the account which may create it.
+    void journal_account(const address& addr)
+    {
+        if (journaling() && accounts.count(addr) == 0)
+            m_journal.emplace_back(AccountCreated{addr});
+    }
+
+    /// Journal the account's storage entry before it is modified.
+    void journal_storage(const address& addr, const bytes32& key)
+    {
+        if (!journaling())
+            return;
+        journal_account(addr);
+        std::optional<StorageValue> prev;
+        if (const auto acc = accounts.find(addr); acc != accounts.end())
+        {
+            if (const auto it = acc->second.storage.find(key); it != acc->second.storage.end())
+                prev = it->second;
+        }
+        m_journal.emplace_back(StorageChanged{addr, key, prev});
+    }
+
+    /// Journal the account's transient storage entry before it is modified.
+    void journal_transient_storage(const address& addr, const bytes32& key)
+    {
+        if (!journaling())
+            return;
+        journal_account(addr);
+        std::optional<bytes32> prev;
+        if (const auto acc = accounts.find(addr); acc != accounts.end())
+        {
+            const auto& transient_storage = acc->second.transient_storage;
+            if (const auto it = transient_storage.find(key); it != transient_storage.end())
+                prev = it->second;
+        }
+        m_journal.emplace_back(TransientStorageChanged{addr, key, prev});
+    }
+
+    /// Reverts the state modification recorded in the journal entry.
+    void undo(JournalEntry& entry)
+    {
+        std::visit(
+            [this](auto& e) {
+                using T = std::decay_t<decltype(e)>;
+                if constexpr (std::is_same_v<T, AccountCreated>)
+                    accounts.erase(e.addr);
+                else if constexpr (std::is_same_v<T, StorageChanged>)
+                {
+                    auto& storage = accounts[e.addr].storage;
+                    if (e.prev)
+                        storage[e.key] = *e.prev;
+                    else
+                        storage.erase(e.key);
+                }
+                else if constexpr (std::is_same_v<T, TransientStorageChanged>)
+                {
+                    auto& transient_storage = accounts[e.addr].transient_storage;
+                    if (e.prev)
+                        transient_storage[e.key] = *e.prev;
+                    else
+                        transient_storage.erase(e.key);
+                }
+                else if constexpr (std::is_same_v<T, BalanceChanged>)
+                    accounts[e.addr].balance = e.prev;
+                else if constexpr (std::is_same_v<T, CodeChanged>)
+                {
+                    auto& acc = accounts[e.addr];
+                    acc.code = std::move(e.prev_code);
+                    acc.codehash = e.prev_codehash;
+                }
+                else if constexpr (std::is_same_v<T, SelfdestructRecorded>)
+                {
+                    auto& beneficiaries = recorded_selfdestructs[e.addr];
+                    beneficiaries.pop_back();
+                    if (beneficiaries.empty())
+                        recorded_selfdestructs.erase(e.addr);
+                }
+                else if constexpr (std::is_same_v<T, AccountAccessed>)
+                    accessed_accounts.erase(e.addr);
+            },
+            entry);
+    }
 
     /// Record an account access.
     /// @param addr  The address of the accessed account.
     void record_account_access(const address& addr) const
     {
-        if (recorded_account_accesses.empty())
-            recorded_account_accesses.reserve(max_recorded_account_accesses);
+        if (accessed_accounts.insert(addr).second && journaling())
+            m_journal.emplace_back(AccountAccessed{addr});
 
-        if (recorded_account_accesses.size() < max_recorded_account_accesses)
+        if (recorded_account_accesses.size() < recorded_account_accesses_limit)
             recorded_account_accesses.emplace_back(addr);
     }
 
 public:
+    /// Takes a snapshot of the Host state.
+    ///
+    /// Until the snapshot is reverted or discarded, the state modifications done via
+    /// the Host methods and the set_balance() and set_code() helpers are journaled
+    /// so that revert() costs O(modifications) instead of copying the whole state.
+    /// Direct modifications of the MockedHost::accounts are not journaled.
+    ///
+    /// @return  The snapshot identifier to be used with revert().
+    snapshot_id snapshot()
+    {
+        m_snapshots.push_back({m_journal.size(), recorded_blockhashes.size(),
+                               recorded_account_accesses.size(), recorded_calls.size(),
+                               recorded_logs.size()});
+        return m_snapshots.size() - 1;
+    }
+
+    /// Reverts the Host state to the given snapshot.
+    ///
+    /// This restores the journaled state modifications and truncates the records
+    /// (block hashes, account accesses, calls, logs and selfdestructs) to their state at the time
+    /// of the snapshot. The snapshots taken after the given one are discarded.
+    /// The given snapshot stays active, so it can be reverted to multiple times.
+    ///
+    /// @param id  The identifier of an active snapshot.
+    void revert(snapshot_id id)
+    {
+        assert(id < m_snapshots.size());
+        const auto snapshot = m_snapshots[id];
+
+        while (m_journal.size() > snapshot.journal_size)
+        {
+            undo(m_journal.back());
+            m_journal.pop_back();
+        }
+
+        recorded_blockhashes.resize(snapshot.num_blockhashes);
+        recorded_account_accesses.resize(snapshot.num_account_accesses);
+        recorded_calls.resize(snapshot.num_calls);
+        recorded_logs.resize(snapshot.num_logs);
+
+        m_snapshots.resize(id + 1);
+    }
+
+    /// Discards all snapshots and the journal. The current state is kept.
+    void discard_snapshots() noexcept
+    {
+        m_snapshots.clear();
+        m_journal.clear();
+    }
+
+    /// Clears the records (block hashes, account accesses, calls, logs and selfdestructs)
+    /// and resets the MockedHost::record_arena, e.g. between executions.
+    ///
+    /// The memory of the records is kept for reuse, so recording in the next executions
+    /// does not reach the system allocator. The accessed_accounts are kept. The snapshots
+    /// are discarded, because they cannot be reverted to after the records are cleared.
+    void clear_records() noexcept
+    {
+        discard_snapshots();
+        recorded_blockhashes.clear();
+        recorded_account_accesses.clear();
+        recorded_calls.clear();
+        recorded_logs.clear();
+        recorded_selfdestructs.clear();
+        record_arena.reset();
+    }
+
+    /// Sets the account's balance, creating the account if needed (journaled).
+    void set_balance(const address& addr, const uint256be& balance)
+    {
+        journal_account(addr);
+        auto& acc = accounts[addr];
+        if (journaling())
+            m_journal.emplace_back(BalanceChanged{addr, acc.balance});
+        acc.balance = balance;
+    }
+
+    /// Sets the account's code and code hash, creating the account if needed (journaled).
+    void set_code(const address& addr, bytes code, const bytes32& codehash)
+    {
+        journal_account(addr);
+        auto& acc = accounts[addr];
+        if (journaling())
+            m_journal.emplace_back(CodeChanged{addr, std::move(acc.code), acc.codehash});
+        acc.code = std::move(code);
+        acc.codehash = codehash;
+    }
+
     /// Returns true if an account exists (EVMC Host method).
     bool account_exists(const address& addr) const noexcept override
     {
@@ -179,136 +803,10 @@ public:
         // This will create the account in case it was not present.
         // This is convenient for unit testing and standalone EVM execution to preserve the
         // storage values after the execution terminates.
+        journal_storage(addr, key);
         auto& s = accounts[addr].storage[key];
 
-        // Follow the EIP-2200 specification as closely as possible.
-        // https://eips.ethereum.org/EIPS/eip-2200
-        // Warning: this is not the most efficient implementation. The storage status can be
-        // figured out by combining only 4 checks:
-        // - original != current (dirty)
-        // - original == value (restored)
-        // - current != 0
-        // - value != 0
-        const auto status = [&original = s.original, &current = s.current, &value]() {
-            // Clause 1 is irrelevant:
-            // 1. "If gasleft is less than or equal to gas stipend,
-            //    fail the current call frame with ‘out of gas’ exception"
-
-            // 2. "If current value equals new value (this is a no-op)"
-            if (current == value)
-            {
-                // "SLOAD_GAS is deducted"
-                return EVMC_STORAGE_ASSIGNED;
-            }
-            // 3. "If current value does not equal new value"
-            else
-            {
-                // 3.1. "If original value equals current value
-                //      (this storage slot has not been changed by the current execution context)"
-                if (original == current)
-                {
-                    // 3.1.1 "If original value is 0"
-                    if (is_zero(original))
-                    {
-                        // "SSTORE_SET_GAS is deducted"
-                        return EVMC_STORAGE_ADDED;
-                    }
-                    // 3.1.2 "Otherwise"
-                    else
-                    {
-                        // "SSTORE_RESET_GAS gas is deducted"
-                        auto st = EVMC_STORAGE_MODIFIED;
-
-                        // "If new value is 0"
-                        if (is_zero(value))
-                        {
-                            // "add SSTORE_CLEARS_SCHEDULE gas to refund counter"
-                            st = EVMC_STORAGE_DELETED;
-                        }
-
-                        return st;
-                    }
-                }
-                // 3.2. "If original value does not equal current value
-                //      (this storage slot is dirty),
-                //      SLOAD_GAS gas is deducted.
-                //      Apply both of the following clauses."
-                else
-                {
-                    // Because we need to apply "both following clauses"
-                    // we first collect information which clause is triggered
-                    // then assign status code to combination of these clauses.
-                    enum
-                    {
-                        None = 0,
-                        RemoveClearsSchedule = 1 << 0,
-                        AddClearsSchedule = 1 << 1,
-                        RestoredBySet = 1 << 2,
-                        RestoredByReset = 1 << 3,
-                    };
-                    int triggered_clauses = None;
-
-                    // 3.2.1. "If original value is not 0"
-                    if (!is_zero(original))
-                    {
-                        // 3.2.1.1. "If current value is 0"
-                        if (is_zero(current))
-                        {
-                            // "(also means that new value is not 0)"
-                            assert(!is_zero(value));
-                            // "remove SSTORE_CLEARS_SCHEDULE gas from refund counter"
-                            triggered_clauses |= RemoveClearsSchedule;
-                        }
-                        // 3.2.1.2. "If new value is 0"
-                        if (is_zero(value))
-                        {
-                            // "(also means that current value is not 0)"
-                            assert(!is_zero(current));
-                            // "add SSTORE_CLEARS_SCHEDULE gas to refund counter"
-                            triggered_clauses |= AddClearsSchedule;
-                        }
-                    }
-
-                    // 3.2.2. "If original value equals new value (this storage slot is reset)"
-                    // Except: we use term 'storage slot restored'.
-                    if (original == value)
-                    {
-                        // 3.2.2.1. "If original value is 0"
-                        if (is_zero(original))
-                        {
-                            // "add SSTORE_SET_GAS - SLOAD_GAS to refund counter"
-                            triggered_clauses |= RestoredBySet;
-                        }
-                        // 3.2.2.2. "Otherwise"
-                        else
-                        {
-                            // "add SSTORE_RESET_GAS - SLOAD_GAS gas to refund counter"
-                            triggered_clauses |= RestoredByReset;
-                        }
-                    }
-
-                    switch (triggered_clauses)
-                    {
-                    case RemoveClearsSchedule:
-                        return EVMC_STORAGE_DELETED_ADDED;
-                    case AddClearsSchedule:
-                        return EVMC_STORAGE_MODIFIED_DELETED;
-                    case RemoveClearsSchedule | RestoredByReset:
-                        return EVMC_STORAGE_DELETED_RESTORED;
-                    case RestoredBySet:
-                        return EVMC_STORAGE_ADDED_DELETED;
-                    case RestoredByReset:
-                        return EVMC_STORAGE_MODIFIED_RESTORED;
-                    case None:
-                        return EVMC_STORAGE_ASSIGNED;
-                    default:
-                        assert(false);  // Other combinations are impossible.
-                        return evmc_storage_status{};
-                    }
-                }
-            }
-        }();
-
+        const auto status = compute_storage_status(s.original, s.current, value);
         s.current = value;  // Finally update the current storage value.
         return status;
     }
@@ -367,10 +865,32 @@ public:
         return n;
     }
 
+    /// Get the view of the account's code (EVMC host method).
+    ///
+    /// The view references the MockedAccount::code directly and stays valid
+    /// as long as the account's code is not modified.
+    bool get_code_view(const address& addr, evmc_code_view& view) const noexcept override
+    {
+        record_account_access(addr);
+        const auto it = accounts.find(addr);
+        if (it == accounts.end())
+        {
+            view = {};
+            return true;
+        }
+
+        view.code = it->second.code.data();
+        view.code_size = it->second.code.size();
+        view.code_hash = it->second.codehash;
+        return true;
+    }
+
     /// Selfdestruct the account (EVMC host method).
     bool selfdestruct(const address& addr, const address& beneficiary) noexcept override
     {
         record_account_access(addr);
+        if (journaling())
+            m_journal.emplace_back(SelfdestructRecorded{addr});
         auto& beneficiaries = recorded_selfdestructs[addr];
         beneficiaries.emplace_back(beneficiary);
         return beneficiaries.size() == 1;
@@ -381,23 +901,7 @@ public:
     {
         record_account_access(msg.recipient);
 
-        if (recorded_calls.empty())
-        {
-            recorded_calls.reserve(max_recorded_calls);
-            m_recorded_calls_inputs.reserve(max_recorded_calls);  // Iterators will not invalidate.
-        }
-
-        if (recorded_calls.size() < max_recorded_calls)
-        {
-            recorded_calls.emplace_back(msg);
-            auto& call_msg = recorded_calls.back();
-            if (call_msg.input_size > 0)
-            {
-                m_recorded_calls_inputs.emplace_back(call_msg.input_data, call_msg.input_size);
-                const auto& input_copy = m_recorded_calls_inputs.back();
-                call_msg.input_data = input_copy.data();
-            }
-        }
+        record_call(msg);
         return Result{call_result};
     }
 
@@ -418,13 +922,14 @@ public:
                   const bytes32 topics[],
                   size_t topics_count) noexcept override
     {
-        recorded_logs.push_back({addr, {data, data_size}, {topics, topics + topics_count}});
+        record_log(addr, data, data_size, topics, topics_count);
     }
 
     /// Record an account access.
     ///
     /// This method is required by EIP-2929 introduced in ::EVMC_BERLIN. It will record the account
-    /// access in MockedHost::recorded_account_accesses and return previous access status.
+    /// access in MockedHost::accessed_accounts and MockedHost::recorded_account_accesses
+    /// and return previous access status.
     /// This methods returns ::EVMC_ACCESS_WARM for known addresses of precompiles.
     /// The EIP-2929 specifies that evmc_message::sender and evmc_message::recipient are always
     /// ::EVMC_ACCESS_WARM. Therefore, you should init the MockedHost with:
@@ -440,9 +945,7 @@ public:
     evmc_access_status access_account(const address& addr) noexcept override
     {
         // Check if the address have been already accessed.
-        const auto already_accessed =
-            std::find(recorded_account_accesses.begin(), recorded_account_accesses.end(), addr) !=
-            recorded_account_accesses.end();
+        const auto already_accessed = accessed_accounts.count(addr) != 0;
 
         record_account_access(addr);
 
@@ -470,6 +973,7 @@ public:
     ///              the ::EVMC_ACCESS_COLD otherwise.
     evmc_access_status access_storage(const address& addr, const bytes32& key) noexcept override
     {
+        journal_storage(addr, key);
         auto& value = accounts[addr].storage[key];
         const auto access_status = value.access_status;
         value.access_status = EVMC_ACCESS_WARM;
@@ -505,7 +1009,62 @@ public:
                                const bytes32& value) noexcept override
     {
         record_account_access(addr);
+        journal_transient_storage(addr, key);
         accounts[addr].transient_storage[key] = value;
     }
+
+    /// Get the storage values for multiple keys at once (EVMC Host method).
+    ///
+    /// Each entry is resolved and recorded exactly as by get_storage().
+    ///
+    /// @param keys    The array of storage entries to query.
+    /// @param values  The output array of storage values.
+    /// @param count   The number of entries in @p keys and @p values.
+    void get_storage_batch(const evmc_storage_key keys[],
+                           bytes32 values[],
+                           size_t count) const noexcept override
+    {
+        for (size_t i = 0; i < count; ++i)
+            values[i] = get_storage(keys[i].address, keys[i].key);
+    }
+
+    /// Allocate memory for the execution output (EVMC Host method).
+    ///
+    /// If MockedHost::output_arena_enabled the memory is allocated from the
+    /// MockedHost::output_arena and stays valid until the arena is reset. Otherwise, declines.
+    ///
+    /// @param size  The size of the output.
+    /// @return      The pointer to the output memory or null.
+    uint8_t* allocate_output(size_t size) noexcept override
+    {
+        if (!output_arena_enabled)
+            return nullptr;
+        return output_arena.allocate(size);
+    }
+
+    /// Get the execution tracer (EVMC Host method).
+    ///
+    /// @return  The MockedHost::tracer.
+    const evmc_tracer* get_tracer() noexcept override { return tracer; }
+
+    /// Find the transaction initcode by its hash (EVMC Host method).
+    ///
+    /// The index of the tx_context.initcodes is built on the first lookup and rebuilt
+    /// when the tx_context.initcodes array is replaced. Modifying the array in place
+    /// requires replacing the array pointer or the count.
+    const evmc_tx_initcode* get_tx_initcode(const bytes32& hash) const noexcept override
+    {
+        if (m_indexed_initcodes != tx_context.initcodes ||
+            m_indexed_initcodes_count != tx_context.initcodes_count)
+        {
+            m_tx_initcode_index = TxInitcodeIndex{tx_context};
+            m_indexed_initcodes = tx_context.initcodes;
+            m_indexed_initcodes_count = tx_context.initcodes_count;
+        }
+        return m_tx_initcode_index.find(hash);
+    }
 };
+
+/// Mocked EVMC Host implementation with the FNV-1a based hash maps.
+using MockedHost = BasicMockedHost<std::hash>;
 }  // namespace evmc
@@ -0,0 +1,120 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.hpp>
+#include <evmc/mocked_host.hpp>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace evmc::parallel
+{
+/// The transaction of a block to be executed by the Executor.
+struct Transaction
+{
+    /// The message of the transaction.
+    ///
+    /// The message input must stay valid for the duration of Executor::execute().
+    evmc_message msg{};
+
+    /// The code to be executed.
+    bytes_view code;
+};
+
+/// The outcome of a transaction execution.
+struct TransactionResult
+{
+    /// The execution result of the final (committed) execution.
+    Result result;
+
+    /// The LOGs emitted by the transaction, see MockedHost::recorded_logs.
+    std::vector<MockedHost::log_record> logs;
+
+    /// The memory of the data and the topics of the logs, see MockedHost::record_arena.
+    Arena log_arena;
+
+    /// The SELFDESTRUCTs of the transaction, see MockedHost::recorded_selfdestructs.
+    std::unordered_map<address, std::vector<address>> selfdestructs;
+
+    /// The number of times the transaction has been executed. 1 if it had no conflicts.
+    unsigned incarnations = 0;
+
+    TransactionResult() = default;
+    TransactionResult(TransactionResult&&) = default;
+    TransactionResult& operator=(TransactionResult&&) = default;
+
+    /// Copy constructor. The output and the logs are copied to the memory of this object
+    /// so the copy does not reference the memory of @p other.
+    TransactionResult(const TransactionResult& other)
+      : result{other.result.status_code, other.result.gas_left, other.result.gas_refund,
+               other.result.output_data, other.result.output_size},
+        selfdestructs{other.selfdestructs},
+        incarnations{other.incarnations}
+    {
+        result.create_address = other.result.create_address;
+        logs.reserve(other.logs.size());
+        for (const auto& log : other.logs)
+        {
+            logs.push_back({log.creator,
+                            {log_arena.copy(log.data.data(), log.data.size()), log.data.size()},
+                            {log_arena.copy(log.topics.data(), log.topics.size()),
+                             log.topics.size()}});
+        }
+    }
+
+    /// Copy assignment, see the copy constructor.
+    TransactionResult& operator=(const TransactionResult& other)
+    {
+        if (this != &other)
+            *this = TransactionResult{other};
+        return *this;
+    }
+};
+
+/// The optimistic-concurrency (Block-STM style) executor of the transactions of a block.
+///
+/// The transactions are executed speculatively in parallel by a pool of threads,
+/// each against the multi-version view of the storage where a transaction sees the latest
+/// writes of the transactions preceding it in the block. The storage reads and writes
+/// are recorded through the Host interface. The transactions are committed in the block order:
+/// a transaction is valid if all the values it has read are still the ones visible to it,
+/// otherwise it is re-executed. An executed transaction which has read a location
+/// written by a re-executed one is re-scheduled without waiting for its validation.
+///
+/// Only the account storage is versioned. The other account data is read from the initial state
+/// (it is not modified by the Host methods). The transient storage, the warm access sets
+/// and the records of the calls, logs and selfdestructs are transaction-local.
+class Executor
+{
+    VM& m_vm;
+    unsigned m_num_threads;
+
+public:
+    /// Constructor.
+    ///
+    /// @param vm           The VM to execute the transactions with. Must support concurrent
+    ///                     executions.
+    /// @param num_threads  The number of threads to execute the transactions on,
+    ///                     the calling thread included.
+    explicit Executor(VM& vm, unsigned num_threads = std::thread::hardware_concurrency()) noexcept
+      : m_vm{vm}, m_num_threads{num_threads != 0 ? num_threads : 1}
+    {}
+
+    /// Executes the transactions of a block.
+    ///
+    /// The state is only read during the execution. Afterwards the storage writes of all
+    /// the transactions are applied to the state in the block order as both the current
+    /// and the original values, i.e. as if the block had been executed sequentially.
+    ///
+    /// @param state  The state of the accounts before the block. Also provides the transaction
+    ///               context, the block hash and the call result, see MockedHost.
+    /// @param rev    The EVM revision.
+    /// @param txs    The transactions of the block.
+    /// @return       The results of the transactions, in the block order.
+    std::vector<TransactionResult> execute(MockedHost& state,
+                                           evmc_revision rev,
+                                           const std::vector<Transaction>& txs);
+};
+}  // namespace evmc::parallel
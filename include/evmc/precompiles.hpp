@@ -0,0 +1,258 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.h>
+#include <evmc/helpers.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/// The precompiled contracts dispatch table.
+///
+/// A Host can route the calls to the precompiled contracts in-process with find() and execute(),
+/// without going through evmc_vm::execute(). The example_precompiles_vm is built on it.
+///
+/// The gas costs of all the contracts in the table are implemented, but only the identity
+/// contract is executed. The execution of ecrecover, sha256, ripemd160, expmod, ecadd, ecmul,
+/// ecpairing, blake2f and point_evaluation is missing: the PrecompileTraits::execute is null
+/// and execute() returns ::EVMC_REJECTED, so the Host must execute them by other means.
+/// The BLS12-381 contracts of Prague (EIP-2537) are not in the table.
+namespace evmc
+{
+namespace precompiles
+{
+/// The gas cost function of a precompiled contract.
+using GasCostFn = int64_t (*)(const uint8_t* input, size_t input_size, evmc_revision rev);
+
+/// The execution function of a precompiled contract.
+/// Returns the result with the status code and the output. The gas is handled by execute().
+using ExecuteFn = evmc_result (*)(const uint8_t* input, size_t input_size);
+
+/// The description of a precompiled contract.
+struct PrecompileTraits
+{
+    /// The name of the precompiled contract.
+    const char* name;
+
+    /// The first revision the precompiled contract is available in.
+    evmc_revision since;
+
+    /// The gas cost function.
+    GasCostFn gas_cost;
+
+    /// The execution function. Null if the precompiled contract is not implemented.
+    ExecuteFn execute;
+};
+
+namespace internal
+{
+/// The gas cost returned when the cost does not fit int64_t.
+constexpr auto max_gas = std::numeric_limits<int64_t>::max();
+
+/// Returns the number of 32-byte words needed to fit the given number of bytes.
+constexpr int64_t num_words(size_t size) noexcept
+{
+    return static_cast<int64_t>((size + 31) / 32);
+}
+
+/// Reads the 32-byte big-endian word at the given offset of the input (zero padded)
+/// and returns it if it fits uint32_t, or the uint32_t max value otherwise.
+inline uint32_t load_length(const uint8_t* input, size_t input_size, size_t offset) noexcept
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < 32; ++i)
+    {
+        const auto byte = offset + i < input_size ? input[offset + i] : uint8_t{0};
+        if (i < 28 && byte != 0)
+            return std::numeric_limits<uint32_t>::max();
+        value = (value << 8) | byte;
+    }
+    return static_cast<uint32_t>(value);
+}
+
+/// Returns the bit length of the big-endian number of the given size at the input offset
+/// (zero padded), limited to the first 32 bytes.
+inline uint64_t bit_length(const uint8_t* input,
+                           size_t input_size,
+                           size_t offset,
+                           size_t size) noexcept
+{
+    size = std::min(size, size_t{32});
+    for (size_t i = 0; i < size; ++i)
+    {
+        const auto byte = offset + i < input_size ? input[offset + i] : uint8_t{0};
+        if (byte != 0)
+        {
+            uint64_t bits = 0;
+            for (auto b = byte; b != 0; b = static_cast<uint8_t>(b >> 1))
+                ++bits;
+            return (size - i - 1) * 8 + bits;
+        }
+    }
+    return 0;
+}
+
+/// Returns a * b / d or max_gas if the result (or the product) does not fit.
+inline int64_t mul_div(uint64_t a, uint64_t b, uint64_t d) noexcept
+{
+    if (b != 0 && a > std::numeric_limits<uint64_t>::max() / b)
+        return max_gas;
+    const auto r = a * b / d;
+    return r > static_cast<uint64_t>(max_gas) ? max_gas : static_cast<int64_t>(r);
+}
+
+inline int64_t ecrecover_gas(const uint8_t*, size_t, evmc_revision) noexcept
+{
+    return 3000;
+}
+
+inline int64_t sha256_gas(const uint8_t*, size_t input_size, evmc_revision) noexcept
+{
+    return 60 + 12 * num_words(input_size);
+}
+
+inline int64_t ripemd160_gas(const uint8_t*, size_t input_size, evmc_revision) noexcept
+{
+    return 600 + 120 * num_words(input_size);
+}
+
+inline int64_t identity_gas(const uint8_t*, size_t input_size, evmc_revision) noexcept
+{
+    return 15 + 3 * num_words(input_size);
+}
+
+/// The EXPMOD gas cost from EIP-198, repriced by EIP-2565 in Berlin.
+inline int64_t expmod_gas(const uint8_t* input, size_t input_size, evmc_revision rev) noexcept
+{
+    const uint64_t base_len = load_length(input, input_size, 0);
+    const uint64_t exp_len = load_length(input, input_size, 32);
+    const uint64_t mod_len = load_length(input, input_size, 64);
+    constexpr uint64_t length_limit = std::numeric_limits<uint32_t>::max();
+    if (base_len == length_limit || exp_len == length_limit || mod_len == length_limit)
+        return max_gas;
+
+    const auto exp_head_bits = bit_length(input, input_size, 96 + base_len, exp_len);
+    const auto exp_head_adjusted = exp_head_bits != 0 ? exp_head_bits - 1 : 0;
+    const auto adjusted_exp_len =
+        std::max(exp_len <= 32 ? exp_head_adjusted : 8 * (exp_len - 32) + exp_head_adjusted,
+                 uint64_t{1});
+
+    const auto x = std::max(base_len, mod_len);
+    if (rev >= EVMC_BERLIN)
+    {
+        const auto words = (x + 7) / 8;
+        return std::max(int64_t{200}, mul_div(words * words, adjusted_exp_len, 3));
+    }
+
+    uint64_t complexity = 0;
+    if (x <= 64)
+        complexity = x * x;
+    else if (x <= 1024)
+        complexity = x * x / 4 + 96 * x - 3072;
+    else
+        complexity = x * x / 16 + 480 * x - 199680;
+    return mul_div(complexity, adjusted_exp_len, 20);
+}
+
+inline int64_t bn_add_gas(const uint8_t*, size_t, evmc_revision rev) noexcept
+{
+    return rev >= EVMC_ISTANBUL ? 150 : 500;
+}
+
+inline int64_t bn_mul_gas(const uint8_t*, size_t, evmc_revision rev) noexcept
+{
+    return rev >= EVMC_ISTANBUL ? 6000 : 40000;
+}
+
+inline int64_t bn_pairing_gas(const uint8_t*, size_t input_size, evmc_revision rev) noexcept
+{
+    const auto k = static_cast<int64_t>(input_size / 192);
+    return rev >= EVMC_ISTANBUL ? 45000 + 34000 * k : 100000 + 80000 * k;
+}
+
+/// The BLAKE2 compression function F gas cost (EIP-152): 1 gas per round.
+inline int64_t blake2f_gas(const uint8_t* input, size_t input_size, evmc_revision) noexcept
+{
+    if (input_size < 4)
+        return 0;
+    return (int64_t{input[0]} << 24) | (int64_t{input[1]} << 16) | (int64_t{input[2]} << 8) |
+           int64_t{input[3]};
+}
+
+inline int64_t point_evaluation_gas(const uint8_t*, size_t, evmc_revision) noexcept
+{
+    return 50000;
+}
+
+inline evmc_result identity_execute(const uint8_t* input, size_t input_size) noexcept
+{
+    return evmc_make_result(EVMC_SUCCESS, 0, 0, input, input_size);
+}
+}  // namespace internal
+
+/// The table of the precompiled contracts indexed by the address.
+/// The entry at index 0 is not a precompiled contract.
+constexpr PrecompileTraits traits[] = {
+    {nullptr, EVMC_MAX_REVISION, nullptr, nullptr},
+    {"ecrecover", EVMC_FRONTIER, internal::ecrecover_gas, nullptr},
+    {"sha256", EVMC_FRONTIER, internal::sha256_gas, nullptr},
+    {"ripemd160", EVMC_FRONTIER, internal::ripemd160_gas, nullptr},
+    {"identity", EVMC_FRONTIER, internal::identity_gas, internal::identity_execute},
+    {"expmod", EVMC_BYZANTIUM, internal::expmod_gas, nullptr},
+    {"ecadd", EVMC_BYZANTIUM, internal::bn_add_gas, nullptr},
+    {"ecmul", EVMC_BYZANTIUM, internal::bn_mul_gas, nullptr},
+    {"ecpairing", EVMC_BYZANTIUM, internal::bn_pairing_gas, nullptr},
+    {"blake2f", EVMC_ISTANBUL, internal::blake2f_gas, nullptr},
+    {"point_evaluation", EVMC_CANCUN, internal::point_evaluation_gas, nullptr},
+};
+
+/// The number of entries in the traits table.
+constexpr size_t num_traits = sizeof(traits) / sizeof(traits[0]);
+
+/// Finds the precompiled contract at the given address available in the given revision.
+///
+/// @param addr  The address of the contract.
+/// @param rev   The EVM revision.
+/// @return      The pointer to the precompiled contract description or null if the address is
+///              not the address of a precompiled contract in this revision.
+inline const PrecompileTraits* find(const evmc_address& addr, evmc_revision rev) noexcept
+{
+    constexpr auto id_pos = sizeof(addr.bytes) - 1;
+    if (std::any_of(&addr.bytes[0], &addr.bytes[id_pos], [](uint8_t x) { return x != 0; }))
+        return nullptr;
+    const auto id = addr.bytes[id_pos];
+    if (id == 0 || id >= num_traits || rev < traits[id].since)
+        return nullptr;
+    return &traits[id];
+}
+
+/// Executes the precompiled contract.
+///
+/// The gas cost is checked first. The precompiled contracts not implemented
+/// return ::EVMC_REJECTED.
+///
+/// @param precompile  The precompiled contract description, see find().
+/// @param rev         The EVM revision.
+/// @param msg         The call message.
+/// @return            The execution result.
+inline evmc_result execute(const PrecompileTraits& precompile,
+                           evmc_revision rev,
+                           const evmc_message& msg) noexcept
+{
+    if (precompile.execute == nullptr)
+        return evmc_make_result(EVMC_REJECTED, 0, 0, nullptr, 0);
+
+    const auto gas_cost = precompile.gas_cost(msg.input_data, msg.input_size, rev);
+    if (gas_cost > msg.gas)
+        return evmc_make_result(EVMC_OUT_OF_GAS, 0, 0, nullptr, 0);
+
+    auto result = precompile.execute(msg.input_data, msg.input_size);
+    if (result.status_code == EVMC_SUCCESS)
+        result.gas_left = msg.gas - gas_cost;
+    return result;
+}
+}  // namespace precompiles
+}  // namespace evmc
@@ -0,0 +1,304 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.hpp>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace evmc
+{
+/// The entry of the EIP-2930 access list.
+struct AccessListEntry
+{
+    /// The address of the account.
+    address addr;
+
+    /// The storage keys of the account, in ascending order.
+    std::vector<bytes32> storage_keys;
+
+    /// Equal operator.
+    bool operator==(const AccessListEntry& other) const noexcept
+    {
+        return addr == other.addr && storage_keys == other.storage_keys;
+    }
+};
+
+/// The EIP-2930 access list.
+using AccessList = std::vector<AccessListEntry>;
+
+/// The Host decorator recording the state accessed through it.
+///
+/// Forwards all the Host methods to the wrapped Host and records the accessed accounts
+/// and storage slots. Each record is a sorted vector without duplicates, so
+/// the memory is bounded by the number of distinct accesses and the records can be
+/// intersected (e.g. for the conflict detection) and searched with the standard algorithms.
+///
+/// An account is recorded as accessed by any Host method taking its address.
+/// The storage slots accessed by access_storage() are recorded as read, because the access
+/// precedes both SLOAD and SSTORE and the SSTORE gas cost depends on the stored value.
+/// The balances of the sender and the recipient of a value-transferring call and
+/// of the account and the beneficiary of a selfdestruct are recorded as written.
+/// The value of a DELEGATECALL is only the apparent value, it is not transferred,
+/// so DELEGATECALL records no balance writes.
+/// The transient storage is not recorded.
+class RecordingHost : public Host
+{
+    HostInterface& m_host;
+
+    mutable std::vector<address> m_accounts;
+    mutable std::vector<address> m_balance_reads;
+    std::vector<address> m_balance_writes;
+    mutable std::vector<address> m_code_reads;
+    mutable std::vector<StorageSlot> m_storage_reads;
+    std::vector<StorageSlot> m_storage_writes;
+
+    /// Inserts the value into the sorted record, unless already present.
+    template <typename T>
+    static void record(std::vector<T>& sorted, const T& value)
+    {
+        const auto it = std::lower_bound(sorted.begin(), sorted.end(), value);
+        if (it == sorted.end() || value < *it)
+            sorted.insert(it, value);
+    }
+
+    void record_account(const address& addr) const { record(m_accounts, addr); }
+
+    void record_code_read(const address& addr) const
+    {
+        record_account(addr);
+        record(m_code_reads, addr);
+    }
+
+    void record_storage_read(const address& addr, const bytes32& key) const
+    {
+        record_account(addr);
+        record(m_storage_reads, {addr, key});
+    }
+
+    void record_balance_write(const address& addr)
+    {
+        record_account(addr);
+        record(m_balance_writes, addr);
+    }
+
+    /// Returns true if the message transfers its value from the sender to the recipient.
+    static bool transfers_value(const evmc_message& msg) noexcept
+    {
+        const auto kind_transfers = msg.kind == EVMC_CALL || msg.kind == EVMC_CALLCODE ||
+                                    msg.kind == EVMC_CREATE || msg.kind == EVMC_CREATE2 ||
+                                    msg.kind == EVMC_EOFCREATE;
+        return kind_transfers && !is_zero(msg.value);
+    }
+
+public:
+    /// Constructor.
+    /// @param host  The Host to forward the methods to. Must outlive the RecordingHost.
+    explicit RecordingHost(HostInterface& host) noexcept : m_host{host} {}
+
+    /// All the accessed accounts.
+    const std::vector<address>& accounts() const noexcept { return m_accounts; }
+
+    /// The accounts which balances have been read.
+    const std::vector<address>& balance_reads() const noexcept { return m_balance_reads; }
+
+    /// The accounts which balances have been modified.
+    const std::vector<address>& balance_writes() const noexcept { return m_balance_writes; }
+
+    /// The accounts which code (also the code size or the code hash) has been accessed.
+    const std::vector<address>& code_reads() const noexcept { return m_code_reads; }
+
+    /// The storage slots read or accessed.
+    const std::vector<StorageSlot>& storage_reads() const noexcept { return m_storage_reads; }
+
+    /// The storage slots modified.
+    const std::vector<StorageSlot>& storage_writes() const noexcept { return m_storage_writes; }
+
+    /// Clears all the records, e.g. before the next transaction.
+    void clear() noexcept
+    {
+        m_accounts.clear();
+        m_balance_reads.clear();
+        m_balance_writes.clear();
+        m_code_reads.clear();
+        m_storage_reads.clear();
+        m_storage_writes.clear();
+    }
+
+    /// Builds the EIP-2930 access list of the recorded accesses.
+    ///
+    /// Lists all the accessed accounts with their read or modified storage keys, ordered by
+    /// the addresses. Like in the eth_createAccessList, the excluded accounts (usually
+    /// the transaction sender, the recipient and the precompiles, which are warm anyway)
+    /// are omitted unless they have any storage keys accessed.
+    ///
+    /// @param excluded  The accounts to omit from the list if they have no storage keys.
+    /// @return          The access list.
+    AccessList access_list(const std::vector<address>& excluded = {}) const
+    {
+        std::vector<StorageSlot> slots;
+        slots.reserve(m_storage_reads.size() + m_storage_writes.size());
+        std::set_union(m_storage_reads.begin(), m_storage_reads.end(), m_storage_writes.begin(),
+                       m_storage_writes.end(), std::back_inserter(slots));
+
+        AccessList list;
+        auto slot = slots.begin();
+        for (const auto& addr : m_accounts)
+        {
+            AccessListEntry entry{addr, {}};
+            for (; slot != slots.end() && slot->addr == addr; ++slot)
+                entry.storage_keys.push_back(slot->key);
+
+            if (entry.storage_keys.empty() &&
+                std::find(excluded.begin(), excluded.end(), addr) != excluded.end())
+                continue;
+            list.emplace_back(std::move(entry));
+        }
+        return list;
+    }
+
+    bool account_exists(const address& addr) const noexcept override
+    {
+        record_account(addr);
+        return m_host.account_exists(addr);
+    }
+
+    bytes32 get_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        record_storage_read(addr, key);
+        return m_host.get_storage(addr, key);
+    }
+
+    evmc_storage_status set_storage(const address& addr,
+                                    const bytes32& key,
+                                    const bytes32& value) noexcept override
+    {
+        record_account(addr);
+        record(m_storage_writes, {addr, key});
+        return m_host.set_storage(addr, key, value);
+    }
+
+    uint256be get_balance(const address& addr) const noexcept override
+    {
+        record_account(addr);
+        record(m_balance_reads, addr);
+        return m_host.get_balance(addr);
+    }
+
+    size_t get_code_size(const address& addr) const noexcept override
+    {
+        record_code_read(addr);
+        return m_host.get_code_size(addr);
+    }
+
+    bytes32 get_code_hash(const address& addr) const noexcept override
+    {
+        record_code_read(addr);
+        return m_host.get_code_hash(addr);
+    }
+
+    size_t copy_code(const address& addr,
+                     size_t code_offset,
+                     uint8_t* buffer_data,
+                     size_t buffer_size) const noexcept override
+    {
+        record_code_read(addr);
+        return m_host.copy_code(addr, code_offset, buffer_data, buffer_size);
+    }
+
+    bool selfdestruct(const address& addr, const address& beneficiary) noexcept override
+    {
+        record_balance_write(addr);
+        record_balance_write(beneficiary);
+        return m_host.selfdestruct(addr, beneficiary);
+    }
+
+    Result call(const evmc_message& msg) noexcept override
+    {
+        record_account(msg.recipient);
+        if (msg.kind == EVMC_DELEGATECALL || msg.kind == EVMC_CALLCODE)
+            record_account(msg.code_address);
+        if (transfers_value(msg))
+        {
+            record_balance_write(msg.sender);
+            record_balance_write(msg.recipient);
+        }
+
+        auto result = m_host.call(msg);
+        if ((msg.kind == EVMC_CREATE || msg.kind == EVMC_CREATE2 || msg.kind == EVMC_EOFCREATE) &&
+            result.status_code == EVMC_SUCCESS)
+        {
+            record_account(result.create_address);
+            if (!is_zero(msg.value))
+                record_balance_write(result.create_address);
+        }
+        return result;
+    }
+
+    evmc_tx_context get_tx_context() const noexcept override { return m_host.get_tx_context(); }
+
+    bytes32 get_block_hash(int64_t block_number) const noexcept override
+    {
+        return m_host.get_block_hash(block_number);
+    }
+
+    void emit_log(const address& addr,
+                  const uint8_t* data,
+                  size_t data_size,
+                  const bytes32 topics[],
+                  size_t topics_count) noexcept override
+    {
+        m_host.emit_log(addr, data, data_size, topics, topics_count);
+    }
+
+    evmc_access_status access_account(const address& addr) noexcept override
+    {
+        record_account(addr);
+        return m_host.access_account(addr);
+    }
+
+    evmc_access_status access_storage(const address& addr, const bytes32& key) noexcept override
+    {
+        record_storage_read(addr, key);
+        return m_host.access_storage(addr, key);
+    }
+
+    bytes32 get_transient_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        return m_host.get_transient_storage(addr, key);
+    }
+
+    void set_transient_storage(const address& addr,
+                               const bytes32& key,
+                               const bytes32& value) noexcept override
+    {
+        m_host.set_transient_storage(addr, key, value);
+    }
+
+    void get_storage_batch(const evmc_storage_key keys[],
+                           bytes32 values[],
+                           size_t count) const noexcept override
+    {
+        for (size_t i = 0; i < count; ++i)
+            record_storage_read(keys[i].address, keys[i].key);
+        m_host.get_storage_batch(keys, values, count);
+    }
+
+    bool get_code_view(const address& addr, evmc_code_view& view) const noexcept override
+    {
+        record_code_read(addr);
+        return m_host.get_code_view(addr, view);
+    }
+
+    uint8_t* allocate_output(size_t size) noexcept override { return m_host.allocate_output(size); }
+
+    const evmc_tracer* get_tracer() noexcept override { return m_host.get_tracer(); }
+
+    const evmc_tx_initcode* get_tx_initcode(const bytes32& hash) const noexcept override
+    {
+        return m_host.get_tx_initcode(hash);
+    }
+};
+}  // namespace evmc
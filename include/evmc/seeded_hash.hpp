@@ -0,0 +1,128 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.hpp>
+#include <chrono>
+#include <cstdint>
+
+namespace evmc
+{
+/// The hash mixing functions of the wyhash (https://github.com/wangyi-fudan/wyhash).
+namespace wyhash
+{
+constexpr uint64_t secret0 = 0xa0761d6478bd642f;  ///< The 1st wyhash secret.
+constexpr uint64_t secret1 = 0xe7037ed1a0b428db;  ///< The 2nd wyhash secret.
+constexpr uint64_t secret2 = 0x8ebc6af09c88c6e3;  ///< The 3rd wyhash secret.
+constexpr uint64_t secret3 = 0x589965cc75374cc3;  ///< The 4th wyhash secret.
+
+/// Multiplies the 64-bit inputs and folds the 128-bit product by xoring its halves.
+///
+/// The result is 0 if any of the inputs is 0, so a seeded hash must mix the seed into
+/// both inputs. Otherwise, the input words cancelling the constant operand make
+/// the result independent of the seed and of the other input.
+inline constexpr uint64_t mix(uint64_t a, uint64_t b) noexcept
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ using uint128 = unsigned __int128;
+    const auto p = uint128{a} * b;
+    return static_cast<uint64_t>(p) ^ static_cast<uint64_t>(p >> 64);
+#else
+    const auto a_lo = a & 0xffffffff;
+    const auto a_hi = a >> 32;
+    const auto b_lo = b & 0xffffffff;
+    const auto b_hi = b >> 32;
+    const auto lo_lo = a_lo * b_lo;
+    const auto hi_lo = a_hi * b_lo;
+    const auto lo_hi = a_lo * b_hi;
+    const auto hi_hi = a_hi * b_hi;
+    const auto cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+    const auto hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    const auto lo = (cross << 32) | (lo_lo & 0xffffffff);
+    return lo ^ hi;
+#endif
+}
+}  // namespace wyhash
+
+/// Returns the random hash seed of the process.
+///
+/// The seed is derived once from the clock and the address space layout. It is not
+/// cryptographically secure, but unpredictable enough to prevent precomputed collisions.
+inline uint64_t random_hash_seed() noexcept
+{
+    static const uint64_t seed = [] {
+        static const int anchor = 0;
+        const auto time = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        return wyhash::mix(static_cast<uint64_t>(time) ^ wyhash::secret0,
+                           reinterpret_cast<uintptr_t>(&anchor) ^ wyhash::secret1);
+    }();
+    return seed;
+}
+
+/// The seeded hash function for the EVMC types.
+///
+/// Unlike the FNV-1a based std::hash specializations, the hash values are unpredictable
+/// without the knowledge of the seed, so colliding keys (e.g. attacker-controlled storage keys)
+/// cannot be precomputed. The wyhash mixing of the 64-bit words is fast: a 128-bit
+/// multiplication per 16 bytes of input.
+///
+/// This is a drop-in replacement for std::hash in the unordered containers and in
+/// the hash policies (e.g. evmc::BasicMockedHost<evmc::seeded_hash>). The default constructed
+/// hash uses the random_hash_seed() of the process.
+///
+/// @tparam T  The key type: evmc::address, evmc::bytes32 or evmc::StorageSlot.
+template <typename T>
+struct seeded_hash;
+
+/// The seeded hash of evmc::address.
+template <>
+struct seeded_hash<address>
+{
+    /// The seed.
+    uint64_t seed = random_hash_seed();
+
+    /// Hash operator.
+    size_t operator()(const address& a) const noexcept
+    {
+        const auto h = wyhash::mix(load64le(&a.bytes[0]) ^ seed ^ wyhash::secret1,
+                                   load64le(&a.bytes[8]) ^ seed ^ wyhash::secret0);
+        return static_cast<size_t>(
+            wyhash::mix(h ^ wyhash::secret2, load32le(&a.bytes[16]) ^ seed ^ wyhash::secret3));
+    }
+};
+
+/// The seeded hash of evmc::bytes32.
+template <>
+struct seeded_hash<bytes32>
+{
+    /// The seed.
+    uint64_t seed = random_hash_seed();
+
+    /// Hash operator.
+    size_t operator()(const bytes32& b) const noexcept
+    {
+        const auto h1 = wyhash::mix(load64le(&b.bytes[0]) ^ seed ^ wyhash::secret1,
+                                    load64le(&b.bytes[8]) ^ seed ^ wyhash::secret0);
+        const auto h2 = wyhash::mix(load64le(&b.bytes[16]) ^ seed ^ wyhash::secret2,
+                                    load64le(&b.bytes[24]) ^ seed ^ wyhash::secret3);
+        return static_cast<size_t>(wyhash::mix(h1 ^ wyhash::secret3, h2 ^ wyhash::secret1));
+    }
+};
+
+/// The seeded hash of evmc::StorageSlot.
+template <>
+struct seeded_hash<StorageSlot>
+{
+    /// The seed.
+    uint64_t seed = random_hash_seed();
+
+    /// Hash operator combining the seeded hashes of the address and the key.
+    size_t operator()(const StorageSlot& s) const noexcept
+    {
+        return static_cast<size_t>(
+            wyhash::mix(seeded_hash<address>{seed}(s.addr) ^ wyhash::secret2,
+                        seeded_hash<bytes32>{seed}(s.key) ^ wyhash::secret3));
+    }
+};
+}  // namespace evmc
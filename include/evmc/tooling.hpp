@@ -1,13 +1,287 @@
 // EVMC: Ethereum Client-VM Connector API.
 // Copyright 2020 The EVMC Authors.
 // Licensed under the Apache License, Version 2.0.
+#pragma once
 
 #include <evmc/evmc.hpp>
+#include <evmc/mocked_host.hpp>
+#include <array>
+#include <chrono>
+#include <functional>
 #include <iosfwd>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace evmc::tooling
 {
+/// The output format of the benchmark statistics.
+enum class BenchFormat
+{
+    text,
+    json,
+    csv,
+};
+
+/// The configuration of the execution benchmark.
+struct BenchOptions
+{
+    /// The number of not measured executions preceding the measurement.
+    int warmup = 1;
+
+    /// The number of measured executions.
+    /// If 0, the number is estimated from the warm-up to take around 1 second.
+    int repetitions = 0;
+
+    /// The output format of the statistics.
+    BenchFormat format = BenchFormat::text;
+
+    /// The number of threads executing the code concurrently with the shared VM instance
+    /// to measure the throughput scaling. The throughput is not measured if 1.
+    int threads = 1;
+};
+
+/// The bytes of a code or an input loaded from a file.
+///
+/// The raw binary files (with the .bin extension) are memory-mapped, so the bytes are
+/// neither copied nor decoded. The other files are decoded as hex strings with optional
+/// whitespace. The bytes are valid for the lifetime of the object.
+class FileBytes
+{
+public:
+    /// Loads the file.
+    /// @throws std::invalid_argument  If the file cannot be read or contains invalid hex.
+    explicit FileBytes(const std::string& path);
+
+    /// Unmaps the file.
+    ~FileBytes();
+
+    FileBytes(FileBytes&& other) noexcept;
+    FileBytes& operator=(const FileBytes&) = delete;
+
+    /// The loaded bytes.
+    bytes_view view() const noexcept { return m_view; }
+
+    /// Is the file memory-mapped, i.e. a raw binary file.
+    bool is_mapped() const noexcept { return m_mapping != nullptr; }
+
+    /// Checks if the file path has the .bin extension of the raw binary files.
+    static bool is_binary_path(const std::string& path) noexcept;
+
+private:
+    void* m_mapping = nullptr;
+    size_t m_mapping_size = 0;
+    bytes m_decoded;
+    bytes_view m_view;
+};
+
+/// The types of the binary trace records.
+enum class TraceRecordType : uint8_t
+{
+    call_start = 1,
+    step = 2,
+    storage = 3,
+    call_end = 4,
+};
+
+/// The writer of the binary execution trace.
+///
+/// Provides the evmc_tracer streaming the execution events to the output as fixed-size records.
+/// The records are buffered and written in big chunks, so the memory usage does not depend on
+/// the trace length. All numbers are little-endian, addresses and bytes32 values are raw bytes.
+///
+/// The trace starts with the 8-byte header: "EVMCTRC" followed by the format version byte 1.
+/// Each record starts with the 1-byte TraceRecordType, followed by:
+/// - call_start (60 bytes): kind u8, depth u16, flags u32, gas i64, recipient, sender,
+///   input size u32,
+/// - step (20 bytes): opcode u8, depth u16, pc u32, gas left i64, stack height u32,
+/// - storage (88 bytes): 0 u8, depth u16, address, key, value,
+/// - call_end (24 bytes): status code i8, depth u16, output size u32, gas left i64,
+///   gas refund i64.
+class TraceWriter
+{
+public:
+    /// The trace header.
+    static constexpr uint8_t header[] = {'E', 'V', 'M', 'C', 'T', 'R', 'C', 1};
+
+    /// The sizes of the records, including the type byte.
+    static constexpr size_t call_start_record_size = 60;
+    static constexpr size_t step_record_size = 20;
+    static constexpr size_t storage_record_size = 88;
+    static constexpr size_t call_end_record_size = 24;
+
+    /// Creates the writer and writes the trace header to the output.
+    explicit TraceWriter(std::ostream& out);
+
+    /// Flushes the buffered records.
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    /// The tracer to be returned by the Host from evmc_host_interface::get_tracer().
+    const evmc_tracer& tracer() const noexcept { return m_tracer; }
+
+    /// The number of records written so far.
+    uint64_t num_records() const noexcept { return m_num_records; }
+
+    /// Writes the buffered records to the output.
+    void flush();
+
+private:
+    /// Appends the number to the buffer as little-endian bytes.
+    template <typename T>
+    void put(T value) noexcept;
+
+    /// Appends the bytes to the buffer.
+    void put(const uint8_t* data, size_t size) noexcept;
+
+    /// Starts the record, flushing the buffer if the record may not fit.
+    void begin_record(TraceRecordType type, size_t size);
+
+    static void on_call_start(evmc_tracer_context* context, const evmc_message* msg);
+    static void on_step(evmc_tracer_context* context,
+                        int32_t depth,
+                        uint32_t pc,
+                        uint8_t opcode,
+                        int64_t gas_left,
+                        uint32_t stack_height,
+                        const evmc_uint256be* stack_top);
+    static void on_storage(evmc_tracer_context* context,
+                           int32_t depth,
+                           const evmc_address* address,
+                           const evmc_bytes32* key,
+                           const evmc_bytes32* value);
+    static void on_call_end(evmc_tracer_context* context,
+                            int32_t depth,
+                            const evmc_result* result);
+
+    std::ostream& m_out;
+    std::vector<uint8_t> m_buffer;
+    uint64_t m_num_records = 0;
+    evmc_tracer m_tracer{};
+};
+
+/// The opcode-level execution profiler.
+///
+/// Provides the evmc_tracer collecting the execution count, the gas used and the wall time
+/// of every opcode and of every code offset of the top-level code. The gas and the time of
+/// an instruction are measured until the next instruction of the same call depth,
+/// therefore they include the nested executions of the call and create instructions.
+class Profiler
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    /// The statistics of an opcode or of a code offset.
+    struct Stats
+    {
+        uint64_t count = 0;         ///< The number of executions.
+        int64_t gas_used = 0;       ///< The total gas used.
+        clock::duration time = {};  ///< The total wall time.
+    };
+
+    /// The statistics of a code offset.
+    struct PcStats : Stats
+    {
+        uint8_t opcode = 0;  ///< The opcode at the code offset.
+    };
+
+    /// Creates the profiler using the instruction names of the EVM revision.
+    explicit Profiler(evmc_revision rev) noexcept;
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /// The tracer to be provided to a VM by the Host.
+    const evmc_tracer& tracer() const noexcept { return m_tracer; }
+
+    /// The statistics of the opcodes.
+    const std::array<Stats, 256>& opcodes() const noexcept { return m_opcodes; }
+
+    /// The statistics of the code offsets of the top-level code.
+    const std::unordered_map<uint32_t, PcStats>& pcs() const noexcept { return m_pcs; }
+
+    /// Prints the statistics of the executed opcodes and the given number of the hottest
+    /// code offsets, both ordered by the time.
+    void report(std::ostream& out, size_t num_hot_pcs = 10) const;
+
+private:
+    /// The instruction being executed at a call depth.
+    struct Step
+    {
+        bool active = false;
+        uint8_t opcode = 0;
+        uint32_t pc = 0;
+        int64_t gas_left = 0;
+        clock::time_point start;
+    };
+
+    /// Finishes the instruction being executed at the call depth.
+    void finish_step(size_t depth, int64_t gas_left, clock::time_point now) noexcept;
+
+    static void on_call_start(evmc_tracer_context* context, const evmc_message* msg);
+    static void on_step(evmc_tracer_context* context,
+                        int32_t depth,
+                        uint32_t pc,
+                        uint8_t opcode,
+                        int64_t gas_left,
+                        uint32_t stack_height,
+                        const evmc_uint256be* stack_top);
+    static void on_call_end(evmc_tracer_context* context,
+                            int32_t depth,
+                            const evmc_result* result);
+
+    const char* const* m_names;
+    std::array<Stats, 256> m_opcodes{};
+    std::unordered_map<uint32_t, PcStats> m_pcs;
+    std::vector<Step> m_steps;
+    int32_t m_top_depth = -1;
+    evmc_tracer m_tracer{};
+};
+
+/// Executes the code, optionally benchmarking the execution.
+///
+/// The benchmark starts every execution from the same Host state.
+/// If the trace output is provided, the binary trace of the execution (excluding the contract
+/// creation and the benchmark repetitions) is written there, see TraceWriter.
+/// If profile is true, the opcode-level profile of the execution is printed, see Profiler.
+/// The trace and the profile are exclusive.
+/// With the JSON or CSV benchmark format only the benchmark statistics are printed,
+/// the execution result and the other human-readable lines are omitted.
+///
+/// @throws std::invalid_argument  If both the trace and the profile are requested.
+int run(VM& vm,
+        evmc_revision rev,
+        int64_t gas,
+        bytes_view code,
+        bytes_view input,
+        bool create,
+        const std::optional<BenchOptions>& bench,
+        std::ostream& out,
+        std::ostream* trace = nullptr,
+        bool profile = false);
+
+/// Executes every file of the corpus directory as the code, each from the empty Host state.
+///
+/// The files are loaded with FileBytes and executed in the order of their names by the same
+/// VM instance, so the contracts are replayed without the process startup per contract.
+/// A line with the execution result of each file is printed, followed by the summary.
+///
+/// @param create  Create the contract out of each code and then execute it with the input.
+/// @return        0 if all the executions have been successful or reverted, 1 otherwise.
+/// @throws std::invalid_argument  If the directory or a file cannot be read.
+int run_corpus(VM& vm,
+               evmc_revision rev,
+               int64_t gas,
+               const std::string& dir,
+               bytes_view input,
+               bool create,
+               std::ostream& out);
+
+/// Executes the code, optionally benchmarking the execution with default options.
 int run(VM& vm,
         evmc_revision rev,
         int64_t gas,
@@ -16,4 +290,97 @@ int run(VM& vm,
         bool create,
         bool bench,
         std::ostream& out);
+
+/// A single transaction of an Ethereum state test fixture on a fork.
+///
+/// A state test fixture (the GeneralStateTests format) contains the prestate, the block
+/// environment and the transaction with the lists of alternative data, gas limits and values.
+/// Every entry of the fixture's "post" section (a fork and the indexes of the alternatives)
+/// is a separate StateTestCase.
+struct StateTestCase
+{
+    /// The name: the test name, the fork and the indexes, e.g. "add/Cancun/d0g0v0".
+    std::string name;
+
+    /// The EVM revision of the fork.
+    evmc_revision rev = EVMC_LATEST_STABLE_REVISION;
+
+    /// The prestate accounts and the transaction context.
+    MockedHost pre;
+
+    /// The transaction message. The input_data is not set, the input is in data.
+    /// The gas is the transaction gas limit minus the intrinsic gas.
+    evmc_message msg{};
+
+    /// The transaction data: the call input or the initcode of the created contract.
+    bytes data;
+
+    /// The blob hashes of the transaction, set as the tx_context.blob_hashes for the execution.
+    std::vector<bytes32> blob_hashes;
+
+    /// The access list storage slots of the accounts not in the prestate. They are warm
+    /// in the execution, but are not added to the pre accounts, which would make them exist.
+    std::vector<StorageSlot> warm_storage;
+};
+
+/// Returns the EVM revision of a state test fork name, e.g. "Berlin" or "EIP150".
+/// Nothing if the fork is not known, e.g. the transition forks like "BerlinToLondonAt5".
+std::optional<evmc_revision> to_revision(std::string_view fork) noexcept;
+
+/// Parses the JSON of a state test fixture file.
+///
+/// The transactions expected to be invalid (having "expectException") and the transactions
+/// of the unknown forks are skipped. The accounts and the storage slots of the sender,
+/// the recipient, the coinbase and the access list are warm since the revisions
+/// introducing them.
+///
+/// @throws std::invalid_argument  If the JSON is invalid or not a state test fixture.
+std::vector<StateTestCase> load_state_tests(std::string_view json);
+
+/// The result of the execution of a StateTestCase.
+struct StateTestResult
+{
+    evmc_status_code status = EVMC_SUCCESS;  ///< The status of the transaction execution.
+    int64_t gas_used = 0;                    ///< The gas used, excluding the intrinsic gas.
+    std::chrono::nanoseconds time{};         ///< The execution time.
+};
+
+/// Executes the transaction of the state test with the VM.
+///
+/// The nested calls and creates are executed by the same VM, the state changes of the failed
+/// ones are reverted. The post state is not compared with the fixture: there is no
+/// Keccak-256 in the tooling to compute the state root and the addresses of created contracts,
+/// which are therefore not the same as on Ethereum.
+///
+/// @param post  If not null, receives the state after the execution.
+StateTestResult execute_state_test(VM& vm, const StateTestCase& test, MockedHost* post = nullptr);
+
+/// The configuration of the state tests execution.
+struct StateTestOptions
+{
+    /// The number of threads executing the tests concurrently, each with its own VM instance.
+    /// If 0, the number of hardware threads.
+    int threads = 0;
+
+    /// The number of executions of every test. The best time is reported.
+    int repetitions = 1;
+
+    /// The fork to execute the tests of. All forks if not set.
+    std::optional<evmc_revision> rev;
+};
+
+/// Executes the state test fixtures and reports the gas rate of every test and the aggregate.
+///
+/// The paths are state test fixture files or directories searched recursively
+/// for the .json files. The tests are loaded first and then executed concurrently.
+/// A VM instance is not required to be thread-safe, so every thread executes the tests
+/// with its own instance created by create_vm, e.g. with evmc_load_and_configure().
+///
+/// @return  0 if all the fixtures have been loaded and executed.
+/// @throws std::invalid_argument  If a path or a fixture cannot be read
+///                                or create_vm returns no VM instance.
+int run_state_tests(const std::function<VM()>& create_vm,
+                    const std::vector<std::string>& paths,
+                    const StateTestOptions& options,
+                    std::ostream& out);
 }  // namespace evmc::tooling
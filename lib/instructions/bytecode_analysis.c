@@ -0,0 +1,137 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/bytecode_analysis.h>
+#include <evmc/instructions.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Checks if the instruction terminates the basic block.
+ */
+static bool is_terminator(uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case OP_STOP:
+    case OP_JUMP:
+    case OP_JUMPI:
+    case OP_RETURN:
+    case OP_REVERT:
+    case OP_INVALID:
+    case OP_SELFDESTRUCT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * Returns the code offset of the instruction following the instruction at the given offset.
+ */
+static size_t next_instruction(uint8_t opcode, size_t pos, size_t code_size)
+{
+    pos += 1;
+    if (opcode >= OP_PUSH1 && opcode <= OP_PUSH32)
+    {
+        const size_t push_size = (size_t)(opcode - OP_PUSH1 + 1);
+        pos = (code_size - pos < push_size) ? code_size : pos + push_size;
+    }
+    return pos;
+}
+
+/**
+ * Counts the basic blocks of the code, splitting it the same way as evmc_analyze_bytecode().
+ */
+static size_t count_blocks(const char* const* names, const uint8_t* code, size_t code_size)
+{
+    size_t num_blocks = 0;
+    bool in_block = false;
+    size_t pos = 0;
+    while (pos < code_size)
+    {
+        const uint8_t opcode = code[pos];
+        if (opcode == OP_JUMPDEST || !in_block)
+        {
+            ++num_blocks;
+            in_block = true;
+        }
+        pos = next_instruction(opcode, pos, code_size);
+        if (is_terminator(opcode) || names[opcode] == NULL)
+            in_block = false;
+    }
+    return num_blocks;
+}
+
+struct evmc_bytecode_analysis* evmc_analyze_bytecode(enum evmc_revision revision,
+                                                     const uint8_t* code,
+                                                     size_t code_size)
+{
+    const struct evmc_instruction_metrics* metrics = evmc_get_instruction_metrics_table(revision);
+    const char* const* names = evmc_get_instruction_names_table(revision);
+    if (metrics == NULL || names == NULL)
+        return NULL;
+
+    // The blocks are counted first, so the result, the exact number of blocks and the bitmap
+    // are allocated in a single chunk of memory.
+    const size_t block_count = count_blocks(names, code, code_size);
+    const size_t num_words = code_size / 64 + (code_size % 64 != 0);
+    const size_t blocks_offset = sizeof(struct evmc_bytecode_analysis);
+    const size_t map_size = num_words * sizeof(uint64_t);
+    if (block_count > (SIZE_MAX - blocks_offset - map_size) / sizeof(struct evmc_basic_block))
+        return NULL;
+    const size_t map_offset = blocks_offset + block_count * sizeof(struct evmc_basic_block);
+    uint8_t* memory = (uint8_t*)malloc(map_offset + map_size);
+    if (memory == NULL)
+        return NULL;
+
+    struct evmc_bytecode_analysis* analysis = (struct evmc_bytecode_analysis*)memory;
+    struct evmc_basic_block* blocks = (struct evmc_basic_block*)(memory + blocks_offset);
+    uint64_t* jumpdest_map = (uint64_t*)(memory + map_offset);
+    evmc_analyze_jumpdests(code, code_size, jumpdest_map, NULL);
+
+    size_t num_blocks = 0;
+    struct evmc_basic_block* block = NULL;
+    size_t pos = 0;
+    while (pos < code_size)
+    {
+        const uint8_t opcode = code[pos];
+
+        if (opcode == OP_JUMPDEST)
+            block = NULL;  // JUMPDEST always starts a new block.
+
+        if (block == NULL)
+        {
+            block = &blocks[num_blocks++];
+            memset(block, 0, sizeof(*block));
+            block->begin = pos;
+        }
+
+        const struct evmc_instruction_metrics m = metrics[opcode];
+        const int32_t required = m.stack_height_required - block->stack_height_change;
+        if (required > block->stack_height_required)
+            block->stack_height_required = required;
+        block->stack_height_change += m.stack_height_change;
+        if (block->stack_height_change > block->stack_height_max_growth)
+            block->stack_height_max_growth = block->stack_height_change;
+        block->gas_cost += m.gas_cost;
+
+        pos = next_instruction(opcode, pos, code_size);
+        block->end = pos;
+        if (is_terminator(opcode) || names[opcode] == NULL)
+            block = NULL;
+    }
+
+    analysis->blocks = blocks;
+    analysis->num_blocks = num_blocks;
+    analysis->jumpdest_map = jumpdest_map;
+    analysis->code_size = code_size;
+    return analysis;
+}
+
+void evmc_release_bytecode_analysis(struct evmc_bytecode_analysis* analysis)
+{
+    free(analysis);
+}
@@ -0,0 +1,158 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/instructions.h>
+
+/**
+ * The gas costs of the storage and memory shared by many revisions.
+ */
+enum
+{
+    WARM_STORAGE_READ_COST = 100,
+    COLD_ACCOUNT_ACCESS_COST = 2600,
+    COLD_SLOAD_COST = 2100,
+    SSTORE_SENTRY_GAS = 2300,
+    MEMORY_WORD_COST = 3,
+    MEMORY_QUADRATIC_DIVISOR = 512,
+    COPY_WORD_COST = 3
+};
+
+/** The gas schedule before the net gas metering of SSTORE. */
+static const struct evmc_gas_schedule frontier_gas_schedule = {
+    0,
+    0,
+    0,
+    0,
+    MEMORY_WORD_COST,
+    MEMORY_QUADRATIC_DIVISOR,
+    COPY_WORD_COST,
+    {
+        /*          ASSIGNED */ {5000, 0},
+        /*             ADDED */ {20000, 0},
+        /*           DELETED */ {5000, 15000},
+        /*          MODIFIED */ {5000, 0},
+        /*     DELETED_ADDED */ {20000, 0},
+        /*  MODIFIED_DELETED */ {5000, 15000},
+        /*  DELETED_RESTORED */ {20000, 0},
+        /*     ADDED_DELETED */ {5000, 15000},
+        /* MODIFIED_RESTORED */ {5000, 0},
+    },
+};
+
+/** The net gas metering of SSTORE (EIP-1283). */
+static const struct evmc_gas_schedule constantinople_gas_schedule = {
+    0,
+    0,
+    0,
+    0,
+    MEMORY_WORD_COST,
+    MEMORY_QUADRATIC_DIVISOR,
+    COPY_WORD_COST,
+    {
+        /*          ASSIGNED */ {200, 0},
+        /*             ADDED */ {20000, 0},
+        /*           DELETED */ {5000, 15000},
+        /*          MODIFIED */ {5000, 0},
+        /*     DELETED_ADDED */ {200, -15000},
+        /*  MODIFIED_DELETED */ {200, 15000},
+        /*  DELETED_RESTORED */ {200, -10200},
+        /*     ADDED_DELETED */ {200, 19800},
+        /* MODIFIED_RESTORED */ {200, 4800},
+    },
+};
+
+/** The net gas metering of SSTORE with the gas sentry (EIP-2200). */
+static const struct evmc_gas_schedule istanbul_gas_schedule = {
+    0,
+    0,
+    0,
+    SSTORE_SENTRY_GAS,
+    MEMORY_WORD_COST,
+    MEMORY_QUADRATIC_DIVISOR,
+    COPY_WORD_COST,
+    {
+        /*          ASSIGNED */ {800, 0},
+        /*             ADDED */ {20000, 0},
+        /*           DELETED */ {5000, 15000},
+        /*          MODIFIED */ {5000, 0},
+        /*     DELETED_ADDED */ {800, -15000},
+        /*  MODIFIED_DELETED */ {800, 15000},
+        /*  DELETED_RESTORED */ {800, -10800},
+        /*     ADDED_DELETED */ {800, 19200},
+        /* MODIFIED_RESTORED */ {800, 4200},
+    },
+};
+
+/** The warm and cold access costs (EIP-2929). */
+static const struct evmc_gas_schedule berlin_gas_schedule = {
+    WARM_STORAGE_READ_COST,
+    COLD_ACCOUNT_ACCESS_COST,
+    COLD_SLOAD_COST,
+    SSTORE_SENTRY_GAS,
+    MEMORY_WORD_COST,
+    MEMORY_QUADRATIC_DIVISOR,
+    COPY_WORD_COST,
+    {
+        /*          ASSIGNED */ {100, 0},
+        /*             ADDED */ {20000, 0},
+        /*           DELETED */ {2900, 15000},
+        /*          MODIFIED */ {2900, 0},
+        /*     DELETED_ADDED */ {100, -15000},
+        /*  MODIFIED_DELETED */ {100, 15000},
+        /*  DELETED_RESTORED */ {100, -12200},
+        /*     ADDED_DELETED */ {100, 19900},
+        /* MODIFIED_RESTORED */ {100, 2800},
+    },
+};
+
+/** The reduced refund of clearing a storage slot (EIP-3529). */
+static const struct evmc_gas_schedule london_gas_schedule = {
+    WARM_STORAGE_READ_COST,
+    COLD_ACCOUNT_ACCESS_COST,
+    COLD_SLOAD_COST,
+    SSTORE_SENTRY_GAS,
+    MEMORY_WORD_COST,
+    MEMORY_QUADRATIC_DIVISOR,
+    COPY_WORD_COST,
+    {
+        /*          ASSIGNED */ {100, 0},
+        /*             ADDED */ {20000, 0},
+        /*           DELETED */ {2900, 4800},
+        /*          MODIFIED */ {2900, 0},
+        /*     DELETED_ADDED */ {100, -4800},
+        /*  MODIFIED_DELETED */ {100, 4800},
+        /*  DELETED_RESTORED */ {100, -2000},
+        /*     ADDED_DELETED */ {100, 19900},
+        /* MODIFIED_RESTORED */ {100, 2800},
+    },
+};
+
+const struct evmc_gas_schedule* evmc_get_gas_schedule(enum evmc_revision revision)
+{
+    switch (revision)
+    {
+    case EVMC_OSAKA:
+    case EVMC_PRAGUE:
+    case EVMC_CANCUN:
+    case EVMC_SHANGHAI:
+    case EVMC_PARIS:
+    case EVMC_LONDON:
+        return &london_gas_schedule;
+    case EVMC_BERLIN:
+        return &berlin_gas_schedule;
+    case EVMC_ISTANBUL:
+        return &istanbul_gas_schedule;
+    case EVMC_CONSTANTINOPLE:
+        return &constantinople_gas_schedule;
+    case EVMC_PETERSBURG: /* EIP-1283 removed. */
+    case EVMC_BYZANTIUM:
+    case EVMC_SPURIOUS_DRAGON:
+    case EVMC_TANGERINE_WHISTLE:
+    case EVMC_HOMESTEAD:
+    case EVMC_FRONTIER:
+        return &frontier_gas_schedule;
+    default:
+        return NULL;
+    }
+}
@@ -0,0 +1,3421 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/instructions.h>
+
+/**
+ * Short names of the instruction flags for the tables below.
+ */
+enum
+{
+    DEFINED = EVMC_INSTRUCTION_DEFINED,
+    TERMINATOR = EVMC_INSTRUCTION_TERMINATOR,
+    JUMP = EVMC_INSTRUCTION_JUMP,
+    DYNAMIC_GAS = EVMC_INSTRUCTION_DYNAMIC_GAS
+};
+
+static const struct evmc_instruction_descriptor osaka_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODECOPY = 0x3c */ {100, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     PREVRANDAO = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*        BASEFEE = 0x48 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*          PUSH0 = 0x5f */ {2, 0, 1, 0, DEFINED},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor prague_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODECOPY = 0x3c */ {100, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     PREVRANDAO = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*        BASEFEE = 0x48 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*          PUSH0 = 0x5f */ {2, 0, 1, 0, DEFINED},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor cancun_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODECOPY = 0x3c */ {100, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     PREVRANDAO = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*        BASEFEE = 0x48 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*          PUSH0 = 0x5f */ {2, 0, 1, 0, DEFINED},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor shanghai_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODECOPY = 0x3c */ {100, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     PREVRANDAO = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*        BASEFEE = 0x48 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*          PUSH0 = 0x5f */ {2, 0, 1, 0, DEFINED},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor paris_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODECOPY = 0x3c */ {100, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     PREVRANDAO = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*        BASEFEE = 0x48 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor london_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODECOPY = 0x3c */ {100, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*        BASEFEE = 0x48 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor berlin_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODECOPY = 0x3c */ {100, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*                = 0x48 */ {0, 0, 0, 0, 0},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {100, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {100, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {100, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor istanbul_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {700, 1, 0, 0, DEFINED},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {700, 1, 0, 0, DEFINED},
+    /*    EXTCODECOPY = 0x3c */ {700, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {700, 1, 0, 0, DEFINED},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*        CHAINID = 0x46 */ {2, 0, 1, 0, DEFINED},
+    /*    SELFBALANCE = 0x47 */ {5, 0, 1, 0, DEFINED},
+    /*                = 0x48 */ {0, 0, 0, 0, 0},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {800, 1, 0, 0, DEFINED},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {700, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {700, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor constantinople_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*            SHL = 0x1b */ {3, 2, -1, 0, DEFINED},
+    /*            SHR = 0x1c */ {3, 2, -1, 0, DEFINED},
+    /*            SAR = 0x1d */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {400, 1, 0, 0, DEFINED},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {700, 1, 0, 0, DEFINED},
+    /*    EXTCODECOPY = 0x3c */ {700, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*    EXTCODEHASH = 0x3f */ {400, 1, 0, 0, DEFINED},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x46 */ {0, 0, 0, 0, 0},
+    /*                = 0x47 */ {0, 0, 0, 0, 0},
+    /*                = 0x48 */ {0, 0, 0, 0, 0},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {200, 1, 0, 0, DEFINED},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {700, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*        CREATE2 = 0xf5 */ {32000, 4, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {700, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor byzantium_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1b */ {0, 0, 0, 0, 0},
+    /*                = 0x1c */ {0, 0, 0, 0, 0},
+    /*                = 0x1d */ {0, 0, 0, 0, 0},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {400, 1, 0, 0, DEFINED},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {700, 1, 0, 0, DEFINED},
+    /*    EXTCODECOPY = 0x3c */ {700, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /* RETURNDATASIZE = 0x3d */ {2, 0, 1, 0, DEFINED},
+    /* RETURNDATACOPY = 0x3e */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x3f */ {0, 0, 0, 0, 0},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x46 */ {0, 0, 0, 0, 0},
+    /*                = 0x47 */ {0, 0, 0, 0, 0},
+    /*                = 0x48 */ {0, 0, 0, 0, 0},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {200, 1, 0, 0, DEFINED},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {700, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf5 */ {0, 0, 0, 0, 0},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*     STATICCALL = 0xfa */ {700, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*         REVERT = 0xfd */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor tangerine_whistle_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1b */ {0, 0, 0, 0, 0},
+    /*                = 0x1c */ {0, 0, 0, 0, 0},
+    /*                = 0x1d */ {0, 0, 0, 0, 0},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {400, 1, 0, 0, DEFINED},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {700, 1, 0, 0, DEFINED},
+    /*    EXTCODECOPY = 0x3c */ {700, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x3d */ {0, 0, 0, 0, 0},
+    /*                = 0x3e */ {0, 0, 0, 0, 0},
+    /*                = 0x3f */ {0, 0, 0, 0, 0},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x46 */ {0, 0, 0, 0, 0},
+    /*                = 0x47 */ {0, 0, 0, 0, 0},
+    /*                = 0x48 */ {0, 0, 0, 0, 0},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {200, 1, 0, 0, DEFINED},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {700, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {700, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf5 */ {0, 0, 0, 0, 0},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*                = 0xfa */ {0, 0, 0, 0, 0},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*                = 0xfd */ {0, 0, 0, 0, 0},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {5000, 1, -1, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+};
+
+static const struct evmc_instruction_descriptor homestead_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1b */ {0, 0, 0, 0, 0},
+    /*                = 0x1c */ {0, 0, 0, 0, 0},
+    /*                = 0x1d */ {0, 0, 0, 0, 0},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {20, 1, 0, 0, DEFINED},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {20, 1, 0, 0, DEFINED},
+    /*    EXTCODECOPY = 0x3c */ {20, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x3d */ {0, 0, 0, 0, 0},
+    /*                = 0x3e */ {0, 0, 0, 0, 0},
+    /*                = 0x3f */ {0, 0, 0, 0, 0},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x46 */ {0, 0, 0, 0, 0},
+    /*                = 0x47 */ {0, 0, 0, 0, 0},
+    /*                = 0x48 */ {0, 0, 0, 0, 0},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {50, 1, 0, 0, DEFINED},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {40, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {40, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*   DELEGATECALL = 0xf4 */ {40, 6, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xf5 */ {0, 0, 0, 0, 0},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*                = 0xfa */ {0, 0, 0, 0, 0},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*                = 0xfd */ {0, 0, 0, 0, 0},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {0, 1, -1, 0, DEFINED | TERMINATOR},
+};
+
+static const struct evmc_instruction_descriptor frontier_descriptors[256] = {
+    /*           STOP = 0x00 */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*            ADD = 0x01 */ {3, 2, -1, 0, DEFINED},
+    /*            MUL = 0x02 */ {5, 2, -1, 0, DEFINED},
+    /*            SUB = 0x03 */ {3, 2, -1, 0, DEFINED},
+    /*            DIV = 0x04 */ {5, 2, -1, 0, DEFINED},
+    /*           SDIV = 0x05 */ {5, 2, -1, 0, DEFINED},
+    /*            MOD = 0x06 */ {5, 2, -1, 0, DEFINED},
+    /*           SMOD = 0x07 */ {5, 2, -1, 0, DEFINED},
+    /*         ADDMOD = 0x08 */ {8, 3, -2, 0, DEFINED},
+    /*         MULMOD = 0x09 */ {8, 3, -2, 0, DEFINED},
+    /*            EXP = 0x0a */ {10, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*     SIGNEXTEND = 0x0b */ {5, 2, -1, 0, DEFINED},
+    /*                = 0x0c */ {0, 0, 0, 0, 0},
+    /*                = 0x0d */ {0, 0, 0, 0, 0},
+    /*                = 0x0e */ {0, 0, 0, 0, 0},
+    /*                = 0x0f */ {0, 0, 0, 0, 0},
+    /*             LT = 0x10 */ {3, 2, -1, 0, DEFINED},
+    /*             GT = 0x11 */ {3, 2, -1, 0, DEFINED},
+    /*            SLT = 0x12 */ {3, 2, -1, 0, DEFINED},
+    /*            SGT = 0x13 */ {3, 2, -1, 0, DEFINED},
+    /*             EQ = 0x14 */ {3, 2, -1, 0, DEFINED},
+    /*         ISZERO = 0x15 */ {3, 1, 0, 0, DEFINED},
+    /*            AND = 0x16 */ {3, 2, -1, 0, DEFINED},
+    /*             OR = 0x17 */ {3, 2, -1, 0, DEFINED},
+    /*            XOR = 0x18 */ {3, 2, -1, 0, DEFINED},
+    /*            NOT = 0x19 */ {3, 1, 0, 0, DEFINED},
+    /*           BYTE = 0x1a */ {3, 2, -1, 0, DEFINED},
+    /*                = 0x1b */ {0, 0, 0, 0, 0},
+    /*                = 0x1c */ {0, 0, 0, 0, 0},
+    /*                = 0x1d */ {0, 0, 0, 0, 0},
+    /*                = 0x1e */ {0, 0, 0, 0, 0},
+    /*                = 0x1f */ {0, 0, 0, 0, 0},
+    /*      KECCAK256 = 0x20 */ {30, 2, -1, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x21 */ {0, 0, 0, 0, 0},
+    /*                = 0x22 */ {0, 0, 0, 0, 0},
+    /*                = 0x23 */ {0, 0, 0, 0, 0},
+    /*                = 0x24 */ {0, 0, 0, 0, 0},
+    /*                = 0x25 */ {0, 0, 0, 0, 0},
+    /*                = 0x26 */ {0, 0, 0, 0, 0},
+    /*                = 0x27 */ {0, 0, 0, 0, 0},
+    /*                = 0x28 */ {0, 0, 0, 0, 0},
+    /*                = 0x29 */ {0, 0, 0, 0, 0},
+    /*                = 0x2a */ {0, 0, 0, 0, 0},
+    /*                = 0x2b */ {0, 0, 0, 0, 0},
+    /*                = 0x2c */ {0, 0, 0, 0, 0},
+    /*                = 0x2d */ {0, 0, 0, 0, 0},
+    /*                = 0x2e */ {0, 0, 0, 0, 0},
+    /*                = 0x2f */ {0, 0, 0, 0, 0},
+    /*        ADDRESS = 0x30 */ {2, 0, 1, 0, DEFINED},
+    /*        BALANCE = 0x31 */ {20, 1, 0, 0, DEFINED},
+    /*         ORIGIN = 0x32 */ {2, 0, 1, 0, DEFINED},
+    /*         CALLER = 0x33 */ {2, 0, 1, 0, DEFINED},
+    /*      CALLVALUE = 0x34 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATALOAD = 0x35 */ {3, 1, 0, 0, DEFINED},
+    /*   CALLDATASIZE = 0x36 */ {2, 0, 1, 0, DEFINED},
+    /*   CALLDATACOPY = 0x37 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       CODESIZE = 0x38 */ {2, 0, 1, 0, DEFINED},
+    /*       CODECOPY = 0x39 */ {3, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*       GASPRICE = 0x3a */ {2, 0, 1, 0, DEFINED},
+    /*    EXTCODESIZE = 0x3b */ {20, 1, 0, 0, DEFINED},
+    /*    EXTCODECOPY = 0x3c */ {20, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0x3d */ {0, 0, 0, 0, 0},
+    /*                = 0x3e */ {0, 0, 0, 0, 0},
+    /*                = 0x3f */ {0, 0, 0, 0, 0},
+    /*      BLOCKHASH = 0x40 */ {20, 1, 0, 0, DEFINED},
+    /*       COINBASE = 0x41 */ {2, 0, 1, 0, DEFINED},
+    /*      TIMESTAMP = 0x42 */ {2, 0, 1, 0, DEFINED},
+    /*         NUMBER = 0x43 */ {2, 0, 1, 0, DEFINED},
+    /*     DIFFICULTY = 0x44 */ {2, 0, 1, 0, DEFINED},
+    /*       GASLIMIT = 0x45 */ {2, 0, 1, 0, DEFINED},
+    /*                = 0x46 */ {0, 0, 0, 0, 0},
+    /*                = 0x47 */ {0, 0, 0, 0, 0},
+    /*                = 0x48 */ {0, 0, 0, 0, 0},
+    /*                = 0x49 */ {0, 0, 0, 0, 0},
+    /*                = 0x4a */ {0, 0, 0, 0, 0},
+    /*                = 0x4b */ {0, 0, 0, 0, 0},
+    /*                = 0x4c */ {0, 0, 0, 0, 0},
+    /*                = 0x4d */ {0, 0, 0, 0, 0},
+    /*                = 0x4e */ {0, 0, 0, 0, 0},
+    /*                = 0x4f */ {0, 0, 0, 0, 0},
+    /*            POP = 0x50 */ {2, 1, -1, 0, DEFINED},
+    /*          MLOAD = 0x51 */ {3, 1, 0, 0, DEFINED | DYNAMIC_GAS},
+    /*         MSTORE = 0x52 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*        MSTORE8 = 0x53 */ {3, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*          SLOAD = 0x54 */ {50, 1, 0, 0, DEFINED},
+    /*         SSTORE = 0x55 */ {0, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           JUMP = 0x56 */ {8, 1, -1, 0, DEFINED | JUMP},
+    /*          JUMPI = 0x57 */ {10, 2, -2, 0, DEFINED | JUMP},
+    /*             PC = 0x58 */ {2, 0, 1, 0, DEFINED},
+    /*          MSIZE = 0x59 */ {2, 0, 1, 0, DEFINED},
+    /*            GAS = 0x5a */ {2, 0, 1, 0, DEFINED},
+    /*       JUMPDEST = 0x5b */ {1, 0, 0, 0, DEFINED},
+    /*                = 0x5c */ {0, 0, 0, 0, 0},
+    /*                = 0x5d */ {0, 0, 0, 0, 0},
+    /*                = 0x5e */ {0, 0, 0, 0, 0},
+    /*                = 0x5f */ {0, 0, 0, 0, 0},
+    /*          PUSH1 = 0x60 */ {3, 0, 1, 1, DEFINED},
+    /*          PUSH2 = 0x61 */ {3, 0, 1, 2, DEFINED},
+    /*          PUSH3 = 0x62 */ {3, 0, 1, 3, DEFINED},
+    /*          PUSH4 = 0x63 */ {3, 0, 1, 4, DEFINED},
+    /*          PUSH5 = 0x64 */ {3, 0, 1, 5, DEFINED},
+    /*          PUSH6 = 0x65 */ {3, 0, 1, 6, DEFINED},
+    /*          PUSH7 = 0x66 */ {3, 0, 1, 7, DEFINED},
+    /*          PUSH8 = 0x67 */ {3, 0, 1, 8, DEFINED},
+    /*          PUSH9 = 0x68 */ {3, 0, 1, 9, DEFINED},
+    /*         PUSH10 = 0x69 */ {3, 0, 1, 10, DEFINED},
+    /*         PUSH11 = 0x6a */ {3, 0, 1, 11, DEFINED},
+    /*         PUSH12 = 0x6b */ {3, 0, 1, 12, DEFINED},
+    /*         PUSH13 = 0x6c */ {3, 0, 1, 13, DEFINED},
+    /*         PUSH14 = 0x6d */ {3, 0, 1, 14, DEFINED},
+    /*         PUSH15 = 0x6e */ {3, 0, 1, 15, DEFINED},
+    /*         PUSH16 = 0x6f */ {3, 0, 1, 16, DEFINED},
+    /*         PUSH17 = 0x70 */ {3, 0, 1, 17, DEFINED},
+    /*         PUSH18 = 0x71 */ {3, 0, 1, 18, DEFINED},
+    /*         PUSH19 = 0x72 */ {3, 0, 1, 19, DEFINED},
+    /*         PUSH20 = 0x73 */ {3, 0, 1, 20, DEFINED},
+    /*         PUSH21 = 0x74 */ {3, 0, 1, 21, DEFINED},
+    /*         PUSH22 = 0x75 */ {3, 0, 1, 22, DEFINED},
+    /*         PUSH23 = 0x76 */ {3, 0, 1, 23, DEFINED},
+    /*         PUSH24 = 0x77 */ {3, 0, 1, 24, DEFINED},
+    /*         PUSH25 = 0x78 */ {3, 0, 1, 25, DEFINED},
+    /*         PUSH26 = 0x79 */ {3, 0, 1, 26, DEFINED},
+    /*         PUSH27 = 0x7a */ {3, 0, 1, 27, DEFINED},
+    /*         PUSH28 = 0x7b */ {3, 0, 1, 28, DEFINED},
+    /*         PUSH29 = 0x7c */ {3, 0, 1, 29, DEFINED},
+    /*         PUSH30 = 0x7d */ {3, 0, 1, 30, DEFINED},
+    /*         PUSH31 = 0x7e */ {3, 0, 1, 31, DEFINED},
+    /*         PUSH32 = 0x7f */ {3, 0, 1, 32, DEFINED},
+    /*           DUP1 = 0x80 */ {3, 1, 1, 0, DEFINED},
+    /*           DUP2 = 0x81 */ {3, 2, 1, 0, DEFINED},
+    /*           DUP3 = 0x82 */ {3, 3, 1, 0, DEFINED},
+    /*           DUP4 = 0x83 */ {3, 4, 1, 0, DEFINED},
+    /*           DUP5 = 0x84 */ {3, 5, 1, 0, DEFINED},
+    /*           DUP6 = 0x85 */ {3, 6, 1, 0, DEFINED},
+    /*           DUP7 = 0x86 */ {3, 7, 1, 0, DEFINED},
+    /*           DUP8 = 0x87 */ {3, 8, 1, 0, DEFINED},
+    /*           DUP9 = 0x88 */ {3, 9, 1, 0, DEFINED},
+    /*          DUP10 = 0x89 */ {3, 10, 1, 0, DEFINED},
+    /*          DUP11 = 0x8a */ {3, 11, 1, 0, DEFINED},
+    /*          DUP12 = 0x8b */ {3, 12, 1, 0, DEFINED},
+    /*          DUP13 = 0x8c */ {3, 13, 1, 0, DEFINED},
+    /*          DUP14 = 0x8d */ {3, 14, 1, 0, DEFINED},
+    /*          DUP15 = 0x8e */ {3, 15, 1, 0, DEFINED},
+    /*          DUP16 = 0x8f */ {3, 16, 1, 0, DEFINED},
+    /*          SWAP1 = 0x90 */ {3, 2, 0, 0, DEFINED},
+    /*          SWAP2 = 0x91 */ {3, 3, 0, 0, DEFINED},
+    /*          SWAP3 = 0x92 */ {3, 4, 0, 0, DEFINED},
+    /*          SWAP4 = 0x93 */ {3, 5, 0, 0, DEFINED},
+    /*          SWAP5 = 0x94 */ {3, 6, 0, 0, DEFINED},
+    /*          SWAP6 = 0x95 */ {3, 7, 0, 0, DEFINED},
+    /*          SWAP7 = 0x96 */ {3, 8, 0, 0, DEFINED},
+    /*          SWAP8 = 0x97 */ {3, 9, 0, 0, DEFINED},
+    /*          SWAP9 = 0x98 */ {3, 10, 0, 0, DEFINED},
+    /*         SWAP10 = 0x99 */ {3, 11, 0, 0, DEFINED},
+    /*         SWAP11 = 0x9a */ {3, 12, 0, 0, DEFINED},
+    /*         SWAP12 = 0x9b */ {3, 13, 0, 0, DEFINED},
+    /*         SWAP13 = 0x9c */ {3, 14, 0, 0, DEFINED},
+    /*         SWAP14 = 0x9d */ {3, 15, 0, 0, DEFINED},
+    /*         SWAP15 = 0x9e */ {3, 16, 0, 0, DEFINED},
+    /*         SWAP16 = 0x9f */ {3, 17, 0, 0, DEFINED},
+    /*           LOG0 = 0xa0 */ {375, 2, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG1 = 0xa1 */ {750, 3, -3, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG2 = 0xa2 */ {1125, 4, -4, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG3 = 0xa3 */ {1500, 5, -5, 0, DEFINED | DYNAMIC_GAS},
+    /*           LOG4 = 0xa4 */ {1875, 6, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*                = 0xa5 */ {0, 0, 0, 0, 0},
+    /*                = 0xa6 */ {0, 0, 0, 0, 0},
+    /*                = 0xa7 */ {0, 0, 0, 0, 0},
+    /*                = 0xa8 */ {0, 0, 0, 0, 0},
+    /*                = 0xa9 */ {0, 0, 0, 0, 0},
+    /*                = 0xaa */ {0, 0, 0, 0, 0},
+    /*                = 0xab */ {0, 0, 0, 0, 0},
+    /*                = 0xac */ {0, 0, 0, 0, 0},
+    /*                = 0xad */ {0, 0, 0, 0, 0},
+    /*                = 0xae */ {0, 0, 0, 0, 0},
+    /*                = 0xaf */ {0, 0, 0, 0, 0},
+    /*                = 0xb0 */ {0, 0, 0, 0, 0},
+    /*                = 0xb1 */ {0, 0, 0, 0, 0},
+    /*                = 0xb2 */ {0, 0, 0, 0, 0},
+    /*                = 0xb3 */ {0, 0, 0, 0, 0},
+    /*                = 0xb4 */ {0, 0, 0, 0, 0},
+    /*                = 0xb5 */ {0, 0, 0, 0, 0},
+    /*                = 0xb6 */ {0, 0, 0, 0, 0},
+    /*                = 0xb7 */ {0, 0, 0, 0, 0},
+    /*                = 0xb8 */ {0, 0, 0, 0, 0},
+    /*                = 0xb9 */ {0, 0, 0, 0, 0},
+    /*                = 0xba */ {0, 0, 0, 0, 0},
+    /*                = 0xbb */ {0, 0, 0, 0, 0},
+    /*                = 0xbc */ {0, 0, 0, 0, 0},
+    /*                = 0xbd */ {0, 0, 0, 0, 0},
+    /*                = 0xbe */ {0, 0, 0, 0, 0},
+    /*                = 0xbf */ {0, 0, 0, 0, 0},
+    /*                = 0xc0 */ {0, 0, 0, 0, 0},
+    /*                = 0xc1 */ {0, 0, 0, 0, 0},
+    /*                = 0xc2 */ {0, 0, 0, 0, 0},
+    /*                = 0xc3 */ {0, 0, 0, 0, 0},
+    /*                = 0xc4 */ {0, 0, 0, 0, 0},
+    /*                = 0xc5 */ {0, 0, 0, 0, 0},
+    /*                = 0xc6 */ {0, 0, 0, 0, 0},
+    /*                = 0xc7 */ {0, 0, 0, 0, 0},
+    /*                = 0xc8 */ {0, 0, 0, 0, 0},
+    /*                = 0xc9 */ {0, 0, 0, 0, 0},
+    /*                = 0xca */ {0, 0, 0, 0, 0},
+    /*                = 0xcb */ {0, 0, 0, 0, 0},
+    /*                = 0xcc */ {0, 0, 0, 0, 0},
+    /*                = 0xcd */ {0, 0, 0, 0, 0},
+    /*                = 0xce */ {0, 0, 0, 0, 0},
+    /*                = 0xcf */ {0, 0, 0, 0, 0},
+    /*                = 0xd0 */ {0, 0, 0, 0, 0},
+    /*                = 0xd1 */ {0, 0, 0, 0, 0},
+    /*                = 0xd2 */ {0, 0, 0, 0, 0},
+    /*                = 0xd3 */ {0, 0, 0, 0, 0},
+    /*                = 0xd4 */ {0, 0, 0, 0, 0},
+    /*                = 0xd5 */ {0, 0, 0, 0, 0},
+    /*                = 0xd6 */ {0, 0, 0, 0, 0},
+    /*                = 0xd7 */ {0, 0, 0, 0, 0},
+    /*                = 0xd8 */ {0, 0, 0, 0, 0},
+    /*                = 0xd9 */ {0, 0, 0, 0, 0},
+    /*                = 0xda */ {0, 0, 0, 0, 0},
+    /*                = 0xdb */ {0, 0, 0, 0, 0},
+    /*                = 0xdc */ {0, 0, 0, 0, 0},
+    /*                = 0xdd */ {0, 0, 0, 0, 0},
+    /*                = 0xde */ {0, 0, 0, 0, 0},
+    /*                = 0xdf */ {0, 0, 0, 0, 0},
+    /*                = 0xe0 */ {0, 0, 0, 0, 0},
+    /*                = 0xe1 */ {0, 0, 0, 0, 0},
+    /*                = 0xe2 */ {0, 0, 0, 0, 0},
+    /*                = 0xe3 */ {0, 0, 0, 0, 0},
+    /*                = 0xe4 */ {0, 0, 0, 0, 0},
+    /*                = 0xe5 */ {0, 0, 0, 0, 0},
+    /*                = 0xe6 */ {0, 0, 0, 0, 0},
+    /*                = 0xe7 */ {0, 0, 0, 0, 0},
+    /*                = 0xe8 */ {0, 0, 0, 0, 0},
+    /*                = 0xe9 */ {0, 0, 0, 0, 0},
+    /*                = 0xea */ {0, 0, 0, 0, 0},
+    /*                = 0xeb */ {0, 0, 0, 0, 0},
+    /*                = 0xec */ {0, 0, 0, 0, 0},
+    /*                = 0xed */ {0, 0, 0, 0, 0},
+    /*                = 0xee */ {0, 0, 0, 0, 0},
+    /*                = 0xef */ {0, 0, 0, 0, 0},
+    /*         CREATE = 0xf0 */ {32000, 3, -2, 0, DEFINED | DYNAMIC_GAS},
+    /*           CALL = 0xf1 */ {40, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*       CALLCODE = 0xf2 */ {40, 7, -6, 0, DEFINED | DYNAMIC_GAS},
+    /*         RETURN = 0xf3 */ {0, 2, -2, 0, DEFINED | TERMINATOR | DYNAMIC_GAS},
+    /*                = 0xf4 */ {0, 0, 0, 0, 0},
+    /*                = 0xf5 */ {0, 0, 0, 0, 0},
+    /*                = 0xf6 */ {0, 0, 0, 0, 0},
+    /*                = 0xf7 */ {0, 0, 0, 0, 0},
+    /*                = 0xf8 */ {0, 0, 0, 0, 0},
+    /*                = 0xf9 */ {0, 0, 0, 0, 0},
+    /*                = 0xfa */ {0, 0, 0, 0, 0},
+    /*                = 0xfb */ {0, 0, 0, 0, 0},
+    /*                = 0xfc */ {0, 0, 0, 0, 0},
+    /*                = 0xfd */ {0, 0, 0, 0, 0},
+    /*        INVALID = 0xfe */ {0, 0, 0, 0, DEFINED | TERMINATOR},
+    /*   SELFDESTRUCT = 0xff */ {0, 1, -1, 0, DEFINED | TERMINATOR},
+};
+
+const struct evmc_instruction_descriptor* evmc_get_instruction_descriptor_table(
+    enum evmc_revision revision)
+{
+    switch (revision)
+    {
+    case EVMC_OSAKA:
+        return osaka_descriptors;
+    case EVMC_PRAGUE:
+        return prague_descriptors;
+    case EVMC_CANCUN:
+        return cancun_descriptors;
+    case EVMC_SHANGHAI:
+        return shanghai_descriptors;
+    case EVMC_PARIS:
+        return paris_descriptors;
+    case EVMC_LONDON:
+        return london_descriptors;
+    case EVMC_BERLIN:
+        return berlin_descriptors;
+    case EVMC_ISTANBUL:
+        return istanbul_descriptors;
+    case EVMC_PETERSBURG:
+    case EVMC_CONSTANTINOPLE:
+        return constantinople_descriptors;
+    case EVMC_BYZANTIUM:
+        return byzantium_descriptors;
+    case EVMC_SPURIOUS_DRAGON:
+    case EVMC_TANGERINE_WHISTLE:
+        return tangerine_whistle_descriptors;
+    case EVMC_HOMESTEAD:
+        return homestead_descriptors;
+    case EVMC_FRONTIER:
+        return frontier_descriptors;
+    default:
+        return NULL;
+    }
+}
@@ -0,0 +1,204 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/bytecode_analysis.h>
+#include <evmc/instructions.h>
+
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define EVMC_JUMPDEST_AVX2 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define EVMC_JUMPDEST_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/** The number of code bytes processed at once. Matches the number of bits in a map word. */
+#define CHUNK_SIZE 64
+
+/**
+ * The masks of the code bytes of a chunk: bit i set if the byte i is the given opcode.
+ */
+struct chunk_masks
+{
+    uint64_t push;     /**< PUSH1 - PUSH32 opcodes. */
+    uint64_t jumpdest; /**< JUMPDEST opcodes. */
+};
+
+/** The function computing the masks of a chunk of CHUNK_SIZE bytes. */
+typedef struct chunk_masks (*compute_masks_fn)(const uint8_t* chunk);
+
+/** Counts trailing zero bits. The value MUST NOT be 0. */
+static inline unsigned count_trailing_zeros(uint64_t value)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctzll(value);
+#endif
+}
+
+static struct chunk_masks compute_masks_scalar(const uint8_t* chunk)
+{
+    struct chunk_masks masks = {0, 0};
+    for (unsigned i = 0; i < CHUNK_SIZE; ++i)
+    {
+        const uint8_t op = chunk[i];
+        // Unsigned wrap-around makes this a single range comparison.
+        masks.push |= (uint64_t)((uint8_t)(op - OP_PUSH1) <= OP_PUSH32 - OP_PUSH1) << i;
+        masks.jumpdest |= (uint64_t)(op == OP_JUMPDEST) << i;
+    }
+    return masks;
+}
+
+#if EVMC_JUMPDEST_AVX2
+__attribute__((target("avx2"))) static uint64_t movemask64(__m256i lo, __m256i hi)
+{
+    return (uint64_t)(uint32_t)_mm256_movemask_epi8(lo) |
+           ((uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32);
+}
+
+__attribute__((target("avx2"))) static struct chunk_masks compute_masks_avx2(const uint8_t* chunk)
+{
+    const __m256i lo = _mm256_loadu_si256((const __m256i*)chunk);
+    const __m256i hi = _mm256_loadu_si256((const __m256i*)(chunk + 32));
+
+    // The PUSH range check: (op - PUSH1) as signed int8 < 32 - 128 after the bias by -128.
+    const __m256i bias = _mm256_set1_epi8((char)(OP_PUSH1 + 0x80));
+    const __m256i limit = _mm256_set1_epi8((char)(OP_PUSH32 - OP_PUSH1 + 1 - 0x80));
+    const __m256i jumpdest = _mm256_set1_epi8((char)OP_JUMPDEST);
+
+    struct chunk_masks masks;
+    masks.push = movemask64(_mm256_cmpgt_epi8(limit, _mm256_sub_epi8(lo, bias)),
+                            _mm256_cmpgt_epi8(limit, _mm256_sub_epi8(hi, bias)));
+    masks.jumpdest =
+        movemask64(_mm256_cmpeq_epi8(lo, jumpdest), _mm256_cmpeq_epi8(hi, jumpdest));
+    return masks;
+}
+#endif
+
+#if EVMC_JUMPDEST_NEON
+/** Converts the 16 byte comparison result (0x00 or 0xff per byte) to the 16-bit mask. */
+static inline uint64_t movemask16(uint8x16_t cmp)
+{
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                        1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t bits = vandq_u8(cmp, vld1q_u8(weights));
+    return (uint64_t)vaddv_u8(vget_low_u8(bits)) | ((uint64_t)vaddv_u8(vget_high_u8(bits)) << 8);
+}
+
+static struct chunk_masks compute_masks_neon(const uint8_t* chunk)
+{
+    const uint8x16_t push1 = vdupq_n_u8(OP_PUSH1);
+    const uint8x16_t push_range = vdupq_n_u8(OP_PUSH32 - OP_PUSH1);
+    const uint8x16_t jumpdest = vdupq_n_u8(OP_JUMPDEST);
+
+    struct chunk_masks masks = {0, 0};
+    for (unsigned i = 0; i < CHUNK_SIZE; i += 16)
+    {
+        const uint8x16_t ops = vld1q_u8(chunk + i);
+        masks.push |= movemask16(vcleq_u8(vsubq_u8(ops, push1), push_range)) << i;
+        masks.jumpdest |= movemask16(vceqq_u8(ops, jumpdest)) << i;
+    }
+    return masks;
+}
+#endif
+
+/** Selects the best implementation for the CPU the code is running on, checking the CPU once. */
+static compute_masks_fn select_compute_masks(void)
+{
+#if EVMC_JUMPDEST_AVX2
+    // Racing threads detect and store the same implementation.
+    static compute_masks_fn selected = NULL;
+    compute_masks_fn impl = __atomic_load_n(&selected, __ATOMIC_RELAXED);
+    if (impl == NULL)
+    {
+        __builtin_cpu_init();
+        impl = __builtin_cpu_supports("avx2") ? compute_masks_avx2 : compute_masks_scalar;
+        __atomic_store_n(&selected, impl, __ATOMIC_RELAXED);
+    }
+    return impl;
+#elif EVMC_JUMPDEST_NEON
+    return compute_masks_neon;
+#endif
+    return compute_masks_scalar;
+}
+
+void evmc_analyze_jumpdests(const uint8_t* code,
+                            size_t code_size,
+                            uint64_t* jumpdest_map,
+                            uint64_t* push_data_map)
+{
+    const compute_masks_fn compute_masks = select_compute_masks();
+
+    // The number of push data bytes spilling over from the previous chunks.
+    size_t carry = 0;
+
+    for (size_t base = 0; base < code_size; base += CHUNK_SIZE)
+    {
+        const uint8_t* chunk = &code[base];
+        uint8_t tail[CHUNK_SIZE];
+        if (code_size - base < CHUNK_SIZE)
+        {
+            // Pad the last chunk with STOP.
+            memset(tail, OP_STOP, sizeof(tail));
+            memcpy(tail, chunk, code_size - base);
+            chunk = tail;
+        }
+
+        const struct chunk_masks masks = compute_masks(chunk);
+
+        uint64_t data;
+        if (carry >= CHUNK_SIZE)
+        {
+            data = ~(uint64_t)0;
+            carry -= CHUNK_SIZE;
+        }
+        else
+        {
+            data = ((uint64_t)1 << carry) - 1;
+            carry = 0;
+
+            // Resolve the pushes one by one, skipping the ones being push data themselves.
+            uint64_t pushes = masks.push & ~data;
+            while (pushes != 0)
+            {
+                const unsigned pos = count_trailing_zeros(pushes);
+                const unsigned push_size = (unsigned)(chunk[pos] - OP_PUSH1 + 1);
+                const unsigned data_end = pos + 1 + push_size;
+                if (data_end >= CHUNK_SIZE)
+                {
+                    data |= ~(uint64_t)0 << pos << 1;
+                    carry = data_end - CHUNK_SIZE;
+                    break;
+                }
+                const uint64_t push_data = (((uint64_t)1 << push_size) - 1) << (pos + 1);
+                data |= push_data;
+                pushes &= ~((uint64_t)1 << pos) & ~push_data;
+            }
+        }
+
+        const size_t word = base / CHUNK_SIZE;
+        jumpdest_map[word] = masks.jumpdest & ~data;
+        if (push_data_map != NULL)
+            push_data_map[word] = data;
+    }
+
+    // Clear the bits of the padding.
+    if (code_size % CHUNK_SIZE != 0)
+    {
+        const size_t last = code_size / CHUNK_SIZE;
+        const uint64_t valid = ((uint64_t)1 << (code_size % CHUNK_SIZE)) - 1;
+        jumpdest_map[last] &= valid;
+        if (push_data_map != NULL)
+            push_data_map[last] &= valid;
+    }
+}
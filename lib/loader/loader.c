@@ -10,6 +10,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #if defined(EVMC_LOADER_MOCK)
@@ -31,6 +32,21 @@
 #define DLL_GET_ERROR_MSG() dlerror()
 #endif
 
+#if defined(EVMC_LOADER_MOCK)
+#define CACHE_LOCK_DECLARE(name) static const int name = 0
+#define CACHE_LOCK(name) (void)name
+#define CACHE_UNLOCK(name) (void)name
+#elif defined(_WIN32)
+#define CACHE_LOCK_DECLARE(name) static SRWLOCK name = SRWLOCK_INIT
+#define CACHE_LOCK(name) AcquireSRWLockExclusive(&name)
+#define CACHE_UNLOCK(name) ReleaseSRWLockExclusive(&name)
+#else
+#include <pthread.h>
+#define CACHE_LOCK_DECLARE(name) static pthread_mutex_t name = PTHREAD_MUTEX_INITIALIZER
+#define CACHE_LOCK(name) pthread_mutex_lock(&name)
+#define CACHE_UNLOCK(name) pthread_mutex_unlock(&name)
+#endif
+
 #ifdef __has_attribute
 #if __has_attribute(format)
 #define ATTR_FORMAT(archetype, string_index, first_to_check) \
@@ -69,7 +85,9 @@ static
 enum
 {
     PATH_MAX_LENGTH = 4096,
-    LAST_ERROR_MSG_BUFFER_SIZE = 511
+    LAST_ERROR_MSG_BUFFER_SIZE = 511,
+    MODULE_CACHE_SIZE = 32,
+    REGISTRY_SIZE = 32
 };
 
 static const char* last_error_msg = NULL;
@@ -93,6 +111,151 @@ static enum evmc_loader_error_code set_error(enum evmc_loader_error_code error_c
     return error_code;
 }
 
+/// The cache entry of a loaded EVMC module.
+struct module_cache_entry
+{
+    /// The file name the module has been loaded with (owned copy).
+    char* filename;
+
+    /// The create function found in the module.
+    evmc_create_fn create_fn;
+};
+
+/// The lock guarding the module cache and the VM registry.
+CACHE_LOCK_DECLARE(loader_lock);
+
+/// The cache of the loaded EVMC modules, the most recently loaded last.
+/// When full, the oldest entry is replaced. Guarded by the loader_lock.
+static struct module_cache_entry module_cache[MODULE_CACHE_SIZE];
+static size_t module_cache_size = 0;
+
+/// Finds the create function of the entry with the name. Must be called with the lock held.
+static evmc_create_fn find_create_fn(const struct module_cache_entry* entries,
+                                     size_t size,
+                                     const char* name)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (strcmp(entries[i].filename, name) == 0)
+            return entries[i].create_fn;
+    }
+    return NULL;
+}
+
+static evmc_create_fn module_cache_find(const char* filename)
+{
+    CACHE_LOCK(loader_lock);
+    const evmc_create_fn create_fn = find_create_fn(module_cache, module_cache_size, filename);
+    CACHE_UNLOCK(loader_lock);
+    return create_fn;
+}
+
+static void module_cache_add(const char* filename, evmc_create_fn create_fn)
+{
+    const size_t size = strlen(filename) + 1;
+    char* filename_copy = (char*)malloc(size);
+    if (!filename_copy)
+        return;  // Not caching is fine.
+    memcpy(filename_copy, filename, size);
+
+    CACHE_LOCK(loader_lock);
+    if (module_cache_size == MODULE_CACHE_SIZE)
+    {
+        free(module_cache[0].filename);
+        memmove(&module_cache[0], &module_cache[1],
+                (MODULE_CACHE_SIZE - 1) * sizeof(module_cache[0]));
+        --module_cache_size;
+    }
+    module_cache[module_cache_size].filename = filename_copy;
+    module_cache[module_cache_size].create_fn = create_fn;
+    ++module_cache_size;
+    CACHE_UNLOCK(loader_lock);
+}
+
+void evmc_loader_clear_cache(void)
+{
+    CACHE_LOCK(loader_lock);
+    for (size_t i = 0; i < module_cache_size; ++i)
+        free(module_cache[i].filename);
+    module_cache_size = 0;
+    CACHE_UNLOCK(loader_lock);
+}
+
+/// The registry of the VMs linked into the program, see evmc_register_vm().
+/// The entries have the same layout as the module cache, the filename being the VM name.
+/// Guarded by the loader_lock.
+static struct module_cache_entry registry[REGISTRY_SIZE];
+static size_t registry_size = 0;
+
+enum evmc_loader_error_code evmc_register_vm(const char* name, evmc_create_fn create_fn)
+{
+    last_error_msg = NULL;  // Reset last error.
+    if (!name || strlen(name) == 0 || !create_fn)
+        return set_error(EVMC_LOADER_INVALID_ARGUMENT,
+                         "invalid argument: VM name and create function cannot be null or empty");
+
+    enum evmc_loader_error_code ec = EVMC_LOADER_SUCCESS;
+    CACHE_LOCK(loader_lock);
+    for (size_t i = 0; i < registry_size; ++i)
+    {
+        if (strcmp(registry[i].filename, name) == 0)
+        {
+            registry[i].create_fn = create_fn;
+            goto exit;
+        }
+    }
+
+    if (registry_size == REGISTRY_SIZE)
+    {
+        ec = set_error(EVMC_LOADER_INVALID_ARGUMENT,
+                       "cannot register %s: too many VMs registered (maximum is %d)", name,
+                       (int)REGISTRY_SIZE);
+        goto exit;
+    }
+
+    const size_t size = strlen(name) + 1;
+    char* name_copy = (char*)malloc(size);
+    if (!name_copy)
+    {
+        ec = set_error(EVMC_LOADER_INVALID_ARGUMENT, "cannot register %s: out of memory", name);
+        goto exit;
+    }
+    memcpy(name_copy, name, size);
+    registry[registry_size].filename = name_copy;
+    registry[registry_size].create_fn = create_fn;
+    ++registry_size;
+
+exit:
+    CACHE_UNLOCK(loader_lock);
+    return ec;
+}
+
+void evmc_unregister_vm(const char* name)
+{
+    if (!name)
+        return;
+
+    CACHE_LOCK(loader_lock);
+    for (size_t i = 0; i < registry_size; ++i)
+    {
+        if (strcmp(registry[i].filename, name) == 0)
+        {
+            free(registry[i].filename);
+            registry[i] = registry[registry_size - 1];
+            --registry_size;
+            break;
+        }
+    }
+    CACHE_UNLOCK(loader_lock);
+}
+
+static evmc_create_fn registry_find(const char* name)
+{
+    CACHE_LOCK(loader_lock);
+    const evmc_create_fn create_fn = find_create_fn(registry, registry_size, name);
+    CACHE_UNLOCK(loader_lock);
+    return create_fn;
+}
 
 evmc_create_fn evmc_load(const char* filename, enum evmc_loader_error_code* error_code)
 {
@@ -120,6 +283,14 @@ evmc_create_fn evmc_load(const char* filename, enum evmc_loader_error_code* erro
         goto exit;
     }
 
+    create_fn = registry_find(filename);
+    if (create_fn)
+        goto exit;
+
+    create_fn = module_cache_find(filename);
+    if (create_fn)
+        goto exit;
+
     DLL_HANDLE handle = DLL_OPEN(filename);
     if (!handle)
     {
@@ -178,6 +349,8 @@ evmc_create_fn evmc_load(const char* filename, enum evmc_loader_error_code* erro
         ec = set_error(EVMC_LOADER_SYMBOL_NOT_FOUND, "EVMC create function not found in %s",
                        filename);
     }
+    else
+        module_cache_add(filename, create_fn);
 
 exit:
     if (error_code)
@@ -192,14 +365,11 @@ const char* evmc_last_error_msg(void)
     return m;
 }
 
-struct evmc_vm* evmc_load_and_create(const char* filename, enum evmc_loader_error_code* error_code)
+/// Creates the VM instance with the create function of the module loaded from the filename.
+static struct evmc_vm* create_vm(evmc_create_fn create_fn,
+                                 const char* filename,
+                                 enum evmc_loader_error_code* error_code)
 {
-    // First load the DLL. This also resets the last_error_msg;
-    evmc_create_fn create_fn = evmc_load(filename, error_code);
-
-    if (!create_fn)
-        return NULL;
-
     enum evmc_loader_error_code ec = EVMC_LOADER_SUCCESS;
 
     struct evmc_vm* vm = create_fn();
@@ -227,84 +397,155 @@ exit:
     return vm;
 }
 
-/// Gets the token delimited by @p delim character of the string pointed by the @p str_ptr.
-/// If the delimiter is not found, the whole string is returned.
-/// The @p str_ptr is also slided after the delimiter or to the string end
-/// if the delimiter is not found (in this case the @p str_ptr points to an empty string).
-static char* get_token(char** str_ptr, char delim)
+struct evmc_vm* evmc_load_and_create(const char* filename, enum evmc_loader_error_code* error_code)
+{
+    // First load the DLL. This also resets the last_error_msg;
+    evmc_create_fn create_fn = evmc_load(filename, error_code);
+
+    if (!create_fn)
+        return NULL;
+
+    return create_vm(create_fn, filename, error_code);
+}
+
+enum
 {
-    char* str = *str_ptr;
-    char* delim_pos = strchr(str, delim);
-    if (delim_pos)
+    /// The size of the parsed configuration buffer. Each option of the configuration string
+    /// takes at most one byte more after parsing (when the empty value is added).
+    CONFIG_BUFFER_SIZE = 2 * PATH_MAX_LENGTH
+};
+
+/// The VM configuration parsed from the configuration string.
+struct vm_config
+{
+    /// The module path followed by the option names and values, all null-terminated.
+    /// An option without the value has the empty value.
+    char buffer[CONFIG_BUFFER_SIZE];
+
+    /// The number of the options.
+    size_t num_options;
+};
+
+/// Parses the configuration string, see evmc_load_and_configure() for the syntax.
+static enum evmc_loader_error_code parse_config(struct vm_config* cfg, const char* config)
+{
+    if (strlen(config) >= PATH_MAX_LENGTH)
     {
-        // If the delimiter is found, null it to get null-terminated prefix
-        // and slide the str_ptr after the delimiter.
-        *delim_pos = '\0';
-        *str_ptr = delim_pos + 1;
+        return set_error(
+            EVMC_LOADER_INVALID_ARGUMENT,
+            "invalid argument: configuration is too long (maximum allowed length is %d)",
+            (int)PATH_MAX_LENGTH);
     }
-    else
+
+    char* out = cfg->buffer;
+    const char* in = config;
+
+    // The path is the first token and the options follow, each ended by "," or the string end.
+    // The option name is the option prefix up to "=". The rest of the option is the value.
+    const size_t path_length = strcspn(in, ",");
+    memcpy(out, in, path_length);
+    out[path_length] = '\0';
+    out += path_length + 1;
+    in += path_length;
+    if (*in == ',')
+        ++in;
+
+    cfg->num_options = 0;
+    while (*in != '\0')
     {
-        // Otherwise, slide the str_ptr to the end and return the whole string as the prefix.
-        *str_ptr += strlen(str);
+        const size_t option_length = strcspn(in, ",");
+        const size_t name_length = strcspn(in, "=,");
+        memcpy(out, in, name_length);
+        out[name_length] = '\0';
+        out += name_length + 1;
+
+        const size_t value_length =
+            name_length < option_length ? option_length - name_length - 1 : 0;
+        memcpy(out, in + option_length - value_length, value_length);
+        out[value_length] = '\0';
+        out += value_length + 1;
+
+        in += option_length;
+        if (*in == ',')
+            ++in;
+        ++cfg->num_options;
     }
-    return str;
+    return EVMC_LOADER_SUCCESS;
 }
 
-struct evmc_vm* evmc_load_and_configure(const char* config, enum evmc_loader_error_code* error_code)
+/// Sets the options of the parsed configuration in the VM.
+static enum evmc_loader_error_code configure_vm(struct evmc_vm* vm, const struct vm_config* cfg)
 {
-    enum evmc_loader_error_code ec = EVMC_LOADER_SUCCESS;
-    struct evmc_vm* vm = NULL;
-
-    char config_copy_buffer[PATH_MAX_LENGTH];
-    if (strcpy_sx(config_copy_buffer, sizeof(config_copy_buffer), config) != 0)
+    const char* path = cfg->buffer;
+    if (cfg->num_options != 0 && vm->set_option == NULL)
     {
-        ec = set_error(EVMC_LOADER_INVALID_ARGUMENT,
-                       "invalid argument: configuration is too long (maximum allowed length is %d)",
-                       (int)sizeof(config_copy_buffer));
-        goto exit;
+        return set_error(EVMC_LOADER_INVALID_OPTION_NAME, "%s (%s) does not support any options",
+                         vm->name, path);
     }
 
-    char* options = config_copy_buffer;
-    const char* path = get_token(&options, ',');
-
-    vm = evmc_load_and_create(path, error_code);
-    if (!vm)
-        return NULL;
-
-    while (strlen(options) != 0)
+    const char* option = path + strlen(path) + 1;
+    for (size_t i = 0; i < cfg->num_options; ++i)
     {
-        if (vm->set_option == NULL)
-        {
-            ec = set_error(EVMC_LOADER_INVALID_OPTION_NAME, "%s (%s) does not support any options",
-                           vm->name, path);
-            goto exit;
-        }
+        const char* name = option;
+        const char* value = name + strlen(name) + 1;
+        option = value + strlen(value) + 1;
 
-        char* option = get_token(&options, ',');
-
-        // Slit option into name and value by taking the name token.
-        // The option variable will have the value, can be empty.
-        const char* name = get_token(&option, '=');
-
-        enum evmc_set_option_result r = vm->set_option(vm, name, option);
+        enum evmc_set_option_result r = vm->set_option(vm, name, value);
         switch (r)
         {
         case EVMC_SET_OPTION_SUCCESS:
             break;
         case EVMC_SET_OPTION_INVALID_NAME:
-            ec = set_error(EVMC_LOADER_INVALID_OPTION_NAME, "%s (%s): unknown option '%s'",
-                           vm->name, path, name);
-            goto exit;
+            return set_error(EVMC_LOADER_INVALID_OPTION_NAME, "%s (%s): unknown option '%s'",
+                             vm->name, path, name);
         case EVMC_SET_OPTION_INVALID_VALUE:
-            ec = set_error(EVMC_LOADER_INVALID_OPTION_VALUE,
-                           "%s (%s): unsupported value '%s' for option '%s'", vm->name, path,
-                           option, name);
+            return set_error(EVMC_LOADER_INVALID_OPTION_VALUE,
+                             "%s (%s): unsupported value '%s' for option '%s'", vm->name, path,
+                             value, name);
+        default:
+            return set_error(EVMC_LOADER_INVALID_OPTION_VALUE,
+                             "%s (%s): unknown error when setting value '%s' for option '%s'",
+                             vm->name, path, value, name);
+        }
+    }
+    return EVMC_LOADER_SUCCESS;
+}
+
+struct evmc_vm* evmc_load_and_configure(const char* config, enum evmc_loader_error_code* error_code)
+{
+    struct evmc_vm* vm = NULL;
+    return evmc_load_and_configure_pool(config, &vm, 1, error_code) == 1 ? vm : NULL;
+}
+
+size_t evmc_load_and_configure_pool(const char* config,
+                                    struct evmc_vm* vms[],
+                                    size_t count,
+                                    enum evmc_loader_error_code* error_code)
+{
+    enum evmc_loader_error_code ec = EVMC_LOADER_SUCCESS;
+    size_t num_created = 0;
+
+    struct vm_config cfg;
+    ec = parse_config(&cfg, config);
+    if (ec != EVMC_LOADER_SUCCESS)
+        goto exit;
+
+    const char* path = cfg.buffer;
+    const evmc_create_fn create_fn = evmc_load(path, &ec);
+    if (!create_fn)
+        goto exit;
+
+    for (; num_created < count; ++num_created)
+    {
+        struct evmc_vm* vm = create_vm(create_fn, path, &ec);
+        if (!vm)
             goto exit;
+        vms[num_created] = vm;
 
-        default:
-            ec = set_error(EVMC_LOADER_INVALID_OPTION_VALUE,
-                           "%s (%s): unknown error when setting value '%s' for option '%s'",
-                           vm->name, path, option, name);
+        ec = configure_vm(vm, &cfg);
+        if (ec != EVMC_LOADER_SUCCESS)
+        {
+            ++num_created;  // Destroy also this one.
             goto exit;
         }
     }
@@ -314,9 +555,12 @@ exit:
         *error_code = ec;
 
     if (ec == EVMC_LOADER_SUCCESS)
-        return vm;
+        return count;
 
-    if (vm)
-        evmc_destroy(vm);
-    return NULL;
+    for (size_t i = 0; i < num_created; ++i)
+    {
+        evmc_destroy(vms[i]);
+        vms[i] = NULL;
+    }
+    return 0;
 }
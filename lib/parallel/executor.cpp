@@ -0,0 +1,513 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/parallel.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+
+namespace evmc::parallel
+{
+namespace
+{
+/// The storage location: the account address and the storage key.
+struct StorageLocation
+{
+    address addr;
+    bytes32 key;
+
+    bool operator==(const StorageLocation& other) const noexcept
+    {
+        return addr == other.addr && key == other.key;
+    }
+};
+
+struct StorageLocationHash
+{
+    size_t operator()(const StorageLocation& loc) const noexcept
+    {
+        return std::hash<address>{}(loc.addr) ^ (std::hash<bytes32>{}(loc.key) << 1);
+    }
+};
+
+/// The list of storage locations with their values read or written by a transaction.
+using StorageSet = std::vector<std::pair<StorageLocation, bytes32>>;
+
+/// Returns true if any of the locations in the set A is also present in the set B.
+bool intersects(const StorageSet& a, const StorageSet& b) noexcept
+{
+    return std::any_of(a.begin(), a.end(), [&b](const auto& x) {
+        return std::any_of(b.begin(), b.end(), [&x](const auto& y) { return x.first == y.first; });
+    });
+}
+
+/// The multi-version storage.
+///
+/// For every storage location keeps the values written by the transactions, by their indexes.
+/// The locations are sharded by their hashes, each shard protected by its own mutex.
+class VersionedStorage
+{
+    static constexpr size_t num_shards = 64;
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<StorageLocation, std::map<size_t, bytes32>, StorageLocationHash>
+            versions;
+    };
+
+    const MockedHost& m_state;
+    std::array<Shard, num_shards> m_shards;
+
+    Shard& get_shard(const StorageLocation& loc) noexcept
+    {
+        return m_shards[StorageLocationHash{}(loc) % num_shards];
+    }
+
+    /// Returns the value in the initial state.
+    bytes32 initial_value(const StorageLocation& loc) const noexcept
+    {
+        const auto acc = m_state.accounts.find(loc.addr);
+        if (acc == m_state.accounts.end())
+            return {};
+        const auto it = acc->second.storage.find(loc.key);
+        return it != acc->second.storage.end() ? it->second.current : bytes32{};
+    }
+
+public:
+    explicit VersionedStorage(const MockedHost& state) noexcept : m_state{state} {}
+
+    /// Returns the value visible to the transaction: the one written by the last preceding
+    /// transaction or the initial one.
+    bytes32 read(const StorageLocation& loc, size_t tx_index)
+    {
+        auto& shard = get_shard(loc);
+        {
+            const std::lock_guard lock{shard.mutex};
+            if (const auto it = shard.versions.find(loc); it != shard.versions.end())
+            {
+                const auto& versions = it->second;
+                if (const auto v = versions.lower_bound(tx_index); v != versions.begin())
+                    return std::prev(v)->second;
+            }
+        }
+        return initial_value(loc);
+    }
+
+    /// Replaces the previous writes of the transaction with the new ones.
+    /// The new values are published before the stale locations are removed.
+    void write(size_t tx_index, const StorageSet& prev_writes, const StorageSet& writes)
+    {
+        for (const auto& [loc, value] : writes)
+        {
+            auto& shard = get_shard(loc);
+            const std::lock_guard lock{shard.mutex};
+            shard.versions[loc][tx_index] = value;
+        }
+
+        for (const auto& [loc, value] : prev_writes)
+        {
+            if (std::any_of(writes.begin(), writes.end(),
+                            [&loc = loc](const auto& w) { return w.first == loc; }))
+                continue;
+            auto& shard = get_shard(loc);
+            const std::lock_guard lock{shard.mutex};
+            if (const auto it = shard.versions.find(loc); it != shard.versions.end())
+                it->second.erase(tx_index);
+        }
+    }
+};
+
+/// The Host view of the state for a single execution of a transaction.
+///
+/// The accessed accounts are copied (without the storage) from the initial state on first
+/// modification and the storage values are loaded from the versioned storage on first access,
+/// so all the modifications stay local and the MockedHost implementation of the transaction
+/// semantics (EIP-2200 storage status, warm access sets, transient storage) applies as is.
+class TransactionHost : public MockedHost
+{
+    const MockedHost& m_state;
+    VersionedStorage& m_storage;
+    size_t m_tx_index;
+
+    /// The storage values read from the versioned storage, i.e. the read set.
+    mutable std::unordered_map<StorageLocation, bytes32, StorageLocationHash> m_reads;
+
+    const MockedAccount* find_account(const address& addr) const noexcept
+    {
+        if (const auto it = accounts.find(addr); it != accounts.end())
+            return &it->second;
+        if (const auto it = m_state.accounts.find(addr); it != m_state.accounts.end())
+            return &it->second;
+        return nullptr;
+    }
+
+    bytes32 read(const address& addr, const bytes32& key) const
+    {
+        const StorageLocation loc{addr, key};
+        if (const auto it = m_reads.find(loc); it != m_reads.end())
+            return it->second;
+        const auto value = m_storage.read(loc, m_tx_index);
+        m_reads.emplace(loc, value);
+        return value;
+    }
+
+    /// Copies the account from the initial state, before it is modified.
+    void load_account(const address& addr)
+    {
+        if (accounts.count(addr) != 0)
+            return;
+        const auto it = m_state.accounts.find(addr);
+        if (it == m_state.accounts.end())
+            return;
+        auto& acc = accounts[addr];
+        acc.nonce = it->second.nonce;
+        acc.code = it->second.code;
+        acc.codehash = it->second.codehash;
+        acc.balance = it->second.balance;
+    }
+
+    /// Loads the storage value, before the storage entry is accessed or modified.
+    /// The access status set in the initial state (e.g. by an access list) is preserved.
+    void load_storage(const address& addr, const bytes32& key)
+    {
+        load_account(addr);
+        auto& storage = accounts[addr].storage;
+        if (storage.count(key) != 0)
+            return;
+
+        auto access_status = EVMC_ACCESS_COLD;
+        if (const auto acc = m_state.accounts.find(addr); acc != m_state.accounts.end())
+        {
+            if (const auto it = acc->second.storage.find(key); it != acc->second.storage.end())
+                access_status = it->second.access_status;
+        }
+        storage.emplace(key, StorageValue{read(addr, key), access_status});
+    }
+
+public:
+    TransactionHost(const MockedHost& state, VersionedStorage& storage, size_t tx_index)
+      : m_state{state}, m_storage{storage}, m_tx_index{tx_index}
+    {
+        tx_context = state.tx_context;
+        block_hash = state.block_hash;
+        call_result = state.call_result;
+    }
+
+    /// Returns the read set.
+    StorageSet read_set() const { return {m_reads.begin(), m_reads.end()}; }
+
+    /// Returns the write set: the modified storage values.
+    StorageSet write_set() const
+    {
+        StorageSet writes;
+        for (const auto& [addr, acc] : accounts)
+        {
+            for (const auto& [key, value] : acc.storage)
+            {
+                if (value.current != value.original)
+                    writes.emplace_back(StorageLocation{addr, key}, value.current);
+            }
+        }
+        return writes;
+    }
+
+    bool account_exists(const address& addr) const noexcept override
+    {
+        return find_account(addr) != nullptr;
+    }
+
+    bytes32 get_storage(const address& addr, const bytes32& key) const noexcept override
+    {
+        if (const auto acc = accounts.find(addr); acc != accounts.end())
+        {
+            if (const auto it = acc->second.storage.find(key); it != acc->second.storage.end())
+                return it->second.current;
+        }
+        return read(addr, key);
+    }
+
+    evmc_storage_status set_storage(const address& addr,
+                                    const bytes32& key,
+                                    const bytes32& value) noexcept override
+    {
+        load_storage(addr, key);
+        return MockedHost::set_storage(addr, key, value);
+    }
+
+    uint256be get_balance(const address& addr) const noexcept override
+    {
+        const auto acc = find_account(addr);
+        return acc != nullptr ? acc->balance : uint256be{};
+    }
+
+    size_t get_code_size(const address& addr) const noexcept override
+    {
+        const auto acc = find_account(addr);
+        return acc != nullptr ? acc->code.size() : 0;
+    }
+
+    bytes32 get_code_hash(const address& addr) const noexcept override
+    {
+        const auto acc = find_account(addr);
+        return acc != nullptr ? acc->codehash : bytes32{};
+    }
+
+    size_t copy_code(const address& addr,
+                     size_t code_offset,
+                     uint8_t* buffer_data,
+                     size_t buffer_size) const noexcept override
+    {
+        const auto acc = find_account(addr);
+        if (acc == nullptr || code_offset >= acc->code.size())
+            return 0;
+        const auto n = std::min(buffer_size, acc->code.size() - code_offset);
+        std::copy_n(&acc->code[code_offset], n, buffer_data);
+        return n;
+    }
+
+    bool get_code_view(const address& addr, evmc_code_view& view) const noexcept override
+    {
+        const auto acc = find_account(addr);
+        if (acc == nullptr)
+        {
+            view = {};
+            return true;
+        }
+        view.code = acc->code.data();
+        view.code_size = acc->code.size();
+        view.code_hash = acc->codehash;
+        return true;
+    }
+
+    evmc_access_status access_storage(const address& addr, const bytes32& key) noexcept override
+    {
+        load_storage(addr, key);
+        return MockedHost::access_storage(addr, key);
+    }
+
+    void set_transient_storage(const address& addr,
+                               const bytes32& key,
+                               const bytes32& value) noexcept override
+    {
+        load_account(addr);
+        MockedHost::set_transient_storage(addr, key, value);
+    }
+};
+
+/// The execution status of a transaction.
+///
+/// The transitions ready -> executing -> executed are done by any thread claiming
+/// the transaction. The transitions from executed are only done by the committing thread.
+enum class Status
+{
+    ready,
+    executing,
+    executed,
+    committed,
+};
+
+/// The state of a transaction in the block execution.
+struct TransactionState
+{
+    std::atomic<Status> status{Status::ready};
+
+    /// The read and write sets of the last execution. Accessed only by the thread
+    /// which has set the transaction executing or, after it is executed, by the committing thread.
+    StorageSet reads;
+    StorageSet writes;
+
+    TransactionResult result;
+};
+
+/// The execution of a block.
+class BlockExecution
+{
+    VM& m_vm;
+    const MockedHost& m_state;
+    evmc_revision m_rev;
+    const std::vector<Transaction>& m_txs;
+    VersionedStorage m_storage;
+    std::vector<TransactionState> m_tx_states;
+
+    /// The next transaction to be executed for the first time.
+    std::atomic<size_t> m_next{0};
+
+    /// The transactions scheduled for re-execution.
+    std::deque<size_t> m_queue;
+    std::mutex m_queue_mutex;
+
+    /// The number of committed transactions. Only the thread holding the m_commit_mutex commits.
+    std::atomic<size_t> m_num_committed{0};
+    std::mutex m_commit_mutex;
+
+    bool claim(size_t tx_index) noexcept
+    {
+        auto expected = Status::ready;
+        return m_tx_states[tx_index].status.compare_exchange_strong(expected, Status::executing);
+    }
+
+    void execute(size_t tx_index)
+    {
+        const auto& tx = m_txs[tx_index];
+        auto& s = m_tx_states[tx_index];
+
+        TransactionHost host{m_state, m_storage, tx_index};
+        auto result = m_vm.execute(host, m_rev, tx.msg, tx.code.data(), tx.code.size());
+        auto writes = host.write_set();
+        m_storage.write(tx_index, s.writes, writes);
+
+        s.reads = host.read_set();
+        s.writes = std::move(writes);
+        s.result.result = std::move(result);
+        s.result.logs = std::move(host.recorded_logs);
+        s.result.log_arena = std::move(host.record_arena);
+        s.result.selfdestructs = std::move(host.recorded_selfdestructs);
+        ++s.result.incarnations;
+        s.status.store(Status::executed, std::memory_order_release);
+    }
+
+    /// Checks if the values read by the transaction are still the ones visible to it.
+    bool validate(size_t tx_index)
+    {
+        const auto& reads = m_tx_states[tx_index].reads;
+        return std::all_of(reads.begin(), reads.end(), [this, tx_index](const auto& r) {
+            return m_storage.read(r.first, tx_index) == r.second;
+        });
+    }
+
+    /// Re-schedules the executed transactions following the given one
+    /// which have read any of its writes.
+    void reschedule_dependents(size_t tx_index)
+    {
+        const auto& writes = m_tx_states[tx_index].writes;
+        for (auto i = tx_index + 1; i < m_txs.size(); ++i)
+        {
+            auto& s = m_tx_states[i];
+            if (s.status.load(std::memory_order_acquire) != Status::executed ||
+                !intersects(s.reads, writes))
+                continue;
+
+            s.status.store(Status::ready);
+            const std::lock_guard lock{m_queue_mutex};
+            m_queue.push_back(i);
+        }
+    }
+
+    /// Commits the transactions in order, as far as possible.
+    /// @return  True if any transaction has been committed.
+    bool try_commit()
+    {
+        const std::unique_lock lock{m_commit_mutex, std::try_to_lock};
+        if (!lock.owns_lock())
+            return false;
+
+        const auto first = m_num_committed.load();
+        auto i = first;
+        for (; i < m_txs.size(); ++i)
+        {
+            auto& s = m_tx_states[i];
+            if (claim(i))
+            {
+                // Not executed yet: execute it now, its result is final.
+                execute(i);
+                reschedule_dependents(i);
+            }
+            else if (s.status.load(std::memory_order_acquire) != Status::executed)
+                break;  // Being executed by another thread.
+            else if (!validate(i))
+            {
+                s.status.store(Status::executing);
+                execute(i);
+                reschedule_dependents(i);
+            }
+            s.status.store(Status::committed);
+            m_num_committed.store(i + 1);
+        }
+        return i != first;
+    }
+
+    std::optional<size_t> next_task()
+    {
+        if (m_next.load() < m_txs.size())
+        {
+            if (const auto i = m_next.fetch_add(1); i < m_txs.size() && claim(i))
+                return i;
+        }
+
+        const std::lock_guard lock{m_queue_mutex};
+        while (!m_queue.empty())
+        {
+            const auto i = m_queue.front();
+            m_queue.pop_front();
+            if (claim(i))
+                return i;
+        }
+        return {};
+    }
+
+public:
+    BlockExecution(VM& vm,
+                   const MockedHost& state,
+                   evmc_revision rev,
+                   const std::vector<Transaction>& txs)
+      : m_vm{vm}, m_state{state}, m_rev{rev}, m_txs{txs}, m_storage{state}, m_tx_states(txs.size())
+    {}
+
+    /// The worker loop: commits, executes the scheduled transactions or waits.
+    void work()
+    {
+        while (m_num_committed.load() < m_txs.size())
+        {
+            if (try_commit())
+                continue;
+            if (const auto i = next_task())
+                execute(*i);
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    /// Applies the writes to the state and returns the results.
+    std::vector<TransactionResult> finish(MockedHost& state)
+    {
+        std::vector<TransactionResult> results;
+        results.reserve(m_tx_states.size());
+        for (auto& s : m_tx_states)
+        {
+            for (const auto& [loc, value] : s.writes)
+            {
+                auto& storage_value = state.accounts[loc.addr].storage[loc.key];
+                storage_value.current = value;
+                storage_value.original = value;
+            }
+            results.emplace_back(std::move(s.result));
+        }
+        return results;
+    }
+};
+}  // namespace
+
+std::vector<TransactionResult> Executor::execute(MockedHost& state,
+                                                 evmc_revision rev,
+                                                 const std::vector<Transaction>& txs)
+{
+    BlockExecution block{m_vm, state, rev, txs};
+
+    std::vector<std::thread> threads;
+    const auto num_threads = std::min(size_t{m_num_threads}, std::max(txs.size(), size_t{1}));
+    threads.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; ++i)
+        threads.emplace_back([&block] { block.work(); });
+    block.work();
+    for (auto& t : threads)
+        t.join();
+
+    return block.finish(state);
+}
+}  // namespace evmc::parallel
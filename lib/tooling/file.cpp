@@ -0,0 +1,103 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/hex.hpp>
+#include <evmc/tooling.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace evmc::tooling
+{
+
+bool FileBytes::is_binary_path(const std::string& path) noexcept
+{
+    constexpr std::string_view ext = ".bin";
+    return path.size() >= ext.size() &&
+           path.compare(path.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+FileBytes::FileBytes(const std::string& path)
+{
+    // The directory can be opened as a file, but reading it fails.
+    if (std::error_code ec; std::filesystem::is_directory(path, ec))
+        throw std::invalid_argument{"cannot open " + path + ": is a directory"};
+
+    if (!is_binary_path(path))
+    {
+        std::ifstream file{path};
+        if (!file)
+            throw std::invalid_argument{"cannot open " + path};
+        auto decoded = from_spaced_hex(std::istreambuf_iterator<char>{file},
+                                       std::istreambuf_iterator<char>{});
+        if (!decoded)
+            throw std::invalid_argument{"invalid hex in " + path};
+        m_decoded = std::move(*decoded);
+        m_view = m_decoded;
+        return;
+    }
+
+#ifndef _WIN32
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::invalid_argument{"cannot open " + path};
+    struct stat st = {};
+    if (::fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        throw std::invalid_argument{"cannot open " + path};
+    }
+
+    // The empty file cannot be mapped.
+    if (st.st_size > 0)
+    {
+        const auto size = static_cast<size_t>(st.st_size);
+        void* const mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            ::close(fd);
+            throw std::invalid_argument{"cannot map " + path};
+        }
+        m_mapping = mapping;
+        m_mapping_size = size;
+        m_view = {static_cast<const uint8_t*>(mapping), size};
+    }
+    ::close(fd);  // The mapping stays valid.
+#else
+    // Without mmap the file is read to the memory.
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+        throw std::invalid_argument{"cannot open " + path};
+    m_decoded.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+    m_view = m_decoded;
+#endif
+}
+
+FileBytes::~FileBytes()
+{
+#ifndef _WIN32
+    if (m_mapping != nullptr)
+        ::munmap(m_mapping, m_mapping_size);
+#endif
+}
+
+FileBytes::FileBytes(FileBytes&& other) noexcept
+  : m_mapping{other.m_mapping},
+    m_mapping_size{other.m_mapping_size},
+    m_decoded{std::move(other.m_decoded)},
+    m_view{m_mapping != nullptr ? other.m_view : bytes_view{m_decoded}}
+{
+    other.m_mapping = nullptr;
+    other.m_mapping_size = 0;
+    other.m_view = {};
+}
+}  // namespace evmc::tooling
@@ -0,0 +1,154 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/hex.hpp>
+#include <evmc/instructions.h>
+#include <evmc/tooling.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace evmc::tooling
+{
+namespace
+{
+Profiler& get_profiler(evmc_tracer_context* context) noexcept
+{
+    return *reinterpret_cast<Profiler*>(context);
+}
+
+int64_t to_ns(Profiler::clock::duration d) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+}
+}  // namespace
+
+Profiler::Profiler(evmc_revision rev) noexcept : m_names{evmc_get_instruction_names_table(rev)}
+{
+    m_tracer.context = reinterpret_cast<evmc_tracer_context*>(this);
+    m_tracer.on_call_start = on_call_start;
+    m_tracer.on_step = on_step;
+    m_tracer.on_call_end = on_call_end;
+}
+
+void Profiler::finish_step(size_t depth, int64_t gas_left, clock::time_point now) noexcept
+{
+    if (depth >= m_steps.size() || !m_steps[depth].active)
+        return;
+
+    auto& step = m_steps[depth];
+    const auto gas_used = step.gas_left - gas_left;
+    const auto time = now - step.start;
+
+    auto& op_stats = m_opcodes[step.opcode];
+    ++op_stats.count;
+    op_stats.gas_used += gas_used;
+    op_stats.time += time;
+
+    if (depth == 0)
+    {
+        auto& pc_stats = m_pcs[step.pc];
+        pc_stats.opcode = step.opcode;
+        ++pc_stats.count;
+        pc_stats.gas_used += gas_used;
+        pc_stats.time += time;
+    }
+    step.active = false;
+}
+
+void Profiler::on_call_start(evmc_tracer_context* context, const evmc_message* msg)
+{
+    auto& p = get_profiler(context);
+    if (p.m_top_depth < 0)
+        p.m_top_depth = msg->depth;
+    if (msg->depth < p.m_top_depth)
+        return;
+
+    const auto depth = static_cast<size_t>(msg->depth - p.m_top_depth);
+    if (depth >= p.m_steps.size())
+        p.m_steps.resize(depth + 1);
+}
+
+void Profiler::on_step(evmc_tracer_context* context,
+                       int32_t depth,
+                       uint32_t pc,
+                       uint8_t opcode,
+                       int64_t gas_left,
+                       uint32_t /*stack_height*/,
+                       const evmc_uint256be* /*stack_top*/)
+{
+    const auto now = clock::now();
+    auto& p = get_profiler(context);
+    if (p.m_top_depth < 0 || depth < p.m_top_depth)
+        return;
+
+    const auto d = static_cast<size_t>(depth - p.m_top_depth);
+    p.finish_step(d, gas_left, now);
+    if (d >= p.m_steps.size())
+        p.m_steps.resize(d + 1);
+
+    auto& step = p.m_steps[d];
+    step.active = true;
+    step.opcode = opcode;
+    step.pc = pc;
+    step.gas_left = gas_left;
+    step.start = clock::now();  // Excludes the profiler bookkeeping time.
+}
+
+void Profiler::on_call_end(evmc_tracer_context* context, int32_t depth, const evmc_result* result)
+{
+    const auto now = clock::now();
+    auto& p = get_profiler(context);
+    if (p.m_top_depth < 0 || depth < p.m_top_depth)
+        return;
+
+    p.finish_step(static_cast<size_t>(depth - p.m_top_depth), result->gas_left, now);
+}
+
+void Profiler::report(std::ostream& out, size_t num_hot_pcs) const
+{
+    const auto name = [this](uint8_t opcode) {
+        return (m_names != nullptr && m_names[opcode] != nullptr) ? std::string{m_names[opcode]} :
+                                                                    "0x" + hex(opcode);
+    };
+    const auto by_time = [](const auto& a, const auto& b) {
+        return a.second.time > b.second.time ||
+               (a.second.time == b.second.time && a.first < b.first);
+    };
+
+    std::vector<std::pair<uint8_t, Stats>> opcodes;
+    for (size_t op = 0; op < m_opcodes.size(); ++op)
+    {
+        if (m_opcodes[op].count != 0)
+            opcodes.emplace_back(static_cast<uint8_t>(op), m_opcodes[op]);
+    }
+    std::sort(opcodes.begin(), opcodes.end(), by_time);
+
+    out << "Profile:\n"
+        << std::left << std::setw(16) << "Opcode" << std::right << std::setw(12) << "Count"
+        << std::setw(14) << "Gas" << std::setw(14) << "Time [ns]" << "\n";
+    for (const auto& [opcode, stats] : opcodes)
+    {
+        out << std::left << std::setw(16) << name(opcode) << std::right << std::setw(12)
+            << stats.count << std::setw(14) << stats.gas_used << std::setw(14) << to_ns(stats.time)
+            << "\n";
+    }
+
+    std::vector<std::pair<uint32_t, PcStats>> pcs{m_pcs.begin(), m_pcs.end()};
+    std::sort(pcs.begin(), pcs.end(), by_time);
+    if (pcs.size() > num_hot_pcs)
+        pcs.resize(num_hot_pcs);
+
+    out << "Hot PCs:\n"
+        << std::left << std::setw(8) << "PC" << std::setw(16) << "Opcode" << std::right
+        << std::setw(12) << "Count" << std::setw(14) << "Gas" << std::setw(14) << "Time [ns]"
+        << "\n";
+    for (const auto& [pc, stats] : pcs)
+    {
+        out << std::left << std::setw(8) << pc << std::setw(16) << name(stats.opcode) << std::right
+            << std::setw(12) << stats.count << std::setw(14) << stats.gas_used << std::setw(14)
+            << to_ns(stats.time) << "\n";
+    }
+}
+}  // namespace evmc::tooling
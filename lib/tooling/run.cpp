@@ -6,8 +6,16 @@
 #include <evmc/hex.hpp>
 #include <evmc/mocked_host.hpp>
 #include <evmc/tooling.hpp>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <numeric>
 #include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace evmc::tooling
 {
@@ -22,42 +30,233 @@ constexpr auto create_gas = 10'000'000;
 /// MAGIC bytes denoting an EOF container.
 constexpr uint8_t MAGIC[] = {0xef, 0x00};
 
-auto bench(MockedHost& host,
+/// The statistics of the benchmark execution times, in nanoseconds.
+struct BenchStats
+{
+    int64_t mean = 0;
+    int64_t min = 0;
+    int64_t median = 0;
+    int64_t p90 = 0;
+    int64_t p99 = 0;
+    int64_t stddev = 0;
+};
+
+/// Computes the statistics of the execution times.
+/// The percentiles use the nearest-rank method.
+BenchStats compute_stats(std::vector<double> times)
+{
+    std::sort(times.begin(), times.end());
+    const auto n = times.size();
+    const auto percentile = [&](double p) {
+        const auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(n)));
+        return std::llround(times[std::max(rank, size_t{1}) - 1]);
+    };
+
+    const auto mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(n);
+    auto sum_sq = 0.0;
+    for (const auto t : times)
+        sum_sq += (t - mean) * (t - mean);
+    const auto variance = n > 1 ? sum_sq / static_cast<double>(n - 1) : 0.0;
+
+    BenchStats stats;
+    stats.mean = std::llround(mean);
+    stats.min = std::llround(times.front());
+    stats.median = percentile(0.5);
+    stats.p90 = percentile(0.9);
+    stats.p99 = percentile(0.99);
+    stats.stddev = std::llround(std::sqrt(variance));
+    return stats;
+}
+
+/// Executes the code concurrently on the given number of threads sharing the VM instance.
+/// Each thread executes the code the given number of times on its own copy of the Host,
+/// every time reverted to the initial state snapshot.
+/// @return  The aggregate number of executions per second.
+double measure_throughput(const MockedHost& initial_host,
+                          MockedHost::snapshot_id initial_state,
+                          evmc::VM& vm,
+                          evmc_revision rev,
+                          const evmc_message& msg,
+                          bytes_view code,
+                          int num_threads,
+                          int repetitions)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::atomic<int> num_ready{0};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<size_t>(num_threads));
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&] {
+            auto host = initial_host;
+            // The analysis slot is Host-owned state, so each thread needs its own.
+            evmc_code_analysis_slot code_analysis{};
+            auto thread_msg = msg;
+            thread_msg.code_analysis = &code_analysis;
+
+            ++num_ready;
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            for (int i = 0; i < repetitions; ++i)
+            {
+                host.revert(initial_state);
+                vm.execute(host, rev, thread_msg, code.data(), code.size());
+            }
+            vm.release_code_analysis(code_analysis);
+        });
+    }
+
+    while (num_ready.load() != num_threads)
+        std::this_thread::yield();
+    const auto start = clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+        thread.join();
+    const auto elapsed = std::chrono::duration<double>{clock::now() - start}.count();
+
+    return static_cast<double>(num_threads) * repetitions / elapsed;
+}
+
+void bench(MockedHost& host,
+           MockedHost::snapshot_id initial_state,
            evmc::VM& vm,
            evmc_revision rev,
            const evmc_message& msg,
            bytes_view code,
            const evmc::Result& expected_result,
+           const BenchOptions& options,
            std::ostream& out)
 {
-    {
-        using clock = std::chrono::steady_clock;
-        using unit = std::chrono::nanoseconds;
-        constexpr auto unit_name = " ns";
-        constexpr auto target_bench_time = std::chrono::seconds{1};
-        constexpr auto warning =
-            "WARNING! Inconsistent execution result likely due to the use of storage ";
-
-        // Probe run: execute once again the already warm code to estimate a single run time.
-        const auto probe_start = clock::now();
-        const auto result = vm.execute(host, rev, msg, code.data(), code.size());
-        const auto bench_start = clock::now();
-        const auto probe_time = bench_start - probe_start;
+    using clock = std::chrono::steady_clock;
+    constexpr auto target_bench_time = std::chrono::seconds{1};
+    constexpr auto max_auto_repetitions = 100'000;
+    constexpr auto warning =
+        "WARNING! Inconsistent execution result likely due to the use of storage ";
+
+    // Executes the code from the initial Host state and measures the execution time.
+    // This way the state modifications of one execution do not affect the following ones.
+    const auto execute = [&] {
+        host.revert(initial_state);
+        const auto start = clock::now();
+        auto result = vm.execute(host, rev, msg, code.data(), code.size());
+        return std::pair{clock::now() - start, std::move(result)};
+    };
 
+    const auto check_result = [&](const evmc::Result& result) {
         if (result.gas_left != expected_result.gas_left)
             out << warning << "(gas used: " << (msg.gas - result.gas_left) << ")\n";
         if (bytes_view{result.output_data, result.output_size} !=
             bytes_view{expected_result.output_data, expected_result.output_size})
             out << warning << "(output: " << hex({result.output_data, result.output_size}) << ")\n";
+    };
 
-        // Benchmark loop.
-        const auto num_iterations = std::max(static_cast<int>(target_bench_time / probe_time), 1);
-        for (int i = 0; i < num_iterations; ++i)
-            vm.execute(host, rev, msg, code.data(), code.size());
-        const auto bench_time = (clock::now() - bench_start) / num_iterations;
+    clock::duration warmup_time{};
+    for (int i = 0; i < options.warmup; ++i)
+    {
+        const auto [time, result] = execute();
+        warmup_time += time;
+        if (i == 0)
+            check_result(result);
+    }
 
-        out << "Time:     " << std::chrono::duration_cast<unit>(bench_time).count() << unit_name
-            << " (avg of " << num_iterations << " iterations)\n";
+    auto repetitions = options.repetitions;
+    if (repetitions <= 0)
+    {
+        const auto probe_time =
+            std::max(options.warmup > 0 ? warmup_time / options.warmup : execute().first,
+                     clock::duration{1});
+        const auto estimated_repetitions = target_bench_time / probe_time;
+        repetitions = static_cast<int>(std::clamp<decltype(estimated_repetitions)>(
+            estimated_repetitions, 1, max_auto_repetitions));
+    }
+
+    std::vector<double> times;
+    times.reserve(static_cast<size_t>(repetitions));
+    for (int i = 0; i < repetitions; ++i)
+    {
+        const auto [time, result] = execute();
+        times.push_back(std::chrono::duration<double, std::nano>{time}.count());
+        if (i == 0 && options.warmup <= 0)
+            check_result(result);
+    }
+
+    const auto stats = compute_stats(std::move(times));
+    const auto gas_used = msg.gas - expected_result.gas_left;
+    const auto gas_rate =
+        stats.mean > 0 ? static_cast<int64_t>(static_cast<double>(gas_used) * 1e9 /
+                                              static_cast<double>(stats.mean)) :
+                         int64_t{0};
+
+    // Multi-threaded throughput compared with the same workload on a single thread.
+    auto single_rate = 0.0;
+    auto multi_rate = 0.0;
+    auto efficiency = 0.0;
+    if (options.threads > 1)
+    {
+        host.revert(initial_state);
+        single_rate =
+            measure_throughput(host, initial_state, vm, rev, msg, code, 1, repetitions);
+        multi_rate = measure_throughput(host, initial_state, vm, rev, msg, code, options.threads,
+                                        repetitions);
+        efficiency = std::round(multi_rate / (options.threads * single_rate) * 1000) / 1000;
+    }
+
+    switch (options.format)
+    {
+    case BenchFormat::text:
+        out << "Time:     " << stats.mean << " ns (avg of " << repetitions << " iterations)\n"
+            << "Min:      " << stats.min << " ns\n"
+            << "Median:   " << stats.median << " ns\n"
+            << "P90:      " << stats.p90 << " ns\n"
+            << "P99:      " << stats.p99 << " ns\n"
+            << "Stddev:   " << stats.stddev << " ns\n"
+            << "Gas rate: " << gas_rate << " gas/s\n";
+        if (options.threads > 1)
+        {
+            out << "Threads:  " << options.threads << "\n"
+                << "Rate:     " << std::llround(multi_rate)
+                << " exec/s (single thread: " << std::llround(single_rate) << " exec/s)\n"
+                << "Scaling:  " << std::llround(efficiency * 100) << "%\n";
+        }
+        break;
+    case BenchFormat::json:
+        out << "{\"iterations\":" << repetitions << ",\"warmup\":" << options.warmup
+            << ",\"gas_used\":" << gas_used << ",\"mean_ns\":" << stats.mean
+            << ",\"min_ns\":" << stats.min << ",\"median_ns\":" << stats.median
+            << ",\"p90_ns\":" << stats.p90 << ",\"p99_ns\":" << stats.p99
+            << ",\"stddev_ns\":" << stats.stddev << ",\"gas_per_second\":" << gas_rate;
+        if (options.threads > 1)
+        {
+            out << ",\"threads\":" << options.threads
+                << ",\"executions_per_second\":" << std::llround(multi_rate)
+                << ",\"single_thread_executions_per_second\":" << std::llround(single_rate)
+                << ",\"scaling_efficiency\":" << efficiency;
+        }
+        out << "}\n";
+        break;
+    case BenchFormat::csv:
+        out << "iterations,warmup,gas_used,mean_ns,min_ns,median_ns,p90_ns,p99_ns,stddev_ns,"
+               "gas_per_second";
+        if (options.threads > 1)
+        {
+            out << ",threads,executions_per_second,single_thread_executions_per_second,"
+                   "scaling_efficiency";
+        }
+        out << "\n"
+            << repetitions << "," << options.warmup << "," << gas_used << "," << stats.mean << ","
+            << stats.min << "," << stats.median << "," << stats.p90 << "," << stats.p99 << ","
+            << stats.stddev << "," << gas_rate;
+        if (options.threads > 1)
+        {
+            out << "," << options.threads << "," << std::llround(multi_rate) << ","
+                << std::llround(single_rate) << "," << efficiency;
+        }
+        out << "\n";
+        break;
     }
 }
 
@@ -65,6 +264,21 @@ bool is_eof_container(bytes_view code)
 {
     return code.size() >= 2 && code[0] == MAGIC[0] && code[1] == MAGIC[1];
 }
+
+/// Executes the initcode creating the contract at the create_address.
+/// If successful, the output of the execution becomes the code of the created account.
+Result create_contract(VM& vm, evmc_revision rev, MockedHost& host, bytes_view initcode)
+{
+    evmc_message create_msg{};
+    create_msg.kind = is_eof_container(initcode) ? EVMC_EOFCREATE : EVMC_CREATE;
+    create_msg.recipient = create_address;
+    create_msg.gas = create_gas;
+
+    auto result = vm.execute(host, rev, create_msg, initcode.data(), initcode.size());
+    if (result.status_code == EVMC_SUCCESS)
+        host.accounts[create_address].code = bytes(result.output_data, result.output_size);
+    return result;
+}
 }  // namespace
 
 int run(VM& vm,
@@ -73,10 +287,20 @@ int run(VM& vm,
         bytes_view code,
         bytes_view input,
         bool create,
-        bool bench,
-        std::ostream& out)
+        const std::optional<BenchOptions>& bench,
+        std::ostream& out,
+        std::ostream* trace,
+        bool profile)
 {
-    out << (create ? "Creating and executing on " : "Executing on ") << rev << " with " << gas
+    if (trace != nullptr && profile)
+        throw std::invalid_argument{"the trace and the profile are exclusive"};
+
+    // The document of a structured benchmark format is the only output, so it can be parsed.
+    // The human-readable lines are dropped then.
+    std::ostream null_out{nullptr};
+    auto& info = (bench && bench->format != BenchFormat::text) ? null_out : out;
+
+    info << (create ? "Creating and executing on " : "Executing on ") << rev << " with " << gas
         << " gas limit\n";
 
     MockedHost host;
@@ -89,37 +313,137 @@ int run(VM& vm,
     bytes_view exec_code = code;
     if (create)
     {
-        evmc_message create_msg{};
-        create_msg.kind = is_eof_container(code) ? EVMC_EOFCREATE : EVMC_CREATE;
-        create_msg.recipient = create_address;
-        create_msg.gas = create_gas;
-
-        const auto create_result = vm.execute(host, rev, create_msg, code.data(), code.size());
+        const auto create_result = create_contract(vm, rev, host, code);
         if (create_result.status_code != EVMC_SUCCESS)
         {
-            out << "Contract creation failed: " << create_result.status_code << "\n";
+            info << "Contract creation failed: " << create_result.status_code << "\n";
             return create_result.status_code;
         }
 
-        auto& created_account = host.accounts[create_address];
-        created_account.code = bytes(create_result.output_data, create_result.output_size);
-
         msg.recipient = create_address;
-        exec_code = created_account.code;
+        exec_code = host.accounts[create_address].code;
+    }
+    info << "\n";
+
+    // Keep the VM's analysis of the executed code between the repeated executions.
+    evmc_code_analysis_slot code_analysis{};
+    msg.code_analysis = &code_analysis;
+
+    // Snapshot the state so that every benchmark execution starts from it.
+    const auto initial_state = host.snapshot();
+
+    std::optional<TraceWriter> trace_writer;
+    if (trace != nullptr)
+    {
+        trace_writer.emplace(*trace);
+        host.tracer = &trace_writer->tracer();
+    }
+    std::optional<Profiler> profiler;
+    if (profile)
+    {
+        profiler.emplace(rev);
+        host.tracer = &profiler->tracer();
     }
-    out << "\n";
 
     const auto result = vm.execute(host, rev, msg, exec_code.data(), exec_code.size());
 
+    host.tracer = nullptr;
+    if (trace_writer)
+        trace_writer->flush();
+
     if (bench)
-        tooling::bench(host, vm, rev, msg, exec_code, result, out);
+        tooling::bench(host, initial_state, vm, rev, msg, exec_code, result, *bench, out);
 
     const auto gas_used = msg.gas - result.gas_left;
-    out << "Result:   " << result.status_code << "\nGas used: " << gas_used << "\n";
+    info << "Result:   " << result.status_code << "\nGas used: " << gas_used << "\n";
 
     if (result.status_code == EVMC_SUCCESS || result.status_code == EVMC_REVERT)
-        out << "Output:   " << hex({result.output_data, result.output_size}) << "\n";
+        info << "Output:   " << hex({result.output_data, result.output_size}) << "\n";
 
+    if (trace_writer)
+        info << "Trace:    " << trace_writer->num_records() << " records\n";
+    if (profiler)
+        profiler->report(info);
+
+    vm.release_code_analysis(code_analysis);
     return 0;
 }
+
+int run_corpus(VM& vm,
+               evmc_revision rev,
+               int64_t gas,
+               const std::string& dir,
+               bytes_view input,
+               bool create,
+               std::ostream& out)
+{
+    std::error_code ec;
+    std::vector<std::filesystem::path> paths;
+    for (const auto& entry : std::filesystem::directory_iterator{dir, ec})
+    {
+        if (entry.is_regular_file())
+            paths.push_back(entry.path());
+    }
+    if (ec)
+        throw std::invalid_argument{"cannot read the corpus directory " + dir};
+    std::sort(paths.begin(), paths.end());
+
+    out << (create ? "Creating and executing " : "Executing ") << paths.size()
+        << " contracts on " << rev << " with " << gas << " gas limit\n\n";
+
+    const auto start = std::chrono::steady_clock::now();
+    size_t num_failed = 0;
+    int64_t total_gas_used = 0;
+    for (const auto& path : paths)
+    {
+        const FileBytes code{path.string()};
+        MockedHost host;
+        out << path.filename().string() << ": ";
+
+        bytes_view exec_code = code.view();
+        evmc_message msg{};
+        msg.gas = gas;
+        msg.input_data = input.data();
+        msg.input_size = input.size();
+        if (create)
+        {
+            const auto create_result = create_contract(vm, rev, host, exec_code);
+            if (create_result.status_code != EVMC_SUCCESS)
+            {
+                out << "creation failed: " << create_result.status_code << "\n";
+                ++num_failed;
+                continue;
+            }
+            msg.recipient = create_address;
+            exec_code = host.accounts[create_address].code;
+        }
+
+        const auto result = vm.execute(host, rev, msg, exec_code.data(), exec_code.size());
+        const auto gas_used = msg.gas - result.gas_left;
+        total_gas_used += gas_used;
+        out << result.status_code << ", gas used: " << gas_used << "\n";
+        if (result.status_code != EVMC_SUCCESS && result.status_code != EVMC_REVERT)
+            ++num_failed;
+    }
+    const auto elapsed = std::chrono::duration<double, std::milli>{
+        std::chrono::steady_clock::now() - start};
+
+    out << "\nExecuted: " << paths.size() << " contracts, " << num_failed << " failed\n"
+        << "Gas used: " << total_gas_used << "\n"
+        << "Time:     " << std::llround(elapsed.count()) << " ms\n";
+    return num_failed == 0 ? 0 : 1;
+}
+
+int run(VM& vm,
+        evmc_revision rev,
+        int64_t gas,
+        bytes_view code,
+        bytes_view input,
+        bool create,
+        bool bench,
+        std::ostream& out)
+{
+    return run(vm, rev, gas, code, input, create,
+               bench ? std::optional{BenchOptions{}} : std::nullopt, out);
+}
 }  // namespace evmc::tooling
@@ -0,0 +1,996 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/evmc.hpp>
+#include <evmc/hex.hpp>
+#include <evmc/instructions.hpp>
+#include <evmc/mocked_host.hpp>
+#include <evmc/tooling.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace evmc::tooling
+{
+namespace
+{
+/// The JSON value.
+struct Json
+{
+    enum class Kind
+    {
+        null,
+        boolean,
+        number,
+        string,
+        array,
+        object,
+    };
+
+    Kind kind = Kind::null;
+
+    /// The value of the boolean.
+    bool boolean = false;
+
+    /// The decoded string or the literal of the number.
+    std::string text;
+
+    /// The elements of the array or the values of the object's members.
+    std::vector<Json> values;
+
+    /// The names of the object's members, in the order of the values.
+    std::vector<std::string> keys;
+
+    /// Returns the value of the object's member or null if there is no such member.
+    const Json* find(std::string_view key) const noexcept
+    {
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            if (keys[i] == key)
+                return &values[i];
+        }
+        return nullptr;
+    }
+
+    /// Returns the value of the object's member.
+    /// @throws std::invalid_argument  If there is no such member.
+    const Json& at(std::string_view key) const
+    {
+        const auto* const value = find(key);
+        if (value == nullptr)
+            throw std::invalid_argument{"missing \"" + std::string{key} + "\""};
+        return *value;
+    }
+};
+
+/// The recursive descent parser of the JSON text (RFC 8259).
+class JsonParser
+{
+    /// The maximum nesting depth of arrays and objects.
+    static constexpr int max_depth = 64;
+
+    std::string_view m_text;
+    size_t m_pos = 0;
+
+public:
+    explicit JsonParser(std::string_view text) noexcept : m_text{text} {}
+
+    /// Parses the text as a single JSON value.
+    /// @throws std::invalid_argument  If the text is not valid JSON.
+    Json parse()
+    {
+        auto value = parse_value(0);
+        skip_whitespace();
+        if (m_pos != m_text.size())
+            error("unexpected character after the value");
+        return value;
+    }
+
+private:
+    [[noreturn]] void error(const char* message) const
+    {
+        throw std::invalid_argument{"invalid JSON at offset " + std::to_string(m_pos) + ": " +
+                                    message};
+    }
+
+    void skip_whitespace() noexcept
+    {
+        while (m_pos < m_text.size() && (m_text[m_pos] == ' ' || m_text[m_pos] == '\t' ||
+                                         m_text[m_pos] == '\n' || m_text[m_pos] == '\r'))
+            ++m_pos;
+    }
+
+    /// Skips the whitespace and consumes the character if it is the next one.
+    bool consume(char c) noexcept
+    {
+        skip_whitespace();
+        if (m_pos == m_text.size() || m_text[m_pos] != c)
+            return false;
+        ++m_pos;
+        return true;
+    }
+
+    void expect(char c)
+    {
+        if (!consume(c))
+            error((std::string{"expected '"} + c + "'").c_str());
+    }
+
+    void expect_literal(std::string_view literal)
+    {
+        if (m_text.substr(m_pos, literal.size()) != literal)
+            error("invalid literal");
+        m_pos += literal.size();
+    }
+
+    Json parse_value(int depth)
+    {
+        if (depth > max_depth)
+            error("too deep nesting");
+
+        skip_whitespace();
+        if (m_pos == m_text.size())
+            error("unexpected end");
+
+        Json value;
+        switch (m_text[m_pos])
+        {
+        case '{':
+            ++m_pos;
+            value.kind = Json::Kind::object;
+            if (consume('}'))
+                break;
+            do
+            {
+                skip_whitespace();
+                value.keys.emplace_back(parse_string());
+                expect(':');
+                value.values.emplace_back(parse_value(depth + 1));
+            } while (consume(','));
+            expect('}');
+            break;
+        case '[':
+            ++m_pos;
+            value.kind = Json::Kind::array;
+            if (consume(']'))
+                break;
+            do
+            {
+                value.values.emplace_back(parse_value(depth + 1));
+            } while (consume(','));
+            expect(']');
+            break;
+        case '"':
+            value.kind = Json::Kind::string;
+            value.text = parse_string();
+            break;
+        case 't':
+            expect_literal("true");
+            value.kind = Json::Kind::boolean;
+            value.boolean = true;
+            break;
+        case 'f':
+            expect_literal("false");
+            value.kind = Json::Kind::boolean;
+            break;
+        case 'n':
+            expect_literal("null");
+            break;
+        default:
+            value.kind = Json::Kind::number;
+            value.text = parse_number();
+            break;
+        }
+        return value;
+    }
+
+    std::string parse_number()
+    {
+        const auto is_digit = [this] {
+            return m_pos < m_text.size() && m_text[m_pos] >= '0' && m_text[m_pos] <= '9';
+        };
+        const auto skip_digits = [&] {
+            if (!is_digit())
+                error("invalid number");
+            while (is_digit())
+                ++m_pos;
+        };
+
+        const auto begin = m_pos;
+        if (m_text[m_pos] == '-')
+            ++m_pos;
+        skip_digits();
+        if (m_pos < m_text.size() && m_text[m_pos] == '.')
+        {
+            ++m_pos;
+            skip_digits();
+        }
+        if (m_pos < m_text.size() && (m_text[m_pos] == 'e' || m_text[m_pos] == 'E'))
+        {
+            ++m_pos;
+            if (m_pos < m_text.size() && (m_text[m_pos] == '+' || m_text[m_pos] == '-'))
+                ++m_pos;
+            skip_digits();
+        }
+        return std::string{m_text.substr(begin, m_pos - begin)};
+    }
+
+    uint32_t parse_hex4()
+    {
+        if (m_text.size() - m_pos < 4)
+            error("invalid escape");
+        uint32_t code = 0;
+        for (const auto c : m_text.substr(m_pos, 4))
+        {
+            const auto digit = internal::from_hex_digit(c);
+            if (digit < 0)
+                error("invalid escape");
+            code = (code << 4) | static_cast<uint32_t>(digit);
+        }
+        m_pos += 4;
+        return code;
+    }
+
+    /// Parses the string at the current position, which must be the opening quote.
+    std::string parse_string()
+    {
+        if (m_pos == m_text.size() || m_text[m_pos] != '"')
+            error("expected string");
+        ++m_pos;
+
+        std::string str;
+        while (true)
+        {
+            if (m_pos == m_text.size())
+                error("unterminated string");
+            const auto c = m_text[m_pos++];
+            if (c == '"')
+                return str;
+            if (static_cast<unsigned char>(c) < 0x20)
+                error("control character in string");
+            if (c != '\\')
+            {
+                str += c;
+                continue;
+            }
+
+            if (m_pos == m_text.size())
+                error("unterminated string");
+            switch (m_text[m_pos++])
+            {
+            case '"':
+                str += '"';
+                break;
+            case '\\':
+                str += '\\';
+                break;
+            case '/':
+                str += '/';
+                break;
+            case 'b':
+                str += '\b';
+                break;
+            case 'f':
+                str += '\f';
+                break;
+            case 'n':
+                str += '\n';
+                break;
+            case 'r':
+                str += '\r';
+                break;
+            case 't':
+                str += '\t';
+                break;
+            case 'u':
+            {
+                auto code = parse_hex4();
+                if (code >= 0xd800 && code < 0xdc00 && m_text.substr(m_pos, 2) == "\\u")
+                {
+                    m_pos += 2;
+                    const auto low = parse_hex4();
+                    if (low < 0xdc00 || low >= 0xe000)
+                        error("invalid surrogate pair");
+                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                }
+                append_utf8(str, code);
+                break;
+            }
+            default:
+                error("invalid escape");
+            }
+        }
+    }
+
+    static void append_utf8(std::string& str, uint32_t code)
+    {
+        const auto put = [&str](uint32_t byte) { str += static_cast<char>(byte); };
+        if (code < 0x80)
+            put(code);
+        else if (code < 0x800)
+        {
+            put(0xc0 | (code >> 6));
+            put(0x80 | (code & 0x3f));
+        }
+        else if (code < 0x10000)
+        {
+            put(0xe0 | (code >> 12));
+            put(0x80 | ((code >> 6) & 0x3f));
+            put(0x80 | (code & 0x3f));
+        }
+        else
+        {
+            put(0xf0 | (code >> 18));
+            put(0x80 | ((code >> 12) & 0x3f));
+            put(0x80 | ((code >> 6) & 0x3f));
+            put(0x80 | (code & 0x3f));
+        }
+    }
+};
+
+/// Returns the text of the JSON string or number.
+const std::string& json_text(const Json& json)
+{
+    if (json.kind != Json::Kind::string && json.kind != Json::Kind::number)
+        throw std::invalid_argument{"expected string or number"};
+    return json.text;
+}
+
+/// Parses the unsigned 256-bit number: hex with the 0x prefix (any number of digits) or decimal.
+uint256be parse_uint256(std::string_view str)
+{
+    uint256be r;
+    if (str.size() >= 2 && str[0] == '0' && str[1] == 'x')
+    {
+        str.remove_prefix(2);
+        while (!str.empty() && str[0] == '0')
+            str.remove_prefix(1);
+        const auto hex = (str.size() % 2 != 0 ? "0" : "") + std::string{str};
+        if (hex.size() > 2 * sizeof(r) ||
+            !from_hex(hex.begin(), hex.end(), &r.bytes[sizeof(r) - hex.size() / 2]))
+            throw std::invalid_argument{"invalid number: 0x" + std::string{str}};
+        return r;
+    }
+
+    if (str.empty())
+        throw std::invalid_argument{"invalid number: empty"};
+    for (const auto c : str)
+    {
+        if (c < '0' || c > '9')
+            throw std::invalid_argument{"invalid number: " + std::string{str}};
+        auto carry = static_cast<unsigned>(c - '0');
+        for (size_t i = sizeof(r); i-- > 0;)
+        {
+            carry += r.bytes[i] * 10u;
+            r.bytes[i] = static_cast<uint8_t>(carry);
+            carry >>= 8;
+        }
+        if (carry != 0)
+            throw std::invalid_argument{"number too big: " + std::string{str}};
+    }
+    return r;
+}
+
+uint256be to_uint256(const Json& json)
+{
+    return parse_uint256(json_text(json));
+}
+
+int64_t to_int64(const Json& json)
+{
+    const auto value = to_uint256(json);
+    constexpr auto offset = sizeof(value) - sizeof(int64_t);
+    if (std::any_of(value.bytes, value.bytes + offset, [](uint8_t b) { return b != 0; }) ||
+        value.bytes[offset] >= 0x80)
+        throw std::invalid_argument{"number too big: " + json.text};
+    return static_cast<int64_t>(load64be(&value.bytes[offset]));
+}
+
+address to_address(const Json& json)
+{
+    const auto& str = json_text(json);
+    const auto addr = from_hex<address>(str);
+    if (!addr)
+        throw std::invalid_argument{"invalid address: " + str};
+    return *addr;
+}
+
+bytes to_bytes(const Json& json)
+{
+    const auto& str = json_text(json);
+    auto data = from_hex(str);
+    if (!data)
+        throw std::invalid_argument{"invalid hex: " + str};
+    return std::move(*data);
+}
+
+const std::vector<Json>& to_array(const Json& json)
+{
+    if (json.kind != Json::Kind::array)
+        throw std::invalid_argument{"expected array"};
+    return json.values;
+}
+
+/// Adds the numbers. Wraps around on overflow, which is not possible for balances.
+uint256be add(const uint256be& a, const uint256be& b) noexcept
+{
+    uint256be r;
+    unsigned carry = 0;
+    for (size_t i = sizeof(r); i-- > 0;)
+    {
+        carry += unsigned{a.bytes[i]} + b.bytes[i];
+        r.bytes[i] = static_cast<uint8_t>(carry);
+        carry >>= 8;
+    }
+    return r;
+}
+
+/// Subtracts the numbers. Nothing if the result would be negative.
+std::optional<uint256be> sub(const uint256be& a, const uint256be& b) noexcept
+{
+    if (a < b)
+        return {};
+    uint256be r;
+    int borrow = 0;
+    for (size_t i = sizeof(r); i-- > 0;)
+    {
+        const auto d = int{a.bytes[i]} - b.bytes[i] - borrow;
+        borrow = d < 0 ? 1 : 0;
+        r.bytes[i] = static_cast<uint8_t>(d + (borrow << 8));
+    }
+    return r;
+}
+
+/// The maximum size of the deployed code (EIP-170).
+constexpr size_t max_code_size = 0x6000;
+
+/// The maximum size of the initcode (EIP-3860).
+constexpr size_t max_initcode_size = 2 * max_code_size;
+
+/// The gas cost of a byte of the deployed code.
+constexpr int64_t code_deposit_cost = 200;
+
+/// The access list of a transaction: the addresses and their storage keys.
+using AccessList = std::vector<std::pair<address, std::vector<bytes32>>>;
+
+/// Returns the intrinsic gas of the transaction: the base cost, the data cost, the access list
+/// cost (EIP-2930) and the initcode cost (EIP-3860).
+int64_t compute_intrinsic_gas(evmc_revision rev,
+                              bytes_view data,
+                              bool create,
+                              const AccessList& access_list) noexcept
+{
+    int64_t gas = 21000;
+    if (create && rev >= EVMC_HOMESTEAD)
+        gas += 32000;
+    const int64_t nonzero_byte_cost = rev >= EVMC_ISTANBUL ? 16 : 68;
+    for (const auto b : data)
+        gas += b == 0 ? 4 : nonzero_byte_cost;
+    for (const auto& [addr, keys] : access_list)
+        gas += 2400 + 1900 * static_cast<int64_t>(keys.size());
+    if (create && rev >= EVMC_SHANGHAI)
+        gas += 2 * static_cast<int64_t>(num_words(data.size()));
+    return gas;
+}
+
+/// The Host executing the nested calls and creates with the VM.
+///
+/// The state modifications of the failed calls are reverted with the MockedHost snapshots.
+/// The nonces are not journaled, so the nonce increments of the creators are not reverted.
+class StateTestHost : public MockedHost
+{
+    VM& m_vm;
+    evmc_revision m_rev;
+    const std::vector<StorageSlot>& m_warm_storage;
+
+public:
+    StateTestHost(const StateTestCase& test, VM& vm)
+      : MockedHost{test.pre}, m_vm{vm}, m_rev{test.rev}, m_warm_storage{test.warm_storage}
+    {}
+
+    evmc_access_status access_storage(const address& addr, const bytes32& key) noexcept override
+    {
+        const auto access_status = MockedHost::access_storage(addr, key);
+        const StorageSlot slot{addr, key};
+        if (std::find(m_warm_storage.begin(), m_warm_storage.end(), slot) != m_warm_storage.end())
+            return EVMC_ACCESS_WARM;
+        return access_status;
+    }
+
+    Result call(const evmc_message& orig_msg) noexcept override
+    {
+        auto msg = orig_msg;
+        msg.code_analysis = nullptr;
+
+        const auto is_create = msg.kind == EVMC_CREATE || msg.kind == EVMC_CREATE2;
+        const auto sender_it = accounts.find(msg.sender);
+        if (msg.kind != EVMC_DELEGATECALL && !is_zero(msg.value))
+        {
+            if (sender_it == accounts.end() || sender_it->second.balance < msg.value)
+                return Result{EVMC_INSUFFICIENT_BALANCE, msg.gas};
+        }
+
+        if (is_create)
+        {
+            if (sender_it == accounts.end())
+                return Result{EVMC_INTERNAL_ERROR};
+            auto& nonce = sender_it->second.nonce;
+            msg.recipient = compute_create_address(msg, nonce);
+            msg.code_address = msg.recipient;
+            ++nonce;
+        }
+
+        const auto checkpoint = snapshot();
+        if (is_create)
+            access_account(msg.recipient);
+        if (msg.kind != EVMC_DELEGATECALL && !is_zero(msg.value))
+        {
+            set_balance(msg.sender, *sub(sender_it->second.balance, msg.value));
+
+            // The recipient is created by the journaled set_balance(), not by looking it up.
+            const auto recipient_it = accounts.find(msg.recipient);
+            const auto recipient_balance =
+                recipient_it != accounts.end() ? recipient_it->second.balance : uint256be{};
+            set_balance(msg.recipient, add(recipient_balance, msg.value));
+        }
+
+        auto result = is_create ? create(msg) : execute(msg);
+        if (result.status_code != EVMC_SUCCESS)
+            revert(checkpoint);
+        return result;
+    }
+
+private:
+    /// Computes the address of the created account.
+    ///
+    /// Without Keccak-256 the address is not the one of Ethereum, but derived from the creator
+    /// address and the nonce (CREATE) or the salt (CREATE2), so it is also deterministic and
+    /// unique for the creator.
+    static address compute_create_address(const evmc_message& msg, int nonce) noexcept
+    {
+        const auto key =
+            msg.kind == EVMC_CREATE2 ? msg.create2_salt : bytes32{static_cast<uint64_t>(nonce)};
+        auto addr = msg.sender;
+        for (size_t i = 0; i < sizeof(addr); ++i)
+            addr.bytes[i] ^= key.bytes[sizeof(key) - sizeof(addr) + i];
+        addr.bytes[0] ^= msg.kind == EVMC_CREATE2 ? 0xc2 : 0xc1;
+        return addr;
+    }
+
+    Result execute(const evmc_message& msg) noexcept
+    {
+        // The code address of CALL and STATICCALL is the recipient.
+        // The precompiles are executed as accounts without code.
+        const auto it = accounts.find(msg.kind == EVMC_CALL ? msg.recipient : msg.code_address);
+        if (it == accounts.end() || it->second.code.empty())
+            return Result{EVMC_SUCCESS, msg.gas};
+        const auto& code = it->second.code;
+        return m_vm.execute(*this, m_rev, msg, code.data(), code.size());
+    }
+
+    Result create(const evmc_message& msg) noexcept
+    {
+        if (m_rev >= EVMC_SHANGHAI && msg.input_size > max_initcode_size)
+            return Result{EVMC_OUT_OF_GAS};
+
+        const auto existing = accounts.find(msg.recipient);
+        if (existing != accounts.end() &&
+            (existing->second.nonce != 0 || !existing->second.code.empty()))
+            return Result{EVMC_FAILURE};
+
+        set_code(msg.recipient, {}, {});  // Create the account, journaled.
+        if (m_rev >= EVMC_SPURIOUS_DRAGON)
+            accounts[msg.recipient].nonce = 1;
+
+        // The initcode is executed with empty input.
+        auto init_msg = msg;
+        init_msg.input_data = nullptr;
+        init_msg.input_size = 0;
+        auto result = m_vm.execute(*this, m_rev, init_msg, msg.input_data, msg.input_size);
+        if (result.status_code != EVMC_SUCCESS)
+            return result;
+
+        const bytes_view code{result.output_data, result.output_size};
+        if (m_rev >= EVMC_SPURIOUS_DRAGON && code.size() > max_code_size)
+            return Result{EVMC_OUT_OF_GAS};
+        if (m_rev >= EVMC_LONDON && !code.empty() && code[0] == 0xef)
+            return Result{EVMC_CONTRACT_VALIDATION_FAILURE};
+
+        auto gas_left = result.gas_left;
+        const auto cost = code_deposit_cost * static_cast<int64_t>(code.size());
+        if (gas_left >= cost)
+        {
+            gas_left -= cost;
+            set_code(msg.recipient, bytes{code}, {});
+        }
+        else if (m_rev >= EVMC_HOMESTEAD)
+            return Result{EVMC_OUT_OF_GAS};
+
+        return Result{EVMC_SUCCESS, gas_left, result.gas_refund, msg.recipient};
+    }
+};
+
+/// Loads the test cases of the single state test of the fixture.
+void load_state_test(const std::string& name, const Json& test, std::vector<StateTestCase>& out)
+{
+    MockedHost state;
+
+    const auto& env = test.at("env");
+    auto& tx_context = state.tx_context;
+    tx_context.block_coinbase = to_address(env.at("currentCoinbase"));
+    tx_context.block_number = to_int64(env.at("currentNumber"));
+    tx_context.block_timestamp = to_int64(env.at("currentTimestamp"));
+    tx_context.block_gas_limit = to_int64(env.at("currentGasLimit"));
+    if (const auto* randao = env.find("currentRandom"); randao != nullptr)
+        tx_context.block_prev_randao = to_uint256(*randao);
+    else if (const auto* difficulty = env.find("currentDifficulty"); difficulty != nullptr)
+        tx_context.block_prev_randao = to_uint256(*difficulty);
+    const auto* const base_fee = env.find("currentBaseFee");
+    if (base_fee != nullptr)
+        tx_context.block_base_fee = to_uint256(*base_fee);
+    tx_context.chain_id = uint256be{1};
+    if (const auto* prev_hash = env.find("previousHash"); prev_hash != nullptr)
+        state.block_hash = to_uint256(*prev_hash);
+
+    const auto& pre = test.at("pre");
+    for (size_t i = 0; i < pre.keys.size(); ++i)
+    {
+        const auto addr = from_hex<address>(pre.keys[i]);
+        if (!addr)
+            throw std::invalid_argument{"invalid address: " + pre.keys[i]};
+        const auto& account_json = pre.values[i];
+        auto& account = state.accounts[*addr];
+        account.balance = to_uint256(account_json.at("balance"));
+        account.nonce = static_cast<int>(
+            std::min(to_int64(account_json.at("nonce")), int64_t{std::numeric_limits<int>::max()}));
+        account.code = to_bytes(account_json.at("code"));
+        const auto& storage = account_json.at("storage");
+        for (size_t j = 0; j < storage.keys.size(); ++j)
+        {
+            const auto value = to_uint256(storage.values[j]);
+            if (!is_zero(value))
+                account.storage[parse_uint256(storage.keys[j])] = StorageValue{value};
+        }
+    }
+
+    const auto& tx = test.at("transaction");
+    const auto* const sender_json = tx.find("sender");
+    if (sender_json == nullptr)
+        throw std::invalid_argument{"missing \"sender\" (the signature is not recovered)"};
+    const auto sender = to_address(*sender_json);
+    tx_context.tx_origin = sender;
+    if (const auto* gas_price = tx.find("gasPrice"); gas_price != nullptr)
+        tx_context.tx_gas_price = to_uint256(*gas_price);
+    else
+    {
+        // The effective gas price of the EIP-1559 transaction.
+        const auto max_fee = to_uint256(tx.at("maxFeePerGas"));
+        const auto priority_fee = add(to_uint256(tx.at("maxPriorityFeePerGas")),
+                                      base_fee != nullptr ? to_uint256(*base_fee) : uint256be{});
+        tx_context.tx_gas_price = std::min(max_fee, priority_fee);
+    }
+
+    std::vector<bytes32> blob_hashes;
+    if (const auto* hashes = tx.find("blobVersionedHashes"); hashes != nullptr)
+    {
+        for (const auto& hash : to_array(*hashes))
+            blob_hashes.emplace_back(to_uint256(hash));
+    }
+
+    const auto& to_json = tx.at("to");
+    const auto create = json_text(to_json).empty();
+    const auto to = create ? address{} : to_address(to_json);
+
+    std::vector<bytes> data;
+    for (const auto& d : to_array(tx.at("data")))
+        data.emplace_back(to_bytes(d));
+    std::vector<int64_t> gas_limits;
+    for (const auto& g : to_array(tx.at("gasLimit")))
+        gas_limits.emplace_back(to_int64(g));
+    std::vector<uint256be> values;
+    for (const auto& v : to_array(tx.at("value")))
+        values.emplace_back(to_uint256(v));
+
+    // The access lists of the data entries.
+    std::vector<AccessList> access_lists(data.size());
+    if (const auto* lists = tx.find("accessLists"); lists != nullptr)
+    {
+        const auto& lists_array = to_array(*lists);
+        for (size_t d = 0; d < std::min(lists_array.size(), data.size()); ++d)
+        {
+            if (lists_array[d].kind == Json::Kind::null)
+                continue;
+            for (const auto& entry : to_array(lists_array[d]))
+            {
+                auto& [addr, keys] = access_lists[d].emplace_back();
+                addr = to_address(entry.at("address"));
+                for (const auto& key : to_array(entry.at("storageKeys")))
+                    keys.emplace_back(to_uint256(key));
+            }
+        }
+    }
+
+    const auto& post = test.at("post");
+    for (size_t f = 0; f < post.keys.size(); ++f)
+    {
+        const auto& fork = post.keys[f];
+        const auto rev = to_revision(fork);
+        if (!rev)
+            continue;
+
+        for (const auto& expectation : to_array(post.values[f]))
+        {
+            if (expectation.find("expectException") != nullptr)
+                continue;
+
+            const auto& indexes = expectation.at("indexes");
+            const auto d = static_cast<size_t>(to_int64(indexes.at("data")));
+            const auto g = static_cast<size_t>(to_int64(indexes.at("gas")));
+            const auto v = static_cast<size_t>(to_int64(indexes.at("value")));
+            if (d >= data.size() || g >= gas_limits.size() || v >= values.size())
+                throw std::invalid_argument{"invalid indexes of " + name + "/" + fork};
+
+            const auto& access_list = access_lists[d];
+            const auto intrinsic_gas = compute_intrinsic_gas(*rev, data[d], create, access_list);
+            if (gas_limits[g] < intrinsic_gas)
+                continue;
+
+            auto& test_case = out.emplace_back();
+            test_case.name = name + "/" + fork + "/d" + std::to_string(d) + "g" +
+                             std::to_string(g) + "v" + std::to_string(v);
+            test_case.rev = *rev;
+            test_case.data = data[d];
+            test_case.blob_hashes = blob_hashes;
+            test_case.pre = state;
+
+            auto& msg = test_case.msg;
+            msg.kind = create ? EVMC_CREATE : EVMC_CALL;
+            msg.gas = gas_limits[g] - intrinsic_gas;
+            msg.sender = sender;
+            msg.recipient = to;
+            msg.code_address = to;
+            msg.value = values[v];
+
+            auto& pre_state = test_case.pre;
+            if (*rev >= EVMC_BERLIN)
+            {
+                pre_state.accessed_accounts.insert(sender);
+                if (!create)
+                    pre_state.accessed_accounts.insert(to);
+                if (*rev >= EVMC_SHANGHAI)
+                    pre_state.accessed_accounts.insert(tx_context.block_coinbase);
+                for (const auto& [addr, keys] : access_list)
+                {
+                    pre_state.accessed_accounts.insert(addr);
+                    const auto account = pre_state.accounts.find(addr);
+                    for (const auto& key : keys)
+                    {
+                        if (account != pre_state.accounts.end())
+                            account->second.storage[key].access_status = EVMC_ACCESS_WARM;
+                        else
+                            test_case.warm_storage.push_back({addr, key});
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Reads the whole file.
+std::string read_file(const std::filesystem::path& path)
+{
+    std::ifstream file{path, std::ios::binary};
+    std::ostringstream content;
+    content << file.rdbuf();
+    if (!file)
+        throw std::invalid_argument{"cannot read " + path.string()};
+    return std::move(content).str();
+}
+
+/// Returns the gas rate in gas/s.
+int64_t gas_rate(int64_t gas, std::chrono::nanoseconds time) noexcept
+{
+    if (time.count() <= 0)
+        return 0;
+    return std::llround(static_cast<double>(gas) * 1e9 / static_cast<double>(time.count()));
+}
+}  // namespace
+
+std::optional<evmc_revision> to_revision(std::string_view fork) noexcept
+{
+    static constexpr std::pair<std::string_view, evmc_revision> forks[] = {
+        {"Frontier", EVMC_FRONTIER},
+        {"Homestead", EVMC_HOMESTEAD},
+        {"EIP150", EVMC_TANGERINE_WHISTLE},
+        {"TangerineWhistle", EVMC_TANGERINE_WHISTLE},
+        {"EIP158", EVMC_SPURIOUS_DRAGON},
+        {"SpuriousDragon", EVMC_SPURIOUS_DRAGON},
+        {"Byzantium", EVMC_BYZANTIUM},
+        {"Constantinople", EVMC_CONSTANTINOPLE},
+        {"ConstantinopleFix", EVMC_PETERSBURG},
+        {"Petersburg", EVMC_PETERSBURG},
+        {"Istanbul", EVMC_ISTANBUL},
+        {"Berlin", EVMC_BERLIN},
+        {"London", EVMC_LONDON},
+        {"Merge", EVMC_PARIS},
+        {"Paris", EVMC_PARIS},
+        {"Shanghai", EVMC_SHANGHAI},
+        {"Cancun", EVMC_CANCUN},
+        {"Prague", EVMC_PRAGUE},
+        {"Osaka", EVMC_OSAKA},
+    };
+    for (const auto& [name, rev] : forks)
+    {
+        if (name == fork)
+            return rev;
+    }
+    return {};
+}
+
+std::vector<StateTestCase> load_state_tests(std::string_view json)
+{
+    const auto root = JsonParser{json}.parse();
+    if (root.kind != Json::Kind::object)
+        throw std::invalid_argument{"the state test fixture is not a JSON object"};
+
+    std::vector<StateTestCase> tests;
+    for (size_t i = 0; i < root.keys.size(); ++i)
+    {
+        try
+        {
+            load_state_test(root.keys[i], root.values[i], tests);
+        }
+        catch (const std::invalid_argument& e)
+        {
+            throw std::invalid_argument{root.keys[i] + ": " + e.what()};
+        }
+    }
+    return tests;
+}
+
+StateTestResult execute_state_test(VM& vm, const StateTestCase& test, MockedHost* post)
+{
+    using clock = std::chrono::steady_clock;
+
+    StateTestHost host{test, vm};
+    host.tx_context.blob_hashes = test.blob_hashes.data();
+    host.tx_context.blob_hashes_count = test.blob_hashes.size();
+    auto msg = test.msg;
+    msg.input_data = test.data.data();
+    msg.input_size = test.data.size();
+
+    const auto start = clock::now();
+    if (msg.kind != EVMC_CREATE)  // The create increments the nonce of the sender itself.
+        ++host.accounts[msg.sender].nonce;
+    const auto result = host.call(msg);
+    const auto time = clock::now() - start;
+
+    if (post != nullptr)
+    {
+        host.discard_snapshots();
+        *post = host;
+        post->tx_context.blob_hashes = nullptr;
+        post->tx_context.blob_hashes_count = 0;
+    }
+    return {result.status_code, msg.gas - result.gas_left,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(time)};
+}
+
+int run_state_tests(const std::function<VM()>& create_vm,
+                    const std::vector<std::string>& paths,
+                    const StateTestOptions& options,
+                    std::ostream& out)
+{
+    namespace fs = std::filesystem;
+    using clock = std::chrono::steady_clock;
+
+    std::vector<fs::path> files;
+    for (const auto& path : paths)
+    {
+        if (fs::is_directory(path))
+        {
+            std::vector<fs::path> dir_files;
+            for (const auto& entry : fs::recursive_directory_iterator{path})
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".json")
+                    dir_files.emplace_back(entry.path());
+            }
+            std::sort(dir_files.begin(), dir_files.end());
+            files.insert(files.end(), dir_files.begin(), dir_files.end());
+        }
+        else if (fs::is_regular_file(path))
+            files.emplace_back(path);
+        else
+            throw std::invalid_argument{"cannot read " + path};
+    }
+
+    std::vector<StateTestCase> tests;
+    for (const auto& file : files)
+    {
+        const auto json = read_file(file);
+        try
+        {
+            auto file_tests = load_state_tests(json);
+            for (auto& test : file_tests)
+            {
+                if (!options.rev || test.rev == *options.rev)
+                    tests.emplace_back(std::move(test));
+            }
+        }
+        catch (const std::invalid_argument& e)
+        {
+            throw std::invalid_argument{file.string() + ": " + e.what()};
+        }
+    }
+
+    auto num_threads = options.threads > 0 ? static_cast<size_t>(options.threads) :
+                                             size_t{std::thread::hardware_concurrency()};
+    num_threads = std::max(std::min(num_threads, tests.size()), size_t{1});
+    const auto repetitions = std::max(options.repetitions, 1);
+
+    std::vector<VM> vms;
+    vms.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        vms.emplace_back(create_vm());
+        if (!vms.back())
+            throw std::invalid_argument{"cannot create VM instance"};
+    }
+
+    // The tests are taken by the threads one by one, so the long ones do not stall the others.
+    std::vector<StateTestResult> results(tests.size());
+    std::atomic<size_t> next{0};
+    const auto worker = [&](VM& vm) {
+        for (auto i = next++; i < tests.size(); i = next++)
+        {
+            auto& best = results[i];
+            for (int r = 0; r < repetitions; ++r)
+            {
+                const auto result = execute_state_test(vm, tests[i]);
+                if (r == 0 || result.time < best.time)
+                    best = result;
+            }
+        }
+    };
+
+    const auto start = clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (size_t t = 1; t < num_threads; ++t)
+        threads.emplace_back(worker, std::ref(vms[t]));
+    worker(vms[0]);
+    for (auto& thread : threads)
+        thread.join();
+    const auto wall_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+
+    int64_t total_gas = 0;
+    std::chrono::nanoseconds total_time{};
+    for (size_t i = 0; i < tests.size(); ++i)
+    {
+        const auto& r = results[i];
+        out << tests[i].name << ": " << r.status << ", " << r.gas_used << " gas, "
+            << r.time.count() << " ns, " << gas_rate(r.gas_used, r.time) << " gas/s\n";
+        total_gas += r.gas_used;
+        total_time += r.time;
+    }
+
+    out << "Tests:    " << tests.size() << " (threads: " << num_threads << ")\n"
+        << "Gas used: " << total_gas << "\n"
+        << "Time:     " << total_time.count() << " ns (wall: " << wall_time.count() << " ns)\n"
+        << "Gas rate: " << gas_rate(total_gas, total_time)
+        << " gas/s (wall: " << gas_rate(total_gas * repetitions, wall_time) << " gas/s)\n";
+    return 0;
+}
+}  // namespace evmc::tooling
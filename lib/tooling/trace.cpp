@@ -0,0 +1,122 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/tooling.hpp>
+#include <ostream>
+
+namespace evmc::tooling
+{
+namespace
+{
+/// The size of the buffer of the records which is written to the output at once.
+constexpr size_t buffer_capacity = 64 * 1024;
+
+TraceWriter& get_writer(evmc_tracer_context* context) noexcept
+{
+    return *reinterpret_cast<TraceWriter*>(context);
+}
+}  // namespace
+
+TraceWriter::TraceWriter(std::ostream& out) : m_out{out}
+{
+    m_buffer.reserve(buffer_capacity);
+    put(header, sizeof(header));
+
+    m_tracer.context = reinterpret_cast<evmc_tracer_context*>(this);
+    m_tracer.on_call_start = on_call_start;
+    m_tracer.on_step = on_step;
+    m_tracer.on_storage = on_storage;
+    m_tracer.on_call_end = on_call_end;
+}
+
+TraceWriter::~TraceWriter()
+{
+    flush();
+}
+
+void TraceWriter::flush()
+{
+    m_out.write(reinterpret_cast<const char*>(m_buffer.data()),
+                static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+}
+
+template <typename T>
+void TraceWriter::put(T value) noexcept
+{
+    for (size_t i = 0; i < sizeof(T); ++i)
+        m_buffer.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i)));
+}
+
+void TraceWriter::put(const uint8_t* data, size_t size) noexcept
+{
+    m_buffer.insert(m_buffer.end(), data, data + size);
+}
+
+void TraceWriter::begin_record(TraceRecordType type, size_t size)
+{
+    if (m_buffer.size() + size > buffer_capacity)
+        flush();
+    put(static_cast<uint8_t>(type));
+    ++m_num_records;
+}
+
+void TraceWriter::on_call_start(evmc_tracer_context* context, const evmc_message* msg)
+{
+    auto& w = get_writer(context);
+    w.begin_record(TraceRecordType::call_start, call_start_record_size);
+    w.put(static_cast<uint8_t>(msg->kind));
+    w.put(static_cast<uint16_t>(msg->depth));
+    w.put(msg->flags);
+    w.put(msg->gas);
+    w.put(msg->recipient.bytes, sizeof(msg->recipient));
+    w.put(msg->sender.bytes, sizeof(msg->sender));
+    w.put(static_cast<uint32_t>(msg->input_size));
+}
+
+void TraceWriter::on_step(evmc_tracer_context* context,
+                          int32_t depth,
+                          uint32_t pc,
+                          uint8_t opcode,
+                          int64_t gas_left,
+                          uint32_t stack_height,
+                          const evmc_uint256be* /*stack_top*/)
+{
+    auto& w = get_writer(context);
+    w.begin_record(TraceRecordType::step, step_record_size);
+    w.put(opcode);
+    w.put(static_cast<uint16_t>(depth));
+    w.put(pc);
+    w.put(gas_left);
+    w.put(stack_height);
+}
+
+void TraceWriter::on_storage(evmc_tracer_context* context,
+                             int32_t depth,
+                             const evmc_address* address,
+                             const evmc_bytes32* key,
+                             const evmc_bytes32* value)
+{
+    auto& w = get_writer(context);
+    w.begin_record(TraceRecordType::storage, storage_record_size);
+    w.put(uint8_t{0});
+    w.put(static_cast<uint16_t>(depth));
+    w.put(address->bytes, sizeof(*address));
+    w.put(key->bytes, sizeof(*key));
+    w.put(value->bytes, sizeof(*value));
+}
+
+void TraceWriter::on_call_end(evmc_tracer_context* context,
+                              int32_t depth,
+                              const evmc_result* result)
+{
+    auto& w = get_writer(context);
+    w.begin_record(TraceRecordType::call_end, call_end_record_size);
+    w.put(static_cast<int8_t>(result->status_code));
+    w.put(static_cast<uint16_t>(depth));
+    w.put(static_cast<uint32_t>(result->output_size));
+    w.put(result->gas_left);
+    w.put(result->gas_refund);
+}
+}  // namespace evmc::tooling
@@ -0,0 +1,78 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/flat_hash_map.hpp>
+#include <evmc/seeded_hash.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+template <typename Hash>
+void hash_bytes32(benchmark::State& state)
+{
+    evmc::bytes32 key{0xc0ffee};
+    const Hash hash{};
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(hash(key));
+        ++key.bytes[31];
+    }
+}
+
+template <typename Hash>
+void hash_address(benchmark::State& state)
+{
+    evmc::address addr{0xc0ffee};
+    const Hash hash{};
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(hash(addr));
+        ++addr.bytes[19];
+    }
+}
+
+/// Looks up the storage map of the given size filled with random keys, in the random order.
+///
+/// The keys are random as the Keccak-256 based storage keys of the mappings and arrays.
+/// The FNV-1a hashes of the sequential keys map them to the slots at a constant stride,
+/// which the hardware prefetcher follows, so the sequential keys favor the std::hash.
+template <typename Hash>
+void flat_hash_map_find(benchmark::State& state)
+{
+    const auto size = static_cast<uint64_t>(state.range(0));
+    evmc::flat_hash_map<evmc::bytes32, evmc::bytes32, Hash> map;
+    std::vector<evmc::bytes32> keys;
+    std::mt19937_64 rng;
+    for (uint64_t i = 0; i < size; ++i)
+    {
+        evmc::bytes32 key;
+        for (size_t j = 0; j < sizeof(key); j += sizeof(uint64_t))
+        {
+            const auto word = rng();
+            std::memcpy(&key.bytes[j], &word, sizeof(word));
+        }
+        map[key] = evmc::bytes32{i};
+        keys.emplace_back(key);
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(map.find(keys[i]));
+        i = (i + 1) % keys.size();
+    }
+}
+
+BENCHMARK_TEMPLATE(hash_bytes32, std::hash<evmc::bytes32>);
+BENCHMARK_TEMPLATE(hash_bytes32, evmc::seeded_hash<evmc::bytes32>);
+BENCHMARK_TEMPLATE(hash_address, std::hash<evmc::address>);
+BENCHMARK_TEMPLATE(hash_address, evmc::seeded_hash<evmc::address>);
+BENCHMARK_TEMPLATE(flat_hash_map_find, std::hash<evmc::bytes32>)->Arg(100)->Arg(100000);
+BENCHMARK_TEMPLATE(flat_hash_map_find, evmc::seeded_hash<evmc::bytes32>)->Arg(100)->Arg(100000);
+}  // namespace
@@ -0,0 +1,96 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/hex.hpp>
+#include <benchmark/benchmark.h>
+
+namespace
+{
+evmc::bytes make_data(size_t size)
+{
+    evmc::bytes data(size, 0);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = static_cast<uint8_t>(i * 37);
+    return data;
+}
+
+void hex(benchmark::State& state)
+{
+    const auto data = make_data(static_cast<size_t>(state.range(0)));
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(evmc::hex(data));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+
+void hex_to(benchmark::State& state)
+{
+    const auto data = make_data(static_cast<size_t>(state.range(0)));
+    std::string out(data.size() * 2, '\0');
+    for ([[maybe_unused]] auto _ : state)
+    {
+        evmc::hex_to(data, out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+
+void hex_scalar(benchmark::State& state)
+{
+    const auto data = make_data(static_cast<size_t>(state.range(0)));
+    std::string out(data.size() * 2, '\0');
+    for ([[maybe_unused]] auto _ : state)
+    {
+        evmc::internal::hex_encode_scalar(data.data(), data.size(), out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+
+void from_hex(benchmark::State& state)
+{
+    const auto hex = evmc::hex(make_data(static_cast<size_t>(state.range(0))));
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(evmc::from_hex(hex));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(hex.size() / 2));
+}
+
+void from_hex_into(benchmark::State& state)
+{
+    const auto hex = evmc::hex(make_data(static_cast<size_t>(state.range(0))));
+    evmc::bytes out(hex.size() / 2, 0);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(evmc::from_hex_into(hex, out.data(), out.size()));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(out.size()));
+}
+
+void from_hex_scalar(benchmark::State& state)
+{
+    const auto hex = evmc::hex(make_data(static_cast<size_t>(state.range(0))));
+    evmc::bytes out(hex.size() / 2, 0);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(
+            evmc::internal::hex_decode_scalar(hex.data(), out.size(), out.data()));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(out.size()));
+}
+
+/// The legacy decoding through the iterator-based from_hex().
+void from_hex_iterator(benchmark::State& state)
+{
+    const auto hex = evmc::hex(make_data(static_cast<size_t>(state.range(0))));
+    evmc::bytes out(hex.size() / 2, 0);
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(evmc::from_hex(hex.begin(), hex.end(), out.data()));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(out.size()));
+}
+
+// The sizes: a word, a typical calldata or log payload and the maximum code size.
+#define HEX_SIZES Arg(32)->Arg(1024)->Arg(24 * 1024)
+BENCHMARK(hex)->HEX_SIZES;
+BENCHMARK(hex_to)->HEX_SIZES;
+BENCHMARK(hex_scalar)->HEX_SIZES;
+BENCHMARK(from_hex)->HEX_SIZES;
+BENCHMARK(from_hex_into)->HEX_SIZES;
+BENCHMARK(from_hex_scalar)->HEX_SIZES;
+BENCHMARK(from_hex_iterator)->HEX_SIZES;
+}  // namespace
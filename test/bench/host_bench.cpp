@@ -0,0 +1,379 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/concurrent_mocked_host.hpp>
+#include <evmc/evmc.hpp>
+#include <evmc/instrumented_host.hpp>
+#include <evmc/mocked_host.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+
+using namespace evmc::literals;
+
+namespace
+{
+/// The Host returning constants, so only the cost of the calls is measured.
+/// Dispatched statically through the evmc::HostCRTP.
+class StaticHost : public evmc::HostCRTP<StaticHost>
+{
+public:
+    bool account_exists(const evmc::address& /*addr*/) const noexcept { return true; }
+
+    evmc::bytes32 get_storage(const evmc::address& /*addr*/,
+                              const evmc::bytes32& key) const noexcept
+    {
+        return key;
+    }
+
+    evmc_storage_status set_storage(const evmc::address& /*addr*/,
+                                    const evmc::bytes32& /*key*/,
+                                    const evmc::bytes32& /*value*/) noexcept
+    {
+        return EVMC_STORAGE_ASSIGNED;
+    }
+
+    evmc::uint256be get_balance(const evmc::address& /*addr*/) const noexcept
+    {
+        return evmc::uint256be{1};
+    }
+
+    size_t get_code_size(const evmc::address& /*addr*/) const noexcept { return 1; }
+
+    evmc::bytes32 get_code_hash(const evmc::address& /*addr*/) const noexcept { return {}; }
+
+    size_t copy_code(const evmc::address& /*addr*/,
+                     size_t /*code_offset*/,
+                     uint8_t* /*buffer_data*/,
+                     size_t /*buffer_size*/) const noexcept
+    {
+        return 0;
+    }
+
+    bool selfdestruct(const evmc::address& /*addr*/,
+                      const evmc::address& /*beneficiary*/) noexcept
+    {
+        return false;
+    }
+
+    evmc::Result call(const evmc_message& /*msg*/) noexcept { return evmc::Result{}; }
+
+    evmc_tx_context get_tx_context() const noexcept { return {}; }
+
+    evmc::bytes32 get_block_hash(int64_t /*block_number*/) const noexcept { return {}; }
+
+    void emit_log(const evmc::address& /*addr*/,
+                  const uint8_t* /*data*/,
+                  size_t /*data_size*/,
+                  const evmc::bytes32 /*topics*/[],
+                  size_t /*num_topics*/) noexcept
+    {}
+
+    evmc_access_status access_account(const evmc::address& /*addr*/) noexcept
+    {
+        return EVMC_ACCESS_WARM;
+    }
+
+    evmc_access_status access_storage(const evmc::address& /*addr*/,
+                                      const evmc::bytes32& /*key*/) noexcept
+    {
+        return EVMC_ACCESS_WARM;
+    }
+
+    evmc::bytes32 get_transient_storage(const evmc::address& /*addr*/,
+                                        const evmc::bytes32& /*key*/) const noexcept
+    {
+        return {};
+    }
+
+    void set_transient_storage(const evmc::address& /*addr*/,
+                               const evmc::bytes32& /*key*/,
+                               const evmc::bytes32& /*value*/) noexcept
+    {}
+};
+
+/// The same Host dispatched through the virtual evmc::Host.
+class VirtualHost : public evmc::Host
+{
+    StaticHost m_impl;
+
+public:
+    bool account_exists(const evmc::address& a) const noexcept final
+    {
+        return m_impl.account_exists(a);
+    }
+
+    evmc::bytes32 get_storage(const evmc::address& a, const evmc::bytes32& k) const noexcept final
+    {
+        return m_impl.get_storage(a, k);
+    }
+
+    evmc_storage_status set_storage(const evmc::address& a,
+                                    const evmc::bytes32& k,
+                                    const evmc::bytes32& v) noexcept final
+    {
+        return m_impl.set_storage(a, k, v);
+    }
+
+    evmc::uint256be get_balance(const evmc::address& a) const noexcept final
+    {
+        return m_impl.get_balance(a);
+    }
+
+    size_t get_code_size(const evmc::address& a) const noexcept final
+    {
+        return m_impl.get_code_size(a);
+    }
+
+    evmc::bytes32 get_code_hash(const evmc::address& a) const noexcept final
+    {
+        return m_impl.get_code_hash(a);
+    }
+
+    size_t copy_code(const evmc::address& a,
+                     size_t offset,
+                     uint8_t* data,
+                     size_t size) const noexcept final
+    {
+        return m_impl.copy_code(a, offset, data, size);
+    }
+
+    bool selfdestruct(const evmc::address& a, const evmc::address& b) noexcept final
+    {
+        return m_impl.selfdestruct(a, b);
+    }
+
+    evmc::Result call(const evmc_message& msg) noexcept final { return m_impl.call(msg); }
+
+    evmc_tx_context get_tx_context() const noexcept final { return m_impl.get_tx_context(); }
+
+    evmc::bytes32 get_block_hash(int64_t number) const noexcept final
+    {
+        return m_impl.get_block_hash(number);
+    }
+
+    void emit_log(const evmc::address& a,
+                  const uint8_t* data,
+                  size_t size,
+                  const evmc::bytes32 topics[],
+                  size_t num_topics) noexcept final
+    {
+        m_impl.emit_log(a, data, size, topics, num_topics);
+    }
+
+    evmc_access_status access_account(const evmc::address& a) noexcept final
+    {
+        return m_impl.access_account(a);
+    }
+
+    evmc_access_status access_storage(const evmc::address& a, const evmc::bytes32& k) noexcept final
+    {
+        return m_impl.access_storage(a, k);
+    }
+
+    evmc::bytes32 get_transient_storage(const evmc::address& a,
+                                        const evmc::bytes32& k) const noexcept final
+    {
+        return m_impl.get_transient_storage(a, k);
+    }
+
+    void set_transient_storage(const evmc::address& a,
+                               const evmc::bytes32& k,
+                               const evmc::bytes32& v) noexcept final
+    {
+        m_impl.set_transient_storage(a, k, v);
+    }
+};
+
+constexpr auto addr = 0xa0_address;
+
+/// The Host method calls through the C interface as from a VM using evmc::HostContext.
+template <typename HostT>
+void host_context_get_storage(benchmark::State& state)
+{
+    HostT host;
+    evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+    auto key = 0x01_bytes32;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        key = ctx.get_storage(addr, key);
+        benchmark::DoNotOptimize(key);
+    }
+}
+
+template <typename HostT>
+void host_context_set_storage(benchmark::State& state)
+{
+    HostT host;
+    evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ctx.set_storage(addr, 0x01_bytes32, 0x02_bytes32));
+}
+
+template <typename HostT>
+void host_context_account_exists(benchmark::State& state)
+{
+    HostT host;
+    evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ctx.account_exists(addr));
+}
+
+template <typename HostT>
+void host_context_get_balance(benchmark::State& state)
+{
+    HostT host;
+    evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ctx.get_balance(addr));
+}
+
+template <typename HostT>
+void host_context_get_code_size(benchmark::State& state)
+{
+    HostT host;
+    evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ctx.get_code_size(addr));
+}
+
+template <typename HostT>
+void host_context_access_storage(benchmark::State& state)
+{
+    HostT host;
+    evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ctx.access_storage(addr, 0x01_bytes32));
+}
+
+template <typename HostT>
+void host_context_get_tx_context(benchmark::State& state)
+{
+    HostT host;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        // The new HostContext, because the tx context is fetched once per HostContext.
+        evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+        benchmark::DoNotOptimize(ctx.get_tx_context());
+    }
+}
+
+template <typename HostT>
+void host_context_call(benchmark::State& state)
+{
+    HostT host;
+    evmc::HostContext ctx{HostT::get_interface(), host.to_context()};
+    evmc_message msg{};
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(ctx.call(msg));
+}
+
+/// The get_storage() of the MockedHost through the InstrumentedHost measuring the latency
+/// of one of every given number of calls.
+void instrumented_host_get_storage(benchmark::State& state)
+{
+    evmc::MockedHost mocked;
+    evmc::InstrumentedHost host{mocked, static_cast<uint64_t>(state.range(0))};
+    evmc::HostContext ctx{evmc::InstrumentedHost::get_interface(), host.to_context()};
+    auto key = 0x01_bytes32;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        key = ctx.get_storage(addr, key);
+        benchmark::DoNotOptimize(key);
+    }
+}
+
+/// Fills the storage of the MockedHost account with the given number of entries.
+evmc::MockedHost make_mocked_host(size_t size)
+{
+    evmc::MockedHost host;
+    auto& storage = host.accounts[addr].storage;
+    storage.reserve(size);
+    for (uint64_t i = 0; i < size; ++i)
+        storage[evmc::bytes32{i}] = evmc::bytes32{i};
+    return host;
+}
+
+void mocked_host_get_storage(benchmark::State& state)
+{
+    const auto size = static_cast<uint64_t>(state.range(0));
+    const auto host = make_mocked_host(size);
+    uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(host.get_storage(addr, evmc::bytes32{i}));
+        i = (i + 7) % size;
+    }
+}
+
+void mocked_host_set_storage(benchmark::State& state)
+{
+    const auto size = static_cast<uint64_t>(state.range(0));
+    auto host = make_mocked_host(size);
+    uint64_t i = 0;
+    uint64_t v = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(host.set_storage(addr, evmc::bytes32{i}, evmc::bytes32{++v}));
+        i = (i + 7) % size;
+    }
+}
+
+/// Emits the ERC-20 Transfer-like LOG3 events, cleared after every batch of the given size.
+void mocked_host_emit_log(benchmark::State& state)
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    evmc::MockedHost host;
+    const evmc::bytes32 topics[3] = {0xddf252ad_bytes32, 0x01_bytes32, 0x02_bytes32};
+    const evmc::bytes32 amount{1000};
+    for ([[maybe_unused]] auto _ : state)
+    {
+        host.emit_log(addr, amount.bytes, sizeof(amount), topics, std::size(topics));
+        if (host.recorded_logs.size() == batch_size)
+            host.clear_records();
+    }
+}
+
+/// Reads the storage of the account of the thread from the host shared by all the threads.
+void concurrent_mocked_host_get_storage(benchmark::State& state)
+{
+    constexpr uint64_t size = 1000;
+    static const auto host = [] {
+        auto h = std::make_unique<evmc::ConcurrentMockedHost>();
+        for (uint64_t a = 0; a < 64; ++a)
+        {
+            h->with_account(evmc::address{a}, [](auto& acc) {
+                for (uint64_t i = 0; i < size; ++i)
+                    acc.storage[evmc::bytes32{i}] = evmc::bytes32{i};
+            });
+        }
+        return h;
+    }();
+    const evmc::address thread_addr{static_cast<uint64_t>(state.thread_index())};
+    uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(host->get_storage(thread_addr, evmc::bytes32{i}));
+        i = (i + 7) % size;
+    }
+}
+
+#define HOST_BENCHMARK(NAME)                  \
+    BENCHMARK_TEMPLATE(NAME, VirtualHost);    \
+    BENCHMARK_TEMPLATE(NAME, StaticHost);     \
+    BENCHMARK_TEMPLATE(NAME, evmc::MockedHost)
+HOST_BENCHMARK(host_context_get_storage);
+HOST_BENCHMARK(host_context_set_storage);
+HOST_BENCHMARK(host_context_account_exists);
+HOST_BENCHMARK(host_context_get_balance);
+HOST_BENCHMARK(host_context_get_code_size);
+HOST_BENCHMARK(host_context_access_storage);
+HOST_BENCHMARK(host_context_get_tx_context);
+HOST_BENCHMARK(host_context_call);
+
+BENCHMARK(instrumented_host_get_storage)->Arg(1)->Arg(64);
+BENCHMARK(mocked_host_get_storage)->Arg(10)->Arg(1000)->Arg(100000);
+BENCHMARK(mocked_host_set_storage)->Arg(10)->Arg(1000)->Arg(100000);
+BENCHMARK(mocked_host_emit_log)->Arg(1000);
+BENCHMARK(concurrent_mocked_host_get_storage)->ThreadRange(1, 8);
+}  // namespace
@@ -0,0 +1,159 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include "examples/example_vm/example_vm.h"
+#include <evmc/evmc.hpp>
+#include <evmc/mocked_host.hpp>
+#include <benchmark/benchmark.h>
+
+namespace
+{
+/// The VM implementation returning immediately, so only the cost of the call is measured.
+evmc_result stop(evmc_vm* /*vm*/,
+                 const evmc_host_interface* /*host*/,
+                 evmc_host_context* /*context*/,
+                 evmc_revision /*rev*/,
+                 const evmc_message* msg,
+                 const uint8_t* /*code*/,
+                 size_t /*code_size*/) noexcept
+{
+    evmc_result result{};
+    result.status_code = EVMC_SUCCESS;
+    result.gas_left = msg->gas;
+    return result;
+}
+
+void destroy(evmc_vm* /*vm*/) noexcept {}
+
+evmc_vm stop_vm{EVMC_ABI_VERSION, "stop", "0", destroy, stop, nullptr, nullptr, nullptr, nullptr};
+
+const auto msg = [] {
+    evmc_message m{};
+    m.gas = 1000000;
+    return m;
+}();
+
+/// The baseline: the direct call of the VM implementation which can be inlined.
+void execute_direct(benchmark::State& state)
+{
+    evmc::MockedHost host;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = stop(&stop_vm, &evmc::Host::get_interface(), host.to_context(),
+                            EVMC_CANCUN, &msg, nullptr, 0);
+        benchmark::DoNotOptimize(r.gas_left);
+    }
+}
+
+/// The call through the evmc_vm::execute function pointer.
+void execute_c_abi(benchmark::State& state)
+{
+    evmc::MockedHost host;
+    auto* const vm = &stop_vm;
+    benchmark::DoNotOptimize(vm);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = vm->execute(vm, &evmc::Host::get_interface(), host.to_context(),
+                                   EVMC_CANCUN, &msg, nullptr, 0);
+        benchmark::DoNotOptimize(r.gas_left);
+    }
+}
+
+/// The call through the evmc::VM wrapper, including the evmc::Result handling.
+void execute_cpp(benchmark::State& state)
+{
+    evmc::MockedHost host;
+    evmc::VM vm{&stop_vm};
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = vm.execute(host, EVMC_CANCUN, msg, nullptr, 0);
+        benchmark::DoNotOptimize(r.gas_left);
+    }
+}
+
+/// The execution of the code by the example VM. The code is STOP or returns 32 bytes.
+void execute_example_vm(benchmark::State& state)
+{
+    static constexpr uint8_t stop_code[] = {0x00};
+    static constexpr uint8_t return_code[] = {0x60, 0x20, 0x60, 0x00, 0xf3};
+    const auto code = state.range(0) == 0 ? evmc::bytes_view{stop_code, sizeof(stop_code)} :
+                                            evmc::bytes_view{return_code, sizeof(return_code)};
+
+    evmc::MockedHost host;
+    evmc::VM vm{evmc_create_example_vm()};
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = vm.execute(host, EVMC_CANCUN, msg, code.data(), code.size());
+        benchmark::DoNotOptimize(r.output_data);
+    }
+}
+
+/// The execution of the loop of 1000 iterations by the example VM (6 instructions each)
+/// with the switch (0) or the threaded (1) dispatch, analyzing the code each time (0)
+/// or reusing the analysis cached in the code analysis slot (1).
+void execute_example_vm_loop(benchmark::State& state)
+{
+    // PUSH2 1000 JUMPDEST PUSH4 ffffffff ADD DUP1 PUSH1 3 JUMPI STOP
+    static constexpr uint8_t loop_code[] = {0x61, 0x03, 0xe8, 0x5b, 0x63, 0xff, 0xff, 0xff,
+                                            0xff, 0x01, 0x80, 0x60, 0x03, 0x57, 0x00};
+    static constexpr int64_t num_instructions = 1 + 1000 * 6 + 1;
+
+    evmc::MockedHost host;
+    evmc::VM vm{evmc_create_example_vm()};
+    if (vm.set_option("dispatch", state.range(0) == 0 ? "switch" : "threaded") !=
+        EVMC_SET_OPTION_SUCCESS)
+    {
+        state.SkipWithError("dispatch not supported");
+        return;
+    }
+
+    evmc_code_analysis_slot slot{};
+    auto loop_msg = msg;
+    loop_msg.gas = num_instructions;
+    loop_msg.code_analysis = state.range(1) != 0 ? &slot : nullptr;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = vm.execute(host, EVMC_CANCUN, loop_msg, loop_code, sizeof(loop_code));
+        benchmark::DoNotOptimize(r.gas_left);
+    }
+    state.SetItemsProcessed(state.iterations() * num_instructions);
+
+    if (slot.analysis != nullptr)
+        vm.get_raw_pointer()->release_code_analysis(vm.get_raw_pointer(), slot.analysis);
+}
+
+/// The construction and the release of evmc::Result with the output of the given size.
+/// The output of up to EVMC_INLINE_OUTPUT_MAX_SIZE bytes is stored inline, the longer in malloc().
+void result_output(benchmark::State& state)
+{
+    const evmc::bytes output(static_cast<size_t>(state.range(0)), 0xfe);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        evmc::Result r{EVMC_SUCCESS, 100, 0, output.data(), output.size()};
+        benchmark::DoNotOptimize(r.output_data);
+    }
+}
+
+/// The construction and the release of evmc::Result with the output in the Host arena.
+void result_host_arena(benchmark::State& state)
+{
+    const evmc::bytes output(static_cast<size_t>(state.range(0)), 0xfe);
+    evmc::MockedHost host;
+    host.output_arena_enabled = true;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        evmc::Result r{host, EVMC_SUCCESS, 100, 0, output.data(), output.size()};
+        benchmark::DoNotOptimize(r.output_data);
+        host.output_arena.reset();
+    }
+}
+
+BENCHMARK(execute_direct);
+BENCHMARK(execute_c_abi);
+BENCHMARK(execute_cpp);
+BENCHMARK(execute_example_vm)->Arg(0)->Arg(32);
+BENCHMARK(execute_example_vm_loop)->ArgsProduct({{0, 1}, {0, 1}});
+BENCHMARK(result_output)->Arg(0)->Arg(32)->Arg(33)->Arg(1024);
+BENCHMARK(result_host_arena)->Arg(0)->Arg(32)->Arg(1024);
+}  // namespace
@@ -4,6 +4,7 @@
 
 /* Test compilation of C public headers. */
 
+#include <evmc/bytecode_analysis.h>
 #include <evmc/evmc.h>
 #include <evmc/helpers.h>
 #include <evmc/instructions.h>
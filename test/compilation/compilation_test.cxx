@@ -4,23 +4,39 @@
 
 // Test compilation of C and C++ public headers.
 
+#include <evmc/bytecode_analysis.h>
+#include <evmc/caching_host.hpp>
+#include <evmc/concurrent_mocked_host.hpp>
 #include <evmc/evmc.h>
 #include <evmc/evmc.hpp>
 #include <evmc/filter_iterator.hpp>
+#include <evmc/flat_hash_map.hpp>
 #include <evmc/helpers.h>
 #include <evmc/hex.hpp>
+#include <evmc/instrumented_host.hpp>
 #include <evmc/instructions.h>
+#include <evmc/instructions.hpp>
 #include <evmc/loader.h>
 #include <evmc/mocked_host.hpp>
+#include <evmc/recording_host.hpp>
+#include <evmc/seeded_hash.hpp>
 #include <evmc/utils.h>
 
 // Include again to check if headers have proper include guards.
-#include <evmc/evmc.h>               //NOLINT(readability-duplicate-include)
-#include <evmc/evmc.hpp>             //NOLINT(readability-duplicate-include)
-#include <evmc/filter_iterator.hpp>  //NOLINT(readability-duplicate-include)
-#include <evmc/helpers.h>            //NOLINT(readability-duplicate-include)
-#include <evmc/hex.hpp>              //NOLINT(readability-duplicate-include)
-#include <evmc/instructions.h>       //NOLINT(readability-duplicate-include)
-#include <evmc/loader.h>             //NOLINT(readability-duplicate-include)
-#include <evmc/mocked_host.hpp>      //NOLINT(readability-duplicate-include)
-#include <evmc/utils.h>              //NOLINT(readability-duplicate-include)
+#include <evmc/bytecode_analysis.h>         //NOLINT(readability-duplicate-include)
+#include <evmc/caching_host.hpp>            //NOLINT(readability-duplicate-include)
+#include <evmc/concurrent_mocked_host.hpp>  //NOLINT(readability-duplicate-include)
+#include <evmc/evmc.h>                      //NOLINT(readability-duplicate-include)
+#include <evmc/evmc.hpp>                    //NOLINT(readability-duplicate-include)
+#include <evmc/filter_iterator.hpp>         //NOLINT(readability-duplicate-include)
+#include <evmc/flat_hash_map.hpp>           //NOLINT(readability-duplicate-include)
+#include <evmc/helpers.h>                   //NOLINT(readability-duplicate-include)
+#include <evmc/hex.hpp>                     //NOLINT(readability-duplicate-include)
+#include <evmc/instrumented_host.hpp>       //NOLINT(readability-duplicate-include)
+#include <evmc/instructions.h>              //NOLINT(readability-duplicate-include)
+#include <evmc/instructions.hpp>            //NOLINT(readability-duplicate-include)
+#include <evmc/loader.h>                    //NOLINT(readability-duplicate-include)
+#include <evmc/mocked_host.hpp>             //NOLINT(readability-duplicate-include)
+#include <evmc/recording_host.hpp>          //NOLINT(readability-duplicate-include)
+#include <evmc/seeded_hash.hpp>             //NOLINT(readability-duplicate-include)
+#include <evmc/utils.h>                     //NOLINT(readability-duplicate-include)
@@ -0,0 +1,161 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/bytecode_analysis.h>
+#include <evmc/hex.hpp>
+#include <evmc/instructions.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+using analysis_ptr =
+    std::unique_ptr<evmc_bytecode_analysis, decltype(&evmc_release_bytecode_analysis)>;
+
+analysis_ptr analyze(evmc_revision rev, const evmc::bytes& code)
+{
+    return {evmc_analyze_bytecode(rev, code.data(), code.size()), evmc_release_bytecode_analysis};
+}
+}  // namespace
+
+TEST(bytecode_analysis, empty)
+{
+    const auto a = analyze(EVMC_CANCUN, {});
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a->num_blocks, 0u);
+    EXPECT_EQ(a->code_size, 0u);
+    EXPECT_FALSE(evmc_is_jumpdest(a.get(), 0));
+}
+
+TEST(bytecode_analysis, invalid_revision)
+{
+    const auto invalid_rev = static_cast<evmc_revision>(EVMC_MAX_REVISION + 1);
+    EXPECT_EQ(evmc_analyze_bytecode(invalid_rev, nullptr, 0), nullptr);
+    evmc_release_bytecode_analysis(nullptr);
+}
+
+TEST(bytecode_analysis, blocks)
+{
+    // 0: PUSH1 1, PUSH1 2, ADD, PUSH1 10, JUMPI
+    // 8: POP, STOP
+    // 10: JUMPDEST, PUSH2 0x5b5b, POP, PUSH1 0, DUP1, DUP2, RETURN
+    const auto code = *evmc::from_hex("6001600201600a5750005b615b5b5060008081f3");
+    const auto a = analyze(EVMC_CANCUN, code);
+    ASSERT_TRUE(a);
+    ASSERT_EQ(a->num_blocks, 3u);
+
+    const auto& b0 = a->blocks[0];
+    EXPECT_EQ(b0.begin, 0u);
+    EXPECT_EQ(b0.end, 8u);
+    EXPECT_EQ(b0.gas_cost, 3 + 3 + 3 + 3 + 10);
+    EXPECT_EQ(b0.stack_height_required, 0);
+    EXPECT_EQ(b0.stack_height_max_growth, 2);
+    EXPECT_EQ(b0.stack_height_change, 0);
+
+    const auto& b1 = a->blocks[1];
+    EXPECT_EQ(b1.begin, 8u);
+    EXPECT_EQ(b1.end, 10u);
+    EXPECT_EQ(b1.gas_cost, 2);
+    EXPECT_EQ(b1.stack_height_required, 1);
+    EXPECT_EQ(b1.stack_height_max_growth, 0);
+    EXPECT_EQ(b1.stack_height_change, -1);
+
+    const auto& b2 = a->blocks[2];
+    EXPECT_EQ(b2.begin, 10u);
+    EXPECT_EQ(b2.end, code.size());
+    EXPECT_EQ(b2.gas_cost, 1 + 3 + 2 + 3 + 3 + 3 + 0);
+    EXPECT_EQ(b2.stack_height_required, 0);
+    EXPECT_EQ(b2.stack_height_max_growth, 3);
+    EXPECT_EQ(b2.stack_height_change, 1);
+
+    for (size_t i = 0; i < code.size() + 10; ++i)
+        EXPECT_EQ(evmc_is_jumpdest(a.get(), i), i == 10) << i;
+}
+
+TEST(bytecode_analysis, undefined_instruction_and_revision)
+{
+    // PUSH0 is undefined before Shanghai and terminates the block.
+    const auto code = *evmc::from_hex("5f5f01");
+    const auto london = analyze(EVMC_LONDON, code);
+    ASSERT_TRUE(london);
+    EXPECT_EQ(london->num_blocks, 3u);
+
+    const auto shanghai = analyze(EVMC_SHANGHAI, code);
+    ASSERT_TRUE(shanghai);
+    ASSERT_EQ(shanghai->num_blocks, 1u);
+    EXPECT_EQ(shanghai->blocks[0].gas_cost, 2 + 2 + 3);
+    EXPECT_EQ(shanghai->blocks[0].stack_height_change, 1);
+}
+
+TEST(bytecode_analysis, truncated_push_and_big_code)
+{
+    // The truncated push data is not the JUMPDEST.
+    evmc::bytes code(200, OP_JUMPDEST);
+    code[190] = OP_PUSH32;
+    const auto a = analyze(EVMC_CANCUN, code);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a->num_blocks, 190u);
+    const auto& last = a->blocks[a->num_blocks - 1];
+    EXPECT_EQ(last.begin, 189u);
+    EXPECT_EQ(last.end, 200u);
+    EXPECT_TRUE(evmc_is_jumpdest(a.get(), 64));
+    EXPECT_TRUE(evmc_is_jumpdest(a.get(), 189));
+    EXPECT_FALSE(evmc_is_jumpdest(a.get(), 190));
+    EXPECT_FALSE(evmc_is_jumpdest(a.get(), 191));
+    EXPECT_FALSE(evmc_is_jumpdest(a.get(), 199));
+}
+
+TEST(bytecode_analysis, jumpdests_vs_naive)
+{
+    std::mt19937_64 rng{1};  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+    for (const size_t code_size : {0u, 1u, 31u, 63u, 64u, 65u, 127u, 128u, 1000u, 24576u})
+    {
+        // Random code with many JUMPDESTs and PUSHes, including long PUSH32 sequences.
+        evmc::bytes code(code_size, 0);
+        for (auto& op : code)
+        {
+            const auto r = rng() % 4;
+            op = r == 0 ? uint8_t{OP_JUMPDEST} :
+                 r == 1 ? static_cast<uint8_t>(OP_PUSH1 + rng() % 32) :
+                 r == 2 ? uint8_t{OP_PUSH32} :
+                          static_cast<uint8_t>(rng());
+        }
+
+        const auto num_words = (code_size + 63) / 64;
+        std::vector<uint64_t> jumpdest_map(num_words, ~uint64_t{0});
+        std::vector<uint64_t> push_data_map(num_words, ~uint64_t{0});
+        evmc_analyze_jumpdests(code.data(), code.size(), jumpdest_map.data(),
+                               push_data_map.data());
+
+        std::vector<uint64_t> expected_jumpdest_map(num_words);
+        std::vector<uint64_t> expected_push_data_map(num_words);
+        for (size_t i = 0; i < code_size; ++i)
+        {
+            const auto op = code[i];
+            if (op == OP_JUMPDEST)
+                expected_jumpdest_map[i / 64] |= uint64_t{1} << (i % 64);
+            else if (op >= OP_PUSH1 && op <= OP_PUSH32)
+            {
+                const auto push_size = static_cast<size_t>(op - OP_PUSH1 + 1);
+                for (size_t j = i + 1; j <= i + push_size && j < code_size; ++j)
+                    expected_push_data_map[j / 64] |= uint64_t{1} << (j % 64);
+                i += push_size;
+            }
+        }
+
+        EXPECT_EQ(jumpdest_map, expected_jumpdest_map) << code_size;
+        EXPECT_EQ(push_data_map, expected_push_data_map) << code_size;
+    }
+}
+
+TEST(bytecode_analysis, jumpdests_without_push_data_map)
+{
+    // PUSH2 0x5b5b, JUMPDEST, PUSH1 (truncated)
+    const auto code = *evmc::from_hex("615b5b5b60");
+    uint64_t jumpdest_map = ~uint64_t{0};
+    evmc_analyze_jumpdests(code.data(), code.size(), &jumpdest_map, nullptr);
+    EXPECT_EQ(jumpdest_map, uint64_t{0b1000});
+}
@@ -0,0 +1,193 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/caching_host.hpp>
+#include <evmc/mocked_host.hpp>
+#include <gtest/gtest.h>
+
+using namespace evmc::literals;
+
+namespace
+{
+constexpr auto addr1 = 0x01_address;
+constexpr auto addr2 = 0x02_address;
+}  // namespace
+
+TEST(lru_cache, eviction)
+{
+    evmc::LruCache<int, int> cache{2};
+    EXPECT_EQ(cache.capacity(), 2u);
+    EXPECT_EQ(cache.get(1), nullptr);
+
+    cache.put(1, 10);
+    cache.put(2, 20);
+    ASSERT_NE(cache.get(1), nullptr);  // 1 becomes the most recently used.
+    EXPECT_EQ(*cache.get(1), 10);
+
+    cache.put(3, 30);  // Evicts 2.
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.get(2), nullptr);
+    EXPECT_EQ(*cache.get(1), 10);
+    EXPECT_EQ(*cache.get(3), 30);
+
+    cache.put(3, 31);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(*cache.get(3), 31);
+
+    cache.erase(1);
+    EXPECT_EQ(cache.get(1), nullptr);
+    EXPECT_EQ(cache.size(), 1u);
+    cache.erase(1);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.get(3), nullptr);
+}
+
+TEST(caching_host, account_queries)
+{
+    evmc::MockedHost mocked;
+    mocked.accounts[addr1].set_balance(7);
+    mocked.accounts[addr1].code = {0x00};
+    mocked.accounts[addr1].codehash = 0xc0de_bytes32;
+    evmc::CachingHost host{mocked};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(host.account_exists(addr1));
+        EXPECT_FALSE(host.account_exists(addr2));
+        EXPECT_EQ(host.get_balance(addr1), 0x07_bytes32);
+        EXPECT_EQ(host.get_code_size(addr1), 1u);
+        EXPECT_EQ(host.get_code_hash(addr1), 0xc0de_bytes32);
+    }
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 5u);
+    EXPECT_EQ(host.num_cached_accounts(), 2u);
+
+    mocked.accounts[addr1].set_balance(8);
+    EXPECT_EQ(host.get_balance(addr1), 0x07_bytes32);
+    host.invalidate(addr1);
+    EXPECT_EQ(host.get_balance(addr1), 0x08_bytes32);
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 6u);
+}
+
+TEST(caching_host, storage_write_through)
+{
+    evmc::MockedHost mocked;
+    mocked.accounts[addr1].storage[0x01_bytes32] = 0x0a_bytes32;
+    evmc::CachingHost host{mocked};
+
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x0a_bytes32);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x0a_bytes32);
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 1u);
+
+    EXPECT_EQ(host.set_storage(addr1, 0x01_bytes32, 0x0b_bytes32), EVMC_STORAGE_MODIFIED);
+    EXPECT_EQ(mocked.accounts[addr1].storage[0x01_bytes32].current, 0x0b_bytes32);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x0b_bytes32);
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 2u);
+
+    host.invalidate(addr1, 0x01_bytes32);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x0b_bytes32);
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 3u);
+}
+
+TEST(caching_host, storage_batch)
+{
+    evmc::MockedHost mocked;
+    mocked.accounts[addr1].storage[0x01_bytes32] = 0x0a_bytes32;
+    mocked.accounts[addr2].storage[0x02_bytes32] = 0x0b_bytes32;
+    evmc::CachingHost host{mocked};
+
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x0a_bytes32);
+    const evmc_storage_key keys[] = {{addr1, 0x01_bytes32}, {addr2, 0x02_bytes32}};
+    evmc::bytes32 values[2];
+    host.get_storage_batch(keys, values, 2);
+    EXPECT_EQ(values[0], 0x0a_bytes32);
+    EXPECT_EQ(values[1], 0x0b_bytes32);
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 2u);
+
+    host.get_storage_batch(keys, values, 2);
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 2u);
+    EXPECT_EQ(host.num_cached_storage_values(), 2u);
+}
+
+TEST(caching_host, invalidation_by_call_and_selfdestruct)
+{
+    evmc::MockedHost mocked;
+    evmc::CachingHost host{mocked};
+
+    EXPECT_EQ(host.get_balance(addr1), evmc::bytes32{});
+    EXPECT_EQ(host.get_balance(addr2), evmc::bytes32{});
+    host.get_storage(addr1, 0x01_bytes32);
+    EXPECT_EQ(host.num_cached_accounts(), 2u);
+    EXPECT_EQ(host.num_cached_storage_values(), 1u);
+
+    evmc_message msg{};
+    msg.sender = addr1;
+    msg.recipient = addr2;
+    host.call(msg);
+    EXPECT_EQ(host.num_cached_accounts(), 0u);
+    EXPECT_EQ(host.num_cached_storage_values(), 0u);
+
+    host.get_balance(addr1);
+    host.selfdestruct(addr1, addr2);
+    EXPECT_EQ(host.num_cached_accounts(), 0u);
+}
+
+TEST(caching_host, reentrant_call)
+{
+    // The nested execution writes the caller's storage through the client's Host.
+    class ReentrantHost : public evmc::MockedHost
+    {
+    public:
+        evmc::Result call(const evmc_message& msg) noexcept override
+        {
+            accounts[msg.sender].storage[0x01_bytes32].current = 0x02_bytes32;
+            return evmc::MockedHost::call(msg);
+        }
+    };
+
+    ReentrantHost mocked;
+    evmc::CachingHost host{mocked};
+
+    host.set_storage(addr1, 0x01_bytes32, 0x01_bytes32);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x01_bytes32);
+
+    evmc_message msg{};
+    msg.kind = EVMC_DELEGATECALL;
+    msg.sender = addr1;
+    msg.recipient = addr2;
+    host.call(msg);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x02_bytes32);
+}
+
+TEST(caching_host, reverted_frame)
+{
+    evmc::MockedHost mocked;
+    evmc::CachingHost host{mocked};
+    mocked.accounts[addr1].storage[0x01_bytes32] = {0x01_bytes32};
+
+    const auto snapshot = mocked.snapshot();
+    host.set_storage(addr1, 0x01_bytes32, 0x02_bytes32);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x02_bytes32);
+
+    // The frame reverts: the written value is still cached until clear().
+    mocked.revert(snapshot);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x02_bytes32);
+    host.clear();
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x01_bytes32);
+}
+
+TEST(caching_host, zero_capacity)
+{
+    evmc::MockedHost mocked;
+    evmc::CachingHost host{mocked, 0, 0};
+
+    host.get_balance(addr1);
+    host.get_balance(addr1);
+    host.set_storage(addr1, 0x01_bytes32, 0x01_bytes32);
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x01_bytes32);
+    EXPECT_EQ(mocked.recorded_account_accesses.size(), 4u);
+    EXPECT_EQ(host.num_cached_accounts(), 0u);
+    EXPECT_EQ(host.num_cached_storage_values(), 0u);
+}
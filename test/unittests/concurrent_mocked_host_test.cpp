@@ -0,0 +1,194 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include "examples/example_vm/example_vm.h"
+#include <evmc/concurrent_mocked_host.hpp>
+#include <evmc/hex.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace evmc::literals;
+using evmc::address;
+using evmc::bytes32;
+
+TEST(concurrent_mocked_host, state)
+{
+    evmc::ConcurrentMockedHost host;
+    EXPECT_FALSE(host.account_exists(0x01_address));
+    EXPECT_FALSE(host.get_account(0x01_address).has_value());
+    EXPECT_EQ(host.num_accounts(), 0u);
+
+    host.with_account(0x01_address, [](auto& acc) {
+        acc.set_balance(5);
+        acc.code = *evmc::from_hex("6000");
+        acc.codehash = 0xcc_bytes32;
+        acc.storage[0x01_bytes32] = {0x02_bytes32, EVMC_ACCESS_WARM};
+    });
+    EXPECT_TRUE(host.account_exists(0x01_address));
+    EXPECT_EQ(host.get_balance(0x01_address), bytes32{5});
+    EXPECT_EQ(host.get_code_size(0x01_address), 2u);
+    EXPECT_EQ(host.get_code_hash(0x01_address), 0xcc_bytes32);
+    uint8_t code[3]{};
+    EXPECT_EQ(host.copy_code(0x01_address, 1, code, sizeof(code)), 1u);
+    EXPECT_EQ(code[0], 0x00);
+    evmc_code_view view{};
+    EXPECT_TRUE(host.get_code_view(0x01_address, view));
+    EXPECT_EQ(view.code_size, 2u);
+    EXPECT_TRUE(host.get_code_view(0x02_address, view));
+    EXPECT_EQ(view.code_size, 0u);
+
+    // The storage statuses follow the MockedHost.
+    EXPECT_EQ(host.get_storage(0x01_address, 0x01_bytes32), 0x02_bytes32);
+    EXPECT_EQ(host.set_storage(0x01_address, 0x01_bytes32, 0x03_bytes32), EVMC_STORAGE_MODIFIED);
+    EXPECT_EQ(host.set_storage(0x01_address, 0x01_bytes32, 0x02_bytes32),
+              EVMC_STORAGE_MODIFIED_RESTORED);
+    EXPECT_EQ(host.set_storage(0x02_address, 0x01_bytes32, 0x01_bytes32), EVMC_STORAGE_ADDED);
+    EXPECT_EQ(host.num_accounts(), 2u);
+
+    host.set_transient_storage(0x01_address, 0x01_bytes32, 0x04_bytes32);
+    EXPECT_EQ(host.get_transient_storage(0x01_address, 0x01_bytes32), 0x04_bytes32);
+    EXPECT_EQ(host.get_transient_storage(0x03_address, 0x01_bytes32), bytes32{});
+
+    const auto acc = host.get_account(0x01_address);
+    ASSERT_TRUE(acc.has_value());
+    EXPECT_EQ(acc->storage.at(0x01_bytes32).current, 0x02_bytes32);
+}
+
+TEST(concurrent_mocked_host, access_status)
+{
+    evmc::ConcurrentMockedHost host;
+    host.with_account(0x0a_address,
+                      [](auto& acc) { acc.storage[0x01_bytes32] = {{}, EVMC_ACCESS_WARM}; });
+
+    EXPECT_EQ(host.access_account(0x0a_address), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host.access_account(0x0a_address), EVMC_ACCESS_WARM);
+    EXPECT_EQ(host.access_account(0x01_address), EVMC_ACCESS_WARM);
+    EXPECT_EQ(host.access_storage(0x0a_address, 0x01_bytes32), EVMC_ACCESS_WARM);
+    EXPECT_EQ(host.access_storage(0x0a_address, 0x02_bytes32), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host.access_storage(0x0a_address, 0x02_bytes32), EVMC_ACCESS_WARM);
+
+    // The other thread has its own warm accounts and storage slots.
+    std::thread{[&host] {
+        EXPECT_EQ(host.access_account(0x0a_address), EVMC_ACCESS_COLD);
+        EXPECT_EQ(host.access_storage(0x0a_address, 0x02_bytes32), EVMC_ACCESS_COLD);
+    }}.join();
+
+    host.clear_records();
+    EXPECT_EQ(host.access_account(0x0a_address), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host.access_storage(0x0a_address, 0x02_bytes32), EVMC_ACCESS_COLD);
+}
+
+TEST(concurrent_mocked_host, begin_transaction)
+{
+    evmc::ConcurrentMockedHost host;
+    EXPECT_EQ(host.access_account(0x0a_address), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host.access_storage(0x0a_address, 0x01_bytes32), EVMC_ACCESS_COLD);
+    host.set_transient_storage(0x0a_address, 0x01_bytes32, 0x02_bytes32);
+    host.emit_log(0x0a_address, nullptr, 0, nullptr, 0);
+
+    // The transient storage is not shared with the other threads nor stored in the accounts.
+    std::thread{[&host] {
+        EXPECT_EQ(host.get_transient_storage(0x0a_address, 0x01_bytes32), bytes32{});
+        host.set_transient_storage(0x0a_address, 0x01_bytes32, 0x03_bytes32);
+    }}.join();
+    EXPECT_EQ(host.get_transient_storage(0x0a_address, 0x01_bytes32), 0x02_bytes32);
+    EXPECT_EQ(host.num_accounts(), 0u);
+
+    host.begin_transaction();
+    EXPECT_EQ(host.access_account(0x0a_address), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host.access_storage(0x0a_address, 0x01_bytes32), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host.get_transient_storage(0x0a_address, 0x01_bytes32), bytes32{});
+    EXPECT_EQ(host.recorded_logs().size(), 1u);
+}
+
+TEST(concurrent_mocked_host, multiple_hosts)
+{
+    // The records of the hosts used alternately by the same thread are kept apart.
+    evmc::ConcurrentMockedHost host1;
+    EXPECT_EQ(host1.access_account(0x0a_address), EVMC_ACCESS_COLD);
+    {
+        evmc::ConcurrentMockedHost host2;
+        EXPECT_EQ(host2.access_account(0x0a_address), EVMC_ACCESS_COLD);
+        EXPECT_EQ(host1.access_account(0x0a_address), EVMC_ACCESS_WARM);
+        EXPECT_EQ(host2.access_account(0x0a_address), EVMC_ACCESS_WARM);
+    }
+
+    // The host created in place of the destroyed one starts with no records.
+    evmc::ConcurrentMockedHost host3;
+    EXPECT_EQ(host3.access_account(0x0a_address), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host1.access_account(0x0a_address), EVMC_ACCESS_WARM);
+}
+
+TEST(concurrent_mocked_host, records)
+{
+    evmc::ConcurrentMockedHost host;
+    const uint8_t data[] = {0x01, 0x02};
+    const bytes32 topic = 0xaa_bytes32;
+    host.emit_log(0x01_address, data, std::size(data), &topic, 1);
+    EXPECT_TRUE(host.selfdestruct(0x01_address, 0x02_address));
+    EXPECT_FALSE(host.selfdestruct(0x01_address, 0x03_address));
+    host.get_block_hash(7);
+    host.call({});
+
+    std::thread{[&host] {
+        host.emit_log(0x02_address, nullptr, 0, nullptr, 0);
+        EXPECT_TRUE(host.selfdestruct(0x01_address, 0x04_address));
+    }}.join();
+
+    const auto logs = host.recorded_logs();
+    ASSERT_EQ(logs.size(), 2u);
+    const auto& log = logs[0].creator == 0x01_address ? logs[0] : logs[1];
+    EXPECT_EQ(log.data, evmc::bytes_view(data, std::size(data)));
+    ASSERT_EQ(log.topics.size(), 1u);
+    EXPECT_EQ(log.topics[0], topic);
+    EXPECT_EQ(host.recorded_selfdestructs().at(0x01_address).size(), 3u);
+    EXPECT_EQ(host.recorded_blockhashes(), std::vector<int64_t>{7});
+    EXPECT_EQ(host.recorded_calls().size(), 1u);
+
+    host.clear_records();
+    EXPECT_TRUE(host.recorded_logs().empty());
+    EXPECT_TRUE(host.recorded_selfdestructs().empty());
+}
+
+TEST(concurrent_mocked_host, concurrent_executions)
+{
+    // SSTORE(0, SLOAD(0) + CALLDATALOAD(0))
+    const auto code = *evmc::from_hex("60003560005401600055");
+    constexpr size_t num_threads = 4;
+    constexpr int num_executions = 200;
+
+    evmc::ConcurrentMockedHost host;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&host, &code, t] {
+            auto vm = evmc::VM{evmc_create_example_vm()};
+            const bytes32 input{1};
+            evmc_message msg{};
+            msg.gas = 100000;
+            msg.recipient = address{0x1000 + t};
+            msg.input_data = input.bytes;
+            msg.input_size = sizeof(input);
+            for (int i = 0; i < num_executions; ++i)
+            {
+                const auto r = vm.execute(host, EVMC_CANCUN, msg, code.data(), code.size());
+                EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+
+                // The shared account accessed by all the threads.
+                host.set_storage(0x01_address, bytes32{t}, bytes32{uint64_t(i)});
+                host.emit_log(msg.recipient, nullptr, 0, nullptr, 0);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(host.num_accounts(), num_threads + 1);
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        EXPECT_EQ(host.get_storage(address{0x1000 + t}, {}), bytes32{num_executions});
+        EXPECT_EQ(host.get_storage(0x01_address, bytes32{t}), bytes32{num_executions - 1});
+    }
+    EXPECT_EQ(host.recorded_logs().size(), num_threads * num_executions);
+}
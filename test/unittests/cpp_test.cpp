@@ -11,6 +11,7 @@
 
 #include <evmc/evmc.hpp>
 #include <evmc/mocked_host.hpp>
+#include <evmc/precompiles.hpp>
 #include <gtest/gtest.h>
 #include <array>
 #include <cctype>
@@ -94,6 +95,92 @@ public:
     {}
 };
 
+/// The statically dispatched Host keeping the storage of a single account.
+class StaticStorageHost : public evmc::HostCRTP<StaticStorageHost>
+{
+public:
+    std::map<evmc::bytes32, evmc::bytes32> storage;
+    mutable int num_storage_reads = 0;
+
+    bool account_exists(const evmc::address& /*addr*/) const noexcept { return true; }
+
+    evmc::bytes32 get_storage(const evmc::address& /*addr*/,
+                              const evmc::bytes32& key) const noexcept
+    {
+        ++num_storage_reads;
+        const auto it = storage.find(key);
+        return it != storage.end() ? it->second : evmc::bytes32{};
+    }
+
+    evmc_storage_status set_storage(const evmc::address& /*addr*/,
+                                    const evmc::bytes32& key,
+                                    const evmc::bytes32& value) noexcept
+    {
+        storage[key] = value;
+        return EVMC_STORAGE_ASSIGNED;
+    }
+
+    evmc::uint256be get_balance(const evmc::address& /*addr*/) const noexcept { return {}; }
+
+    size_t get_code_size(const evmc::address& /*addr*/) const noexcept { return 0; }
+
+    evmc::bytes32 get_code_hash(const evmc::address& /*addr*/) const noexcept { return {}; }
+
+    size_t copy_code(const evmc::address& /*addr*/,
+                     size_t /*code_offset*/,
+                     uint8_t* /*buffer_data*/,
+                     size_t /*buffer_size*/) const noexcept
+    {
+        return 0;
+    }
+
+    bool selfdestruct(const evmc::address& /*addr*/,
+                      const evmc::address& /*beneficiary*/) noexcept
+    {
+        return false;
+    }
+
+    evmc::Result call(const evmc_message& /*msg*/) noexcept { return evmc::Result{EVMC_REVERT}; }
+
+    evmc_tx_context get_tx_context() const noexcept { return {}; }
+
+    evmc::bytes32 get_block_hash(int64_t /*block_number*/) const noexcept { return {}; }
+
+    void emit_log(const evmc::address& /*addr*/,
+                  const uint8_t* /*data*/,
+                  size_t /*data_size*/,
+                  const evmc::bytes32 /*topics*/[],
+                  size_t /*num_topics*/) noexcept
+    {}
+
+    evmc_access_status access_account(const evmc::address& /*addr*/) noexcept
+    {
+        return EVMC_ACCESS_COLD;
+    }
+
+    evmc_access_status access_storage(const evmc::address& /*addr*/,
+                                      const evmc::bytes32& /*key*/) noexcept
+    {
+        return EVMC_ACCESS_COLD;
+    }
+
+    evmc::bytes32 get_transient_storage(const evmc::address& /*addr*/,
+                                        const evmc::bytes32& /*key*/) const noexcept
+    {
+        return {};
+    }
+
+    void set_transient_storage(const evmc::address& /*addr*/,
+                               const evmc::bytes32& /*key*/,
+                               const evmc::bytes32& /*value*/) noexcept
+    {}
+
+    /// Hides the default implementation.
+    const evmc_tracer* get_tracer() noexcept { return &tracer; }
+
+    evmc_tracer tracer{};
+};
+
 TEST(cpp, address)
 {
     evmc::address a;
@@ -514,7 +601,7 @@ TEST(cpp, vm_capabilities)
 
 TEST(cpp, vm_set_option)
 {
-    evmc_vm raw = {EVMC_ABI_VERSION, "", "", nullptr, nullptr, nullptr, nullptr};
+    evmc_vm raw = {EVMC_ABI_VERSION, "", "", nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
     raw.destroy = [](evmc_vm*) {};
 
     auto vm = evmc::VM{&raw};
@@ -532,13 +619,53 @@ TEST(cpp, vm_set_option_in_constructor)
         return EVMC_SET_OPTION_INVALID_NAME;
     };
 
-    evmc_vm raw{EVMC_ABI_VERSION, "", "", nullptr, nullptr, nullptr, set_option_method};
+    evmc_vm raw{EVMC_ABI_VERSION, "", "", nullptr, nullptr, nullptr, set_option_method, nullptr,
+                nullptr};
     raw.destroy = [](evmc_vm*) {};
 
     const auto vm = evmc::VM{&raw, {{"o", "1"}, {"o", "2"}}};
     EXPECT_EQ(num_calls, 2);
 }
 
+TEST(cpp, vm_release_code_analysis)
+{
+    static int analysis = 0;
+    static void* released = nullptr;
+
+    evmc_vm raw{EVMC_ABI_VERSION, "", "", nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    raw.destroy = [](evmc_vm*) {};
+    raw.execute = [](evmc_vm*, const evmc_host_interface*, evmc_host_context*, evmc_revision,
+                     const evmc_message* msg, const uint8_t*, size_t) {
+        if (msg->code_analysis != nullptr && msg->code_analysis->analysis == nullptr)
+            msg->code_analysis->analysis = &analysis;
+        return evmc_result{};
+    };
+    raw.release_code_analysis = [](evmc_vm*, void* a) { released = a; };
+
+    auto vm = evmc::VM{&raw};
+    evmc_code_analysis_slot slot{};
+    auto msg = evmc_message{};
+    msg.code_analysis = &slot;
+    vm.execute(evmc_host_interface{}, nullptr, EVMC_MAX_REVISION, msg, nullptr, 0);
+    EXPECT_EQ(slot.analysis, &analysis);
+    EXPECT_EQ(released, nullptr);
+
+    vm.release_code_analysis(slot);
+    EXPECT_EQ(released, &analysis);
+    EXPECT_EQ(slot.analysis, nullptr);
+
+    // Releasing an empty slot does not call the VM.
+    released = nullptr;
+    vm.release_code_analysis(slot);
+    EXPECT_EQ(released, nullptr);
+
+    // VMs not using the slots do not provide the release method.
+    raw.release_code_analysis = nullptr;
+    slot.analysis = &analysis;
+    vm.release_code_analysis(slot);
+    EXPECT_EQ(slot.analysis, nullptr);
+}
+
 TEST(cpp, vm_null)
 {
     const evmc::VM vm;
@@ -547,11 +674,70 @@ TEST(cpp, vm_null)
     EXPECT_EQ(vm.get_raw_pointer(), nullptr);
 }
 
+TEST(cpp, vm_execute_batch)
+{
+    static int num_batches = 0;
+
+    evmc_vm raw{EVMC_ABI_VERSION, "", "", nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    raw.destroy = [](evmc_vm*) {};
+    raw.execute = [](evmc_vm*, const evmc_host_interface*, evmc_host_context*, evmc_revision rev,
+                     const evmc_message* msg, const uint8_t*, size_t code_size) {
+        const uint8_t output[] = {static_cast<uint8_t>(rev), static_cast<uint8_t>(code_size)};
+        return evmc_make_result(EVMC_SUCCESS, msg->gas, 0, output, sizeof(output));
+    };
+
+    evmc::MockedHost host;
+    const uint8_t code[] = {0x00, 0x00, 0x00};
+    evmc_message msg1{};
+    msg1.gas = 1;
+    evmc_message msg2{};
+    msg2.gas = 2;
+    const std::vector<evmc_execution_request> requests{
+        {EVMC_BERLIN, &msg1, code, 1},
+        {EVMC_LONDON, &msg2, code, 3},
+        {EVMC_PARIS, &msg1, nullptr, 0},
+    };
+
+    // The fallback executes the requests one by one.
+    auto vm = evmc::VM{&raw};
+    auto results = vm.execute_batch(host, requests);
+    ASSERT_EQ(results.size(), 3u);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = requests[i];
+        ASSERT_EQ(results[i].output_size, 2u);
+        EXPECT_EQ(results[i].gas_left, r.msg->gas);
+        EXPECT_EQ(results[i].output_data[0], r.rev);
+        EXPECT_EQ(results[i].output_data[1], r.code_size);
+    }
+
+    // The VM batch implementation is used when provided.
+    raw.execute_batch = [](evmc_vm*, const evmc_host_interface*, evmc_host_context*,
+                           const evmc_execution_request*, size_t count, evmc_result* out) {
+        ++num_batches;
+        for (size_t i = 0; i < count; ++i)
+            out[i] = evmc_make_result(EVMC_REVERT, 0, 0, nullptr, 0);
+    };
+    results = vm.execute_batch(host, requests);
+    EXPECT_EQ(num_batches, 1);
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[2].status_code, EVMC_REVERT);
+
+    EXPECT_TRUE(vm.execute_batch(host, {}).empty());
+}
+
 TEST(cpp, vm_move)
 {
     static int destroy_counter = 0;
-    const auto template_vm = evmc_vm{
-        EVMC_ABI_VERSION, "", "", [](evmc_vm*) { ++destroy_counter; }, nullptr, nullptr, nullptr};
+    const auto template_vm = evmc_vm{EVMC_ABI_VERSION,
+                                     "",
+                                     "",
+                                     [](evmc_vm*) { ++destroy_counter; },
+                                     nullptr,
+                                     nullptr,
+                                     nullptr,
+                                     nullptr,
+                                     nullptr};
 
     EXPECT_EQ(destroy_counter, 0);
     {
@@ -621,6 +807,64 @@ TEST(cpp, vm_execute_precompiles)
     EXPECT_EQ(res.gas_left, 0);
     ASSERT_EQ(res.output_size, input.size());
     EXPECT_TRUE(std::equal(input.begin(), input.end(), res.output_data));
+
+    // BLAKE2F is not implemented: rejected since Istanbul, empty account before.
+    msg.code_address.bytes[19] = 9;
+    EXPECT_EQ(vm.execute(EVMC_ISTANBUL, msg, nullptr, 0).status_code, EVMC_REJECTED);
+    EXPECT_EQ(vm.execute(EVMC_PETERSBURG, msg, nullptr, 0).status_code, EVMC_SUCCESS);
+}
+
+TEST(cpp, precompiles_table)
+{
+    namespace precompiles = evmc::precompiles;
+
+    EXPECT_EQ(precompiles::find(0x00_address, EVMC_MAX_REVISION), nullptr);
+    EXPECT_EQ(precompiles::find(0x0104_address, EVMC_MAX_REVISION), nullptr);
+    EXPECT_EQ(precompiles::find(0x05_address, EVMC_HOMESTEAD), nullptr);
+    EXPECT_EQ(precompiles::find(0x0a_address, EVMC_SHANGHAI), nullptr);
+    EXPECT_EQ(precompiles::find(0x0b_address, EVMC_MAX_REVISION), nullptr);
+
+    const auto* identity = precompiles::find(0x04_address, EVMC_FRONTIER);
+    ASSERT_NE(identity, nullptr);
+    EXPECT_STREQ(identity->name, "identity");
+    EXPECT_EQ(identity->gas_cost(nullptr, 33, EVMC_FRONTIER), 21);
+
+    const auto* ecadd = precompiles::find(0x06_address, EVMC_BYZANTIUM);
+    ASSERT_NE(ecadd, nullptr);
+    EXPECT_EQ(ecadd->gas_cost(nullptr, 0, EVMC_BYZANTIUM), 500);
+    EXPECT_EQ(ecadd->gas_cost(nullptr, 0, EVMC_ISTANBUL), 150);
+
+    // EXPMOD with base_len = 1, exp_len = 1, mod_len = 1, exp = 0xff.
+    uint8_t expmod_input[99]{};
+    expmod_input[31] = expmod_input[63] = expmod_input[95] = 1;
+    expmod_input[96] = 2;
+    expmod_input[97] = 0xff;
+    expmod_input[98] = 5;
+    const auto* expmod = precompiles::find(0x05_address, EVMC_BERLIN);
+    ASSERT_NE(expmod, nullptr);
+    EXPECT_EQ(expmod->gas_cost(expmod_input, sizeof(expmod_input), EVMC_BYZANTIUM), 0);  // 1 * 7 / 20
+    EXPECT_EQ(expmod->gas_cost(expmod_input, sizeof(expmod_input), EVMC_BERLIN), 200);
+    expmod_input[5] = 1;  // Huge base_len.
+    EXPECT_EQ(expmod->gas_cost(expmod_input, sizeof(expmod_input), EVMC_BERLIN),
+              std::numeric_limits<int64_t>::max());
+
+    const uint8_t input[] = {1, 2, 3};
+    evmc_message msg{};
+    msg.input_data = input;
+    msg.input_size = sizeof(input);
+    msg.gas = 20;
+    auto res = evmc::Result{precompiles::execute(*identity, EVMC_CANCUN, msg)};
+    EXPECT_EQ(res.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(res.gas_left, 2);
+    EXPECT_EQ(evmc::bytes_view(res.output_data, res.output_size), evmc::bytes_view(input, 3));
+
+    msg.gas = 17;
+    res = evmc::Result{precompiles::execute(*identity, EVMC_CANCUN, msg)};
+    EXPECT_EQ(res.status_code, EVMC_OUT_OF_GAS);
+    EXPECT_EQ(res.gas_left, 0);
+
+    res = evmc::Result{precompiles::execute(*ecadd, EVMC_CANCUN, msg)};
+    EXPECT_EQ(res.status_code, EVMC_REJECTED);
 }
 
 TEST(cpp, vm_execute_with_null_host)
@@ -682,6 +926,137 @@ TEST(cpp, host)
     EXPECT_EQ(host.get_transient_storage(a, 0x01_bytes32), v);
 }
 
+TEST(cpp, host_tx_context_cached)
+{
+    evmc::MockedHost mockedHost;
+    mockedHost.tx_context.block_number = 7;
+    mockedHost.tx_context.block_timestamp = 11;
+
+    auto host_interface = evmc::MockedHost::get_interface();
+    static int num_calls = 0;
+    num_calls = 0;
+    host_interface.get_tx_context = [](evmc_host_context* ctx) noexcept {
+        ++num_calls;
+        return evmc::MockedHost::get_interface().get_tx_context(ctx);
+    };
+    const auto host = evmc::HostContext{host_interface, mockedHost.to_context()};
+    EXPECT_EQ(num_calls, 0);
+
+    EXPECT_EQ(host.get_tx_context().block_number, 7);
+    EXPECT_EQ(host.get_tx_context().block_timestamp, 11);
+    EXPECT_EQ(num_calls, 1);
+
+    // The context is fetched once per HostContext, the later changes are not visible.
+    mockedHost.tx_context.block_number = 8;
+    EXPECT_EQ(host.get_tx_context().block_number, 7);
+    EXPECT_EQ(num_calls, 1);
+    const auto new_host = evmc::HostContext{host_interface, mockedHost.to_context()};
+    EXPECT_EQ(new_host.get_tx_context().block_number, 8);
+    EXPECT_EQ(num_calls, 2);
+}
+
+TEST(cpp, host_storage_batch)
+{
+    evmc::MockedHost mockedHost;
+    mockedHost.accounts[0xa1_address].storage[0xc1_bytes32].current = 0x01_bytes32;
+    mockedHost.accounts[0xa2_address].storage[0xc2_bytes32].current = 0x02_bytes32;
+
+    const evmc_storage_key keys[] = {
+        {0xa1_address, 0xc1_bytes32},
+        {0xa2_address, 0xc2_bytes32},
+        {0xa2_address, 0xc1_bytes32},
+    };
+
+    // Host providing the batched callback.
+    {
+        auto host = evmc::HostContext{evmc::MockedHost::get_interface(), mockedHost.to_context()};
+        evmc::bytes32 values[std::size(keys)];
+        host.get_storage_batch(keys, values, std::size(keys));
+        EXPECT_EQ(values[0], 0x01_bytes32);
+        EXPECT_EQ(values[1], 0x02_bytes32);
+        EXPECT_EQ(values[2], 0x00_bytes32);
+    }
+
+    // Host without the batched callback: HostContext falls back to get_storage().
+    {
+        auto host_interface = evmc::MockedHost::get_interface();
+        host_interface.get_storage_batch = nullptr;
+        auto host = evmc::HostContext{host_interface, mockedHost.to_context()};
+        evmc::bytes32 values[std::size(keys)];
+        host.get_storage_batch(keys, values, std::size(keys));
+        EXPECT_EQ(values[0], 0x01_bytes32);
+        EXPECT_EQ(values[1], 0x02_bytes32);
+        EXPECT_EQ(values[2], 0x00_bytes32);
+    }
+
+    // Host not overriding the method: the default get_storage() loop is used.
+    {
+        NullHost host;
+        evmc::bytes32 values[]{0xff_bytes32, 0xff_bytes32};
+        host.get_storage_batch(keys, values, std::size(values));
+        EXPECT_EQ(values[0], 0x00_bytes32);
+        EXPECT_EQ(values[1], 0x00_bytes32);
+    }
+}
+
+TEST(cpp, host_code_view)
+{
+    evmc::MockedHost mockedHost;
+    mockedHost.accounts[0xa1_address].code = {0x60, 0x01, 0x00};
+    mockedHost.accounts[0xa1_address].codehash = 0xc0de_bytes32;
+
+    // Host providing the view: no copy is made.
+    {
+        auto host = evmc::HostContext{evmc::MockedHost::get_interface(), mockedHost.to_context()};
+        evmc_code_view view{};
+        ASSERT_TRUE(host.get_code_view(0xa1_address, view));
+        EXPECT_EQ(view.code, mockedHost.accounts[0xa1_address].code.data());
+        EXPECT_EQ(view.code_size, 3u);
+        EXPECT_EQ(view.code_hash, 0xc0de_bytes32);
+    }
+
+    // Host without the view callback: HostContext copies the code once.
+    {
+        auto host_interface = evmc::MockedHost::get_interface();
+        host_interface.get_code_view = nullptr;
+        auto host = evmc::HostContext{host_interface, mockedHost.to_context()};
+        evmc_code_view view1{};
+        ASSERT_TRUE(host.get_code_view(0xa1_address, view1));
+        ASSERT_EQ(view1.code_size, 3u);
+        EXPECT_NE(view1.code, mockedHost.accounts[0xa1_address].code.data());
+        EXPECT_EQ(evmc::bytes_view(view1.code, view1.code_size),
+                  mockedHost.accounts[0xa1_address].code);
+        EXPECT_EQ(view1.code_hash, 0xc0de_bytes32);
+
+        evmc_code_view empty{};
+        ASSERT_TRUE(host.get_code_view(0xa2_address, empty));
+        EXPECT_EQ(empty.code_size, 0u);
+        EXPECT_EQ(empty.code_hash, evmc::bytes32{});
+
+        evmc_code_view view2{};
+        ASSERT_TRUE(host.get_code_view(0xa1_address, view2));
+        EXPECT_EQ(view2.code, view1.code);
+
+        // The code at the address changes: the new code is copied, the old view stays valid.
+        mockedHost.accounts[0xa1_address].code = {0x60, 0x02, 0x00};
+        mockedHost.accounts[0xa1_address].codehash = 0xc0de02_bytes32;
+        evmc_code_view view3{};
+        ASSERT_TRUE(host.get_code_view(0xa1_address, view3));
+        EXPECT_NE(view3.code, view1.code);
+        EXPECT_EQ(evmc::bytes_view(view3.code, view3.code_size),
+                  mockedHost.accounts[0xa1_address].code);
+        EXPECT_EQ(view3.code_hash, 0xc0de02_bytes32);
+        EXPECT_EQ(view1.code[1], 0x01);
+    }
+
+    // Host not overriding the method declines to provide the view.
+    {
+        NullHost host;
+        evmc_code_view view{};
+        EXPECT_FALSE(host.get_code_view(0xa1_address, view));
+    }
+}
+
 TEST(cpp, host_call)
 {
     // Use example host to test Host::call() method.
@@ -830,9 +1205,182 @@ TEST(cpp, result_create)
     EXPECT_EQ(c.gas_left, r.gas_left);
     ASSERT_EQ(c.output_size, r.output_size);
     EXPECT_EQ(evmc::address{c.create_address}, evmc::address{r.create_address});
-    ASSERT_TRUE(c.release);
-    EXPECT_TRUE(std::memcmp(c.output_data, r.output_data, c.output_size) == 0);
-    c.release(&c);
+    EXPECT_FALSE(c.release);
+    EXPECT_EQ(c.flags, uint32_t{EVMC_RESULT_INLINE_OUTPUT});
+    EXPECT_FALSE(c.output_data);
+    EXPECT_TRUE(std::memcmp(evmc_get_output_data(&c), r.output_data, c.output_size) == 0);
+    evmc_release_result(&c);
+}
+
+TEST(cpp, result_create_long_output)
+{
+    const auto output = evmc::bytes(EVMC_INLINE_OUTPUT_MAX_SIZE + 1, 0xfe);
+    auto r = evmc::Result{EVMC_SUCCESS, 1, 0, output.data(), output.size()};
+    EXPECT_FALSE(r.has_inline_output());
+    EXPECT_TRUE(r.raw().release);
+    EXPECT_EQ(evmc::bytes_view(r.output_data, r.output_size), output);
+    EXPECT_EQ(evmc_get_output_data(&r.raw()), r.output_data);
+}
+
+TEST(cpp, result_inline_output)
+{
+    const auto output = evmc::bytes(EVMC_INLINE_OUTPUT_MAX_SIZE, 0xfe);
+    auto r = evmc::Result{EVMC_SUCCESS, 1, 0, output.data(), output.size()};
+    EXPECT_TRUE(r.has_inline_output());
+    EXPECT_FALSE(r.raw().release);
+    EXPECT_EQ(r.output_data, r.raw().inline_output);
+    EXPECT_EQ(evmc::bytes_view(r.output_data, r.output_size), output);
+
+    // The output pointer follows the moved result.
+    auto r1 = std::move(r);
+    EXPECT_EQ(r1.output_data, r1.raw().inline_output);
+    EXPECT_EQ(evmc::bytes_view(r1.output_data, r1.output_size), output);
+
+    auto r2 = evmc::Result{};
+    r2 = std::move(r1);
+    EXPECT_EQ(r2.output_data, r2.raw().inline_output);
+    EXPECT_EQ(evmc::bytes_view(r2.output_data, r2.output_size), output);
+
+    // The raw copy does not reference the inline output of the released object.
+    const auto raw = r2.release_raw();
+    EXPECT_FALSE(raw.output_data);
+    EXPECT_EQ(evmc::bytes_view(evmc_get_output_data(&raw), raw.output_size), output);
+
+    auto r3 = evmc::Result{raw};
+    EXPECT_EQ(r3.output_data, r3.raw().inline_output);
+    EXPECT_EQ(evmc::bytes_view(r3.output_data, r3.output_size), output);
+}
+
+TEST(cpp, result_host_output)
+{
+    const uint8_t output[] = {1, 2};
+    evmc::MockedHost host;
+
+    // Host declining: the output is stored in the result.
+    {
+        auto r = evmc::Result{host, EVMC_SUCCESS, 1, 0, output, sizeof(output)};
+        ASSERT_EQ(r.output_size, size_t{2});
+        EXPECT_EQ(r.output_data[1], 2);
+        EXPECT_TRUE(r.has_inline_output());
+    }
+
+    host.output_arena_enabled = true;
+
+    // Host providing the memory: releasing the result is a no-op.
+    {
+        auto r = evmc::Result{host, EVMC_REVERT, 1, 0, output, sizeof(output)};
+        EXPECT_EQ(r.status_code, EVMC_REVERT);
+        EXPECT_EQ(r.gas_left, 1);
+        ASSERT_EQ(r.output_size, size_t{2});
+        EXPECT_EQ(r.output_data[0], 1);
+        EXPECT_EQ(r.output_data[1], 2);
+        EXPECT_FALSE(r.raw().release);
+
+        const auto data = r.output_data;
+        auto e = evmc::Result{host, EVMC_SUCCESS, 0, 0, nullptr, 0};
+        EXPECT_FALSE(e.output_data);
+        EXPECT_EQ(host.output_arena.allocate(1), data + sizeof(output));
+    }
+
+    // The C helper through the Host interface.
+    {
+        const auto& host_interface = evmc::MockedHost::get_interface();
+        auto c = evmc_make_host_output_result(&host_interface, host.to_context(), EVMC_SUCCESS, 0,
+                                              0, output, sizeof(output));
+        ASSERT_EQ(c.output_size, size_t{2});
+        EXPECT_EQ(c.output_data[1], 2);
+        EXPECT_FALSE(c.release);
+
+        host.output_arena_enabled = false;
+        c = evmc_make_host_output_result(&host_interface, host.to_context(), EVMC_SUCCESS, 0, 0,
+                                         output, sizeof(output));
+        EXPECT_EQ(c.flags, uint32_t{EVMC_RESULT_INLINE_OUTPUT});
+        EXPECT_EQ(evmc_get_output_data(&c)[1], 2);
+        evmc_release_result(&c);
+
+        c = evmc_make_host_output_result(nullptr, nullptr, EVMC_SUCCESS, 0, 0, output,
+                                         sizeof(output));
+        EXPECT_EQ(c.flags, uint32_t{EVMC_RESULT_INLINE_OUTPUT});
+        evmc_release_result(&c);
+    }
+
+    // HostContext without the callback and the Host not overriding the method decline.
+    {
+        auto host_interface = evmc::MockedHost::get_interface();
+        host_interface.allocate_output = nullptr;
+        host.output_arena_enabled = true;
+        auto ctx = evmc::HostContext{host_interface, host.to_context()};
+        EXPECT_EQ(ctx.allocate_output(1), nullptr);
+        NullHost null_host;
+        EXPECT_EQ(null_host.allocate_output(1), nullptr);
+    }
+}
+
+TEST(cpp, host_get_tracer)
+{
+    evmc::MockedHost host;
+    const auto& host_interface = evmc::MockedHost::get_interface();
+    auto ctx = evmc::HostContext{host_interface, host.to_context()};
+    EXPECT_EQ(ctx.get_tracer(), nullptr);
+
+    const evmc_tracer tracer{};
+    host.tracer = &tracer;
+    EXPECT_EQ(ctx.get_tracer(), &tracer);
+
+    auto no_tracer_interface = host_interface;
+    no_tracer_interface.get_tracer = nullptr;
+    EXPECT_EQ(evmc::HostContext(no_tracer_interface, host.to_context()).get_tracer(), nullptr);
+    NullHost null_host;
+    EXPECT_EQ(null_host.get_tracer(), nullptr);
+}
+
+TEST(cpp, tx_initcode_index)
+{
+    const evmc_tx_initcode initcodes[] = {
+        {0x03_bytes32, nullptr, 3},
+        {0x01_bytes32, nullptr, 1},
+        {0x02_bytes32, nullptr, 2},
+        {0x01_bytes32, nullptr, 4},
+    };
+    const evmc::TxInitcodeIndex index{initcodes, std::size(initcodes)};
+    EXPECT_EQ(index.size(), 4u);
+    EXPECT_EQ(index.find(0x01_bytes32), &initcodes[1]);
+    EXPECT_EQ(index.find(0x02_bytes32), &initcodes[2]);
+    EXPECT_EQ(index.find(0x03_bytes32), &initcodes[0]);
+    EXPECT_EQ(index.find(0x04_bytes32), nullptr);
+    EXPECT_EQ(index.find({}), nullptr);
+    EXPECT_EQ(evmc::TxInitcodeIndex{}.find(0x01_bytes32), nullptr);
+
+    // The linear search finds the same initcodes.
+    evmc_tx_context tx_context{};
+    tx_context.initcodes = initcodes;
+    tx_context.initcodes_count = std::size(initcodes);
+    EXPECT_EQ(evmc::TxInitcodeIndex{tx_context}.size(), 4u);
+    EXPECT_EQ(evmc::find_tx_initcode(tx_context, 0x01_bytes32), &initcodes[1]);
+    EXPECT_EQ(evmc::find_tx_initcode(tx_context, 0x03_bytes32), &initcodes[0]);
+    EXPECT_EQ(evmc::find_tx_initcode(tx_context, 0x04_bytes32), nullptr);
+}
+
+TEST(cpp, host_get_tx_initcode)
+{
+    const evmc_tx_initcode initcodes[] = {{0x01_bytes32, nullptr, 1}, {0x02_bytes32, nullptr, 2}};
+    evmc::MockedHost host;
+    host.tx_context.initcodes = initcodes;
+    host.tx_context.initcodes_count = std::size(initcodes);
+    const auto& host_interface = evmc::MockedHost::get_interface();
+    const auto ctx = evmc::HostContext{host_interface, host.to_context()};
+    EXPECT_EQ(ctx.get_tx_initcode(0x02_bytes32), &initcodes[1]);
+    EXPECT_EQ(ctx.get_tx_initcode(0x03_bytes32), nullptr);
+
+    // Without the callback the initcodes of the tx context are searched.
+    auto no_lookup_interface = host_interface;
+    no_lookup_interface.get_tx_initcode = nullptr;
+    const auto fallback_ctx = evmc::HostContext{no_lookup_interface, host.to_context()};
+    EXPECT_EQ(fallback_ctx.get_tx_initcode(0x01_bytes32), &initcodes[0]);
+    EXPECT_EQ(fallback_ctx.get_tx_initcode(0x03_bytes32), nullptr);
+
+    NullHost null_host;
+    EXPECT_EQ(null_host.get_tx_initcode(0x01_bytes32), nullptr);
 }
 
 TEST(cpp, status_code_to_string)
@@ -1012,3 +1560,59 @@ TEST(cpp, result_c_nonconst_access)
     set_status(r.raw());
     EXPECT_EQ(r.status_code, EVMC_SUCCESS);
 }
+
+TEST(cpp, host_crtp)
+{
+    StaticStorageHost static_host;
+    static_host.storage[0x01_bytes32] = 0xaa_bytes32;
+
+    const auto& host_interface = StaticStorageHost::get_interface();
+    EXPECT_EQ(&host_interface, &StaticStorageHost::get_interface());
+    EXPECT_EQ(StaticStorageHost::from_context(static_host.to_context()), &static_host);
+
+    evmc::HostContext host{host_interface, static_host.to_context()};
+    EXPECT_TRUE(host.account_exists(0x01_address));
+    EXPECT_EQ(host.get_storage(0x01_address, 0x01_bytes32), 0xaa_bytes32);
+    EXPECT_EQ(host.get_storage(0x01_address, 0x02_bytes32), evmc::bytes32{});
+    EXPECT_EQ(host.call({}).status_code, EVMC_REVERT);
+
+    // The default implementations of the optional methods.
+    const evmc_storage_key keys[] = {{0x01_address, 0x01_bytes32}, {0x01_address, 0x02_bytes32}};
+    evmc::bytes32 values[2];
+    host_interface.get_storage_batch(static_host.to_context(), keys, values, 2);
+    EXPECT_EQ(values[0], 0xaa_bytes32);
+    EXPECT_EQ(values[1], evmc::bytes32{});
+    EXPECT_EQ(static_host.num_storage_reads, 4);
+    evmc_code_view view{};
+    EXPECT_FALSE(host_interface.get_code_view(static_host.to_context(), &keys[0].address, &view));
+    EXPECT_EQ(host_interface.allocate_output(static_host.to_context(), 1), nullptr);
+    const auto hash = 0x01_bytes32;
+    EXPECT_EQ(host_interface.get_tx_initcode(static_host.to_context(), &hash), nullptr);
+
+    // The method hidden by the Host implementation.
+    EXPECT_EQ(host_interface.get_tracer(static_host.to_context()), &static_host.tracer);
+}
+
+TEST(cpp, host_crtp_execute)
+{
+    // Stores the value from the calldata[0:32] at the key 1 and returns the value at the key 2.
+    const auto code = *evmc::from_hex("60003560015560025460005260206000f3");
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    StaticStorageHost host;
+    host.storage[0x02_bytes32] = 0xbb_bytes32;
+
+    const auto input = 0xcc_bytes32;
+    evmc_message msg{};
+    msg.gas = 100000;
+    msg.input_data = input.bytes;
+    msg.input_size = sizeof(input);
+    const auto r = vm.execute(host, EVMC_CANCUN, msg, code.data(), code.size());
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    ASSERT_EQ(r.output_size, sizeof(evmc::bytes32));
+    EXPECT_EQ(r.output_data[31], 0xbb);
+    EXPECT_EQ(host.storage[0x01_bytes32], input);
+
+    const auto results = vm.execute_batch(host, {{EVMC_CANCUN, &msg, code.data(), code.size()}});
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].status_code, EVMC_SUCCESS);
+}
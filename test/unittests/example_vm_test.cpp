@@ -8,6 +8,7 @@
 #include <evmc/mocked_host.hpp>
 #include <gtest/gtest.h>
 #include <cstring>
+#include <thread>
 
 using namespace evmc::literals;
 
@@ -203,3 +204,200 @@ TEST_F(example_vm, mstore_out_of_memory)
     EXPECT_EQ(r.gas_left, 0);
     EXPECT_EQ(r, Output(""));
 }
+
+TEST_F(example_vm, prefetch_storage)
+{
+    auto prefetching_vm = evmc::VM{evmc_create_example_vm()};
+    EXPECT_EQ(prefetching_vm.set_option("prefetch_storage", "2"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(prefetching_vm.set_option("prefetch_storage", nullptr),
+              EVMC_SET_OPTION_INVALID_VALUE);
+    ASSERT_EQ(prefetching_vm.set_option("prefetch_storage", "1"), EVMC_SET_OPTION_SUCCESS);
+
+    // Yul: sstore(1, add(sload(1), sload(2))) mstore(0, sload(1)) return(0, 32)
+    const auto code = evmc::from_hex("6002546001540160015560015460005260206000f3").value();
+    auto& storage = host.accounts[msg.recipient].storage;
+    storage[0x01_bytes32] = 0x05_bytes32;
+    storage[0x02_bytes32] = 0x07_bytes32;
+    msg.gas = 100;
+    const auto r = prefetching_vm.execute(host, rev, msg, code.data(), code.size());
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r, Output("000000000000000000000000000000000000000000000000000000000000000c"));
+    EXPECT_EQ(storage[0x01_bytes32].current, 0x0c_bytes32);
+
+    // The keys 2 and 1 queried with the single batch, then the SSTORE.
+    EXPECT_EQ(host.recorded_account_accesses.size(), 3u);
+}
+
+TEST_F(example_vm, prefetch_storage_invalidated_by_call)
+{
+    // The nested execution modifies the storage of the caller.
+    class ReentrantHost : public evmc::MockedHost
+    {
+    public:
+        evmc::address caller;
+
+        evmc::Result call(const evmc_message& call_msg) noexcept override
+        {
+            accounts[caller].storage[0x01_bytes32] = 0x0e_bytes32;
+            return evmc::MockedHost::call(call_msg);
+        }
+    };
+
+    auto prefetching_vm = evmc::VM{evmc_create_example_vm()};
+    ASSERT_EQ(prefetching_vm.set_option("prefetch_storage", "1"), EVMC_SET_OPTION_SUCCESS);
+
+    ReentrantHost reentrant_host;
+    reentrant_host.caller = msg.recipient;
+    reentrant_host.accounts[msg.recipient].storage[0x01_bytes32] = 0x05_bytes32;
+
+    // CALL with all arguments 0 (the result is left on the stack),
+    // then Yul: mstore(0, sload(1)) return(0, 32)
+    const auto code =
+        evmc::from_hex("6000600060006000600060006000f160015460005260206000f3").value();
+    msg.gas = 100;
+    const auto r = prefetching_vm.execute(reentrant_host, rev, msg, code.data(), code.size());
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r, Output("000000000000000000000000000000000000000000000000000000000000000e"));
+}
+
+TEST_F(example_vm, jump)
+{
+    // PUSH1 4 JUMP INVALID JUMPDEST STOP
+    const auto r = execute_in_example_vm(10, "600456fe5b00");
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r.gas_left, 6);
+}
+
+TEST_F(example_vm, jump_bad_destination)
+{
+    // The destination in the PUSH data.
+    auto r = execute_in_example_vm(10, "600456605b00");
+    EXPECT_EQ(r.status_code, EVMC_BAD_JUMP_DESTINATION);
+    EXPECT_EQ(r.gas_left, 0);
+
+    // The destination not fitting 32 bits.
+    r = execute_in_example_vm(
+        10, "7f000000000000000000000000000000000000000000000000000000010000002256fe5b00");
+    EXPECT_EQ(r.status_code, EVMC_BAD_JUMP_DESTINATION);
+
+    // The destination out of the code.
+    r = execute_in_example_vm(10, "60ff56");
+    EXPECT_EQ(r.status_code, EVMC_BAD_JUMP_DESTINATION);
+}
+
+TEST_F(example_vm, jumpi_loop)
+{
+    // Decrements the counter from 3 to 0: PUSH2 3 JUMPDEST PUSH4 ffffffff ADD DUP1 PUSH1 3 JUMPI.
+    const auto r = execute_in_example_vm(100, "6100035b63ffffffff0180600357");
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r.gas_left, 100 - 1 - 3 * 6);
+
+    // Not enough gas for the last loop iteration.
+    const auto r_oog = execute_in_example_vm(18, "6100035b63ffffffff0180600357");
+    EXPECT_EQ(r_oog.status_code, EVMC_OUT_OF_GAS);
+    EXPECT_EQ(r_oog.gas_left, 0);
+}
+
+TEST_F(example_vm, out_of_gas_charged_per_block)
+{
+    // Yul: sstore(1, 1). The block is not executed at all.
+    const auto r = execute_in_example_vm(2, "6001600155");
+    EXPECT_EQ(r.status_code, EVMC_OUT_OF_GAS);
+    EXPECT_EQ(r.gas_left, 0);
+    EXPECT_TRUE(host.recorded_account_accesses.empty());
+}
+
+TEST_F(example_vm, stack_underflow)
+{
+    const auto r = execute_in_example_vm(10, "600101");
+    EXPECT_EQ(r.status_code, EVMC_STACK_UNDERFLOW);
+    EXPECT_EQ(r.gas_left, 0);
+
+    rev = EVMC_BYZANTIUM;
+    EXPECT_EQ(execute_in_example_vm(10, "6000fd").status_code, EVMC_STACK_UNDERFLOW);
+}
+
+TEST_F(example_vm, stack_overflow)
+{
+    // PUSH1 0 followed by DUP1 x 1023 fills the stack.
+    std::string code_hex = "6000";
+    for (int i = 0; i < 1023; ++i)
+        code_hex += "80";
+    EXPECT_EQ(execute_in_example_vm(2000, code_hex.c_str()).status_code, EVMC_SUCCESS);
+    const auto overflow_hex = code_hex + "80";
+    EXPECT_EQ(execute_in_example_vm(2000, overflow_hex.c_str()).status_code, EVMC_STACK_OVERFLOW);
+}
+
+TEST_F(example_vm, dispatch_option)
+{
+    auto switch_vm = evmc::VM{evmc_create_example_vm()};
+    EXPECT_EQ(switch_vm.set_option("dispatch", nullptr), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(switch_vm.set_option("dispatch", "jit"), EVMC_SET_OPTION_INVALID_VALUE);
+    ASSERT_EQ(switch_vm.set_option("dispatch", "switch"), EVMC_SET_OPTION_SUCCESS);
+
+    // Yul: mstore(0, sload(calldataload(0))) return(0, 32) after the loop.
+    const auto code =
+        evmc::from_hex("6100035b63ffffffff01806003576000355460005260206000f3").value();
+    host.accounts[msg.recipient].storage[0x01_bytes32] = 0x0b_bytes32;
+    const auto input = 0x01_bytes32;
+    msg.input_data = input.bytes;
+    msg.input_size = sizeof(input);
+    msg.gas = 100;
+    const auto r_switch = switch_vm.execute(host, rev, msg, code.data(), code.size());
+    const auto r_default = vm.execute(host, rev, msg, code.data(), code.size());
+    EXPECT_EQ(r_switch.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r_switch.gas_left, 100 - 1 - 3 * 6 - 8);
+    EXPECT_EQ(r_switch, Output("000000000000000000000000000000000000000000000000000000000000000b"));
+    EXPECT_EQ(r_default.status_code, r_switch.status_code);
+    EXPECT_EQ(r_default.gas_left, r_switch.gas_left);
+    EXPECT_EQ(r_default, Output(evmc::hex({r_switch.output_data, r_switch.output_size}).c_str()));
+}
+
+TEST_F(example_vm, code_analysis_slot)
+{
+    const auto raw_vm = evmc_create_example_vm();
+    ASSERT_NE(raw_vm->release_code_analysis, nullptr);
+
+    // PUSH1 4 JUMP INVALID JUMPDEST STOP
+    const auto code = evmc::from_hex("600456fe5b00").value();
+    evmc_code_analysis_slot slot{};
+    msg.code_analysis = &slot;
+    msg.gas = 10;
+    const auto& iface = evmc::MockedHost::get_interface();
+    evmc::Result r{
+        raw_vm->execute(raw_vm, &iface, host.to_context(), rev, &msg, code.data(), code.size())};
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r.gas_left, 6);
+    ASSERT_NE(slot.analysis, nullptr);
+    const auto analysis = slot.analysis;
+
+    // The cached analysis is reused.
+    r = evmc::Result{
+        raw_vm->execute(raw_vm, &iface, host.to_context(), rev, &msg, code.data(), code.size())};
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r.gas_left, 6);
+    EXPECT_EQ(slot.analysis, analysis);
+
+    // The cached analysis is immutable, so it can be shared by concurrent executions.
+    std::vector<std::thread> threads;
+    std::vector<evmc::Result> results(4);
+    for (auto& result : results)
+    {
+        threads.emplace_back([&, &result = result] {
+            evmc::MockedHost thread_host;
+            result = evmc::Result{raw_vm->execute(raw_vm, &iface, thread_host.to_context(), rev,
+                                                  &msg, code.data(), code.size())};
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (const auto& result : results)
+    {
+        EXPECT_EQ(result.status_code, EVMC_SUCCESS);
+        EXPECT_EQ(result.gas_left, 6);
+    }
+    EXPECT_EQ(slot.analysis, analysis);
+
+    raw_vm->release_code_analysis(raw_vm, slot.analysis);
+    raw_vm->destroy(raw_vm);
+}
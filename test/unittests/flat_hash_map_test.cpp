@@ -0,0 +1,160 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include <evmc/flat_hash_map.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+
+using namespace evmc::literals;
+using evmc::flat_hash_map;
+
+namespace
+{
+/// The hash function putting all keys into the same probe sequence.
+struct ConstantHash
+{
+    size_t operator()(int) const noexcept { return 0; }
+};
+
+/// The stateful hash function without the default constructor.
+struct ModuloHash
+{
+    size_t modulus;
+
+    explicit ModuloHash(size_t m) noexcept : modulus{m} {}
+
+    size_t operator()(int key) const noexcept { return static_cast<size_t>(key) % modulus; }
+};
+}  // namespace
+
+TEST(flat_hash_map, empty)
+{
+    const flat_hash_map<evmc::bytes32, int> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.size(), 0u);
+    EXPECT_EQ(m.count({}), 0u);
+    EXPECT_EQ(m.find({}), m.end());
+    EXPECT_EQ(m.begin(), m.end());
+    EXPECT_THROW(m.at({}), std::out_of_range);
+}
+
+TEST(flat_hash_map, insert_find_erase)
+{
+    flat_hash_map<evmc::bytes32, int> m;
+    m[0x01_bytes32] = 1;
+    m[0x02_bytes32] = 2;
+    EXPECT_EQ(m.size(), 2u);
+    EXPECT_EQ(m.at(0x01_bytes32), 1);
+    EXPECT_EQ(m[0x02_bytes32], 2);
+    EXPECT_EQ(m.find(0x02_bytes32)->second, 2);
+    EXPECT_EQ(m.count(0x03_bytes32), 0u);
+
+    const auto [it, inserted] = m.try_emplace(0x01_bytes32, 11);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(it->second, 1);
+    EXPECT_TRUE(m.emplace(0x03_bytes32, 3).second);
+    EXPECT_TRUE(m.insert({0x04_bytes32, 4}).second);
+    EXPECT_EQ(m.size(), 4u);
+
+    EXPECT_EQ(m.erase(0x01_bytes32), 1u);
+    EXPECT_EQ(m.erase(0x01_bytes32), 0u);
+    EXPECT_EQ(m.size(), 3u);
+    EXPECT_EQ(m.count(0x01_bytes32), 0u);
+    EXPECT_EQ(m.at(0x03_bytes32), 3);
+
+    int sum = 0;
+    for (const auto& [key, value] : m)
+        sum += value;
+    EXPECT_EQ(sum, 2 + 3 + 4);
+
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.begin(), m.end());
+    EXPECT_EQ(m.count(0x02_bytes32), 0u);
+}
+
+TEST(flat_hash_map, erase_collisions)
+{
+    // All keys collide so erase must shift the whole probe sequence, including the wrap-around.
+    flat_hash_map<int, int, ConstantHash> m;
+    for (int i = 0; i < 6; ++i)
+        m[i] = i;
+    EXPECT_EQ(m.bucket_count(), 8u);
+
+    EXPECT_EQ(m.erase(0), 1u);
+    EXPECT_EQ(m.erase(3), 1u);
+    for (int i : {1, 2, 4, 5})
+        EXPECT_EQ(m.at(i), i);
+    m[6] = 6;
+    m[7] = 7;
+    EXPECT_EQ(m.erase(1), 1u);
+    for (int i : {2, 4, 5, 6, 7})
+        EXPECT_EQ(m.at(i), i);
+    EXPECT_EQ(m.size(), 5u);
+}
+
+TEST(flat_hash_map, stateful_hash)
+{
+    // The instance passed to the constructor is used, e.g. for a per-map seed.
+    flat_hash_map<int, int, ModuloHash> m{ModuloHash{3}};
+    EXPECT_EQ(m.hash_function().modulus, 3u);
+    for (int i = 0; i < 100; ++i)
+        m[i] = i;
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(m.at(i), i);
+    EXPECT_EQ(m.erase(50), 1u);
+    EXPECT_EQ(m.count(50), 0u);
+
+    auto copy = m;
+    EXPECT_EQ(copy.hash_function().modulus, 3u);
+    EXPECT_EQ(copy, m);
+
+    const flat_hash_map<int, int, ModuloHash> init{{{1, 1}, {4, 4}}, ModuloHash{3}};
+    EXPECT_EQ(init.at(4), 4);
+}
+
+TEST(flat_hash_map, grow_and_compare_with_std_map)
+{
+    flat_hash_map<evmc::address, uint64_t> m;
+    std::map<evmc::address, uint64_t> ref;
+    std::mt19937_64 rng{7};  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        const auto key = evmc::address{rng() % 1000};
+        const auto value = rng();
+        if (value % 3 == 0)
+        {
+            EXPECT_EQ(m.erase(key), ref.erase(key));
+        }
+        else
+        {
+            m[key] = value;
+            ref[key] = value;
+        }
+    }
+
+    ASSERT_EQ(m.size(), ref.size());
+    for (const auto& [key, value] : ref)
+        EXPECT_EQ(m.at(key), value);
+    for (const auto& [key, value] : m)
+        EXPECT_EQ(ref.at(key), value);
+}
+
+TEST(flat_hash_map, reserve_and_equality)
+{
+    flat_hash_map<evmc::bytes32, int> a{{0x01_bytes32, 1}, {0x02_bytes32, 2}};
+    flat_hash_map<evmc::bytes32, int> b;
+    b.reserve(100);
+    const auto capacity = b.bucket_count();
+    EXPECT_GE(capacity * 3 / 4, 100u);
+    b[0x02_bytes32] = 2;
+    EXPECT_NE(a, b);
+    b[0x01_bytes32] = 1;
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(b.bucket_count(), capacity);
+    b[0x01_bytes32] = 0;
+    EXPECT_NE(a, b);
+}
@@ -4,6 +4,7 @@
 
 #include <evmc/hex.hpp>
 #include <gtest/gtest.h>
+#include <cctype>
 
 using namespace evmc;
 
@@ -128,3 +129,98 @@ TEST(hex, from_hex_to_custom_type)
     EXPECT_FALSE(evmc::from_hex<X>("0000000000"));
     EXPECT_FALSE(evmc::from_hex<X>("0x0000000000"));
 }
+
+TEST(hex, hex_to)
+{
+    const uint8_t data[] = {0x00, 0x01, 0xa0, 0xff, 0x55};
+    char buffer[12] = "..........,";
+    const auto end = hex_to({data, sizeof(data)}, buffer);
+    EXPECT_EQ(end, &buffer[10]);
+    EXPECT_EQ(std::string_view(buffer), "0001a0ff55,");
+    EXPECT_EQ(hex_to({}, buffer), buffer);
+}
+
+TEST(hex, from_hex_into)
+{
+    uint8_t buffer[4]{};
+    EXPECT_EQ(from_hex_into("0x0102", buffer, sizeof(buffer)), 2u);
+    EXPECT_EQ(buffer[0], 0x01);
+    EXPECT_EQ(buffer[1], 0x02);
+    EXPECT_EQ(from_hex_into("a1B2c3D4", buffer, sizeof(buffer)), 4u);
+    EXPECT_EQ(hex({buffer, sizeof(buffer)}), "a1b2c3d4");
+    EXPECT_EQ(from_hex_into("", buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(from_hex_into("0x", nullptr, 0), 0u);
+
+    EXPECT_EQ(from_hex_into("0102030405", buffer, sizeof(buffer)), std::nullopt);
+    EXPECT_EQ(from_hex_into("012", buffer, sizeof(buffer)), std::nullopt);
+    EXPECT_EQ(from_hex_into("0g", buffer, sizeof(buffer)), std::nullopt);
+    EXPECT_EQ(from_hex_into("00x0", buffer, sizeof(buffer)), std::nullopt);
+}
+
+TEST(hex, long_inputs)
+{
+    // Covers the SIMD blocks and the remaining tails of all the lengths.
+    bytes data;
+    for (size_t i = 0; i < 300; ++i)
+        data.push_back(static_cast<uint8_t>(i * 37));
+
+    for (size_t size = 0; size <= data.size(); ++size)
+    {
+        const bytes_view bs{data.data(), size};
+        std::string expected(size * 2, '\0');
+        internal::hex_encode_scalar(bs.data(), bs.size(), expected.data());
+        EXPECT_EQ(hex(bs), expected);
+
+        std::string upper = expected;
+        for (auto& c : upper)
+            c = static_cast<char>(std::toupper(c));
+        EXPECT_EQ(from_hex(expected), bs);
+        EXPECT_EQ(from_hex(upper), bs);
+    }
+}
+
+TEST(hex, long_inputs_not_hex_digit)
+{
+    const std::string valid(128, 'a');
+    for (const char c : {'/', ':', '@', 'G', '`', 'g', ' ', '\0', '\x80', '\xb0', '\xff'})
+    {
+        for (size_t i = 0; i < valid.size(); ++i)
+        {
+            auto invalid = valid;
+            invalid[i] = c;
+            EXPECT_EQ(from_hex(invalid), std::nullopt) << i << " " << int{c};
+        }
+    }
+}
+
+#if EVMC_HEX_X86
+TEST(hex, simd_implementations)
+{
+    bytes data;
+    for (size_t i = 0; i < 100; ++i)
+        data.push_back(static_cast<uint8_t>(i * 101));
+    const auto expected = hex(data);
+
+    if (__builtin_cpu_supports("ssse3"))
+    {
+        std::string out(expected.size(), '\0');
+        internal::hex_encode_ssse3(data.data(), data.size(), out.data());
+        EXPECT_EQ(out, expected);
+        bytes decoded(data.size(), 0);
+        EXPECT_TRUE(internal::hex_decode_ssse3(expected.data(), decoded.size(), decoded.data()));
+        EXPECT_EQ(decoded, data);
+        EXPECT_FALSE(internal::hex_decode_ssse3("0123456789abcdeg", 8, decoded.data()));
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        std::string out(expected.size(), '\0');
+        internal::hex_encode_avx2(data.data(), data.size(), out.data());
+        EXPECT_EQ(out, expected);
+        bytes decoded(data.size(), 0);
+        EXPECT_TRUE(internal::hex_decode_avx2(expected.data(), decoded.size(), decoded.data()));
+        EXPECT_EQ(decoded, data);
+        EXPECT_FALSE(internal::hex_decode_avx2(std::string(31, '0').append("z").data(), 16,
+                                               decoded.data()));
+    }
+}
+#endif
@@ -3,6 +3,7 @@
 // Licensed under the Apache License, Version 2.0.
 
 #include <evmc/instructions.h>
+#include <evmc/instructions.hpp>
 #include <gtest/gtest.h>
 
 inline bool operator==(const evmc_instruction_metrics& a,
@@ -394,3 +395,163 @@ TEST(instructions, shanghai_hard_fork)
     EXPECT_EQ(sn[OP_PUSH0], std::string{"PUSH0"});
     EXPECT_TRUE(pn[OP_PUSH0] == nullptr);
 }
+
+TEST(instructions, descriptors)
+{
+    EXPECT_EQ(sizeof(evmc_instruction_descriptor), 6u);
+    const auto invalid_rev = static_cast<evmc_revision>(EVMC_MAX_REVISION + 1);
+    EXPECT_EQ(evmc_get_instruction_descriptor_table(invalid_rev), nullptr);
+
+    for (auto r = int{EVMC_FRONTIER}; r <= EVMC_MAX_REVISION; ++r)
+    {
+        const auto rev = static_cast<evmc_revision>(r);
+        const auto descriptors = evmc_get_instruction_descriptor_table(rev);
+        const auto metrics = evmc_get_instruction_metrics_table(rev);
+        const auto names = evmc_get_instruction_names_table(rev);
+        ASSERT_NE(descriptors, nullptr);
+
+        for (int op = 0x00; op <= 0xff; ++op)
+        {
+            const auto& d = descriptors[op];
+            EXPECT_EQ(d.gas_cost, metrics[op].gas_cost) << rev << " " << op;
+            EXPECT_EQ(d.stack_height_required, metrics[op].stack_height_required) << op;
+            EXPECT_EQ(d.stack_height_change, metrics[op].stack_height_change) << op;
+            EXPECT_EQ(evmc::is_defined(d), names[op] != nullptr) << rev << " " << op;
+            if (!evmc::is_defined(d))
+            {
+                EXPECT_EQ(d.flags, 0) << op;
+                EXPECT_EQ(d.immediate_size, 0) << op;
+            }
+            else if (op >= OP_PUSH1 && op <= OP_PUSH32)
+                EXPECT_EQ(d.immediate_size, op - OP_PUSH1 + 1) << op;
+            else
+                EXPECT_EQ(d.immediate_size, 0) << op;
+        }
+
+        EXPECT_TRUE(evmc::is_terminator(descriptors[OP_STOP]));
+        EXPECT_TRUE(evmc::is_terminator(descriptors[OP_INVALID]));
+        EXPECT_FALSE(evmc::is_terminator(descriptors[OP_JUMP]));
+        EXPECT_TRUE(evmc::is_jump(descriptors[OP_JUMP]));
+        EXPECT_TRUE(evmc::is_jump(descriptors[OP_JUMPI]));
+        EXPECT_FALSE(evmc::is_jump(descriptors[OP_JUMPDEST]));
+        EXPECT_TRUE(evmc::has_dynamic_gas(descriptors[OP_CALL]));
+        EXPECT_FALSE(evmc::has_dynamic_gas(descriptors[OP_ADD]));
+        EXPECT_EQ(evmc::has_dynamic_gas(descriptors[OP_SLOAD]), rev >= EVMC_BERLIN);
+    }
+}
+
+static_assert(evmc::instruction_table<EVMC_FRONTIER>[OP_SLOAD].gas_cost == 50);
+static_assert(evmc::get_instruction_descriptor<EVMC_BERLIN>(OP_SLOAD).gas_cost == 100);
+static_assert(evmc::has_dynamic_gas(evmc::get_instruction_descriptor<EVMC_BERLIN>(OP_SLOAD)));
+static_assert(!evmc::is_defined(evmc::instruction_table<EVMC_LONDON>[OP_PUSH0]));
+static_assert(evmc::is_defined(evmc::instruction_table<EVMC_SHANGHAI>[OP_PUSH0]));
+static_assert(evmc::instruction_table<EVMC_CANCUN>[OP_PUSH32].immediate_size == 32);
+static_assert(evmc::instruction_names<EVMC_PARIS>[OP_PREVRANDAO][0] == 'P');
+
+TEST(instructions, constexpr_tables)
+{
+    for (auto r = int{EVMC_FRONTIER}; r <= EVMC_MAX_REVISION; ++r)
+    {
+        const auto rev = static_cast<evmc_revision>(r);
+        const auto table = evmc::make_instruction_table(rev);
+        const auto names = evmc::make_instruction_names(rev);
+        const auto c_table = evmc_get_instruction_descriptor_table(rev);
+        const auto c_names = evmc_get_instruction_names_table(rev);
+
+        for (int op = 0x00; op <= 0xff; ++op)
+        {
+            const auto& d = table[static_cast<size_t>(op)];
+            const auto& e = c_table[op];
+            EXPECT_EQ(d.gas_cost, e.gas_cost) << rev << " " << op;
+            EXPECT_EQ(d.stack_height_required, e.stack_height_required) << rev << " " << op;
+            EXPECT_EQ(d.stack_height_change, e.stack_height_change) << rev << " " << op;
+            EXPECT_EQ(d.immediate_size, e.immediate_size) << rev << " " << op;
+            EXPECT_EQ(d.flags, e.flags) << rev << " " << op;
+
+            const auto name = names[static_cast<size_t>(op)];
+            if (c_names[op] == nullptr)
+                EXPECT_EQ(name, nullptr) << rev << " " << op;
+            else
+                EXPECT_STREQ(name, c_names[op]) << rev << " " << op;
+        }
+    }
+
+    EXPECT_EQ(&evmc::instruction_table<EVMC_CANCUN>[0],
+              &evmc::get_instruction_descriptor<EVMC_CANCUN>(OP_STOP));
+}
+
+static_assert(evmc::gas_schedule<EVMC_FRONTIER>.cold_sload_cost == 0);
+static_assert(evmc::gas_schedule<EVMC_BERLIN>.cold_account_access_cost == 2600);
+static_assert(evmc::sstore_cost(evmc::gas_schedule<EVMC_LONDON>, EVMC_STORAGE_DELETED)
+                  .gas_refund == 4800);
+static_assert(evmc::memory_expansion_cost(evmc::gas_schedule<EVMC_CANCUN>, 0, 1) == 3);
+
+TEST(instructions, gas_schedule)
+{
+    const auto invalid_rev = static_cast<evmc_revision>(EVMC_MAX_REVISION + 1);
+    EXPECT_EQ(evmc_get_gas_schedule(invalid_rev), nullptr);
+
+    for (auto r = int{EVMC_FRONTIER}; r <= EVMC_MAX_REVISION; ++r)
+    {
+        const auto rev = static_cast<evmc_revision>(r);
+        const auto g = evmc::make_gas_schedule(rev);
+        const auto c = evmc_get_gas_schedule(rev);
+        ASSERT_NE(c, nullptr);
+        EXPECT_EQ(g.warm_access_cost, c->warm_access_cost) << rev;
+        EXPECT_EQ(g.cold_account_access_cost, c->cold_account_access_cost) << rev;
+        EXPECT_EQ(g.cold_sload_cost, c->cold_sload_cost) << rev;
+        EXPECT_EQ(g.sstore_sentry_gas, c->sstore_sentry_gas) << rev;
+        EXPECT_EQ(g.memory_word_cost, c->memory_word_cost) << rev;
+        EXPECT_EQ(g.memory_quadratic_divisor, c->memory_quadratic_divisor) << rev;
+        EXPECT_EQ(g.copy_word_cost, c->copy_word_cost) << rev;
+        for (int s = 0; s < EVMC_STORAGE_STATUS_COUNT; ++s)
+        {
+            EXPECT_EQ(g.sstore[s].gas_cost, c->sstore[s].gas_cost) << rev << " " << s;
+            EXPECT_EQ(g.sstore[s].gas_refund, c->sstore[s].gas_refund) << rev << " " << s;
+        }
+
+        // The warm access cost is the static cost of the accessing instructions.
+        const auto table = evmc_get_instruction_descriptor_table(rev);
+        if (rev >= EVMC_BERLIN)
+        {
+            EXPECT_EQ(table[OP_SLOAD].gas_cost, g.warm_access_cost) << rev;
+            EXPECT_EQ(table[OP_BALANCE].gas_cost, g.warm_access_cost) << rev;
+        }
+    }
+
+    // The examples of EIP-2200 and EIP-3529: gas cost - refund of the sequences of SSTOREs.
+    const auto& istanbul = evmc::gas_schedule<EVMC_ISTANBUL>;
+    const auto& london = evmc::gas_schedule<EVMC_LONDON>;
+    const auto net = [](const evmc_gas_schedule& g, std::initializer_list<evmc_storage_status> s) {
+        int64_t n = 0;
+        for (const auto status : s)
+            n += evmc::sstore_cost(g, status).gas_cost - evmc::sstore_cost(g, status).gas_refund;
+        return n;
+    };
+    // 0 -> 1 -> 0
+    EXPECT_EQ(net(istanbul, {EVMC_STORAGE_ADDED, EVMC_STORAGE_ADDED_DELETED}), 1600);
+    // 1 -> 0 -> 1
+    EXPECT_EQ(net(istanbul, {EVMC_STORAGE_DELETED, EVMC_STORAGE_DELETED_RESTORED}), 1600);
+    // 1 -> 2 -> 1
+    EXPECT_EQ(net(istanbul, {EVMC_STORAGE_MODIFIED, EVMC_STORAGE_MODIFIED_RESTORED}), 1600);
+    // 1 -> 0 (warm slot)
+    EXPECT_EQ(net(london, {EVMC_STORAGE_DELETED}), 2900 - 4800);
+    // 1 -> 0 -> 1 (warm slot)
+    EXPECT_EQ(net(london, {EVMC_STORAGE_DELETED, EVMC_STORAGE_DELETED_RESTORED}), 200);
+}
+
+TEST(instructions, memory_and_copy_cost)
+{
+    const auto& g = evmc::gas_schedule<EVMC_SHANGHAI>;
+    EXPECT_EQ(evmc::num_words(0), 0u);
+    EXPECT_EQ(evmc::num_words(1), 1u);
+    EXPECT_EQ(evmc::num_words(32), 1u);
+    EXPECT_EQ(evmc::num_words(33), 2u);
+    EXPECT_EQ(evmc::memory_cost(g, 0), 0);
+    EXPECT_EQ(evmc::memory_cost(g, 32), 32 * 3 + 2);
+    EXPECT_EQ(evmc::memory_cost(g, 1024), 1024 * 3 + 2048);
+    EXPECT_EQ(evmc::memory_expansion_cost(g, 32, 1024), 1024 * 3 + 2048 - 98);
+    EXPECT_EQ(evmc::memory_expansion_cost(g, 1024, 32), 0);
+    EXPECT_EQ(evmc::copy_cost(g, 0), 0);
+    EXPECT_EQ(evmc::copy_cost(g, 33), 6);
+}
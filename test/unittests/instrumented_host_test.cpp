@@ -0,0 +1,162 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include "examples/example_vm/example_vm.h"
+#include <evmc/hex.hpp>
+#include <evmc/instrumented_host.hpp>
+#include <evmc/mocked_host.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace evmc::literals;
+using evmc::HostMethod;
+
+namespace
+{
+constexpr auto addr1 = 0x01_address;
+
+/// The clock advancing by 100 ns with every reading.
+struct StepClock
+{
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<StepClock>;
+    static constexpr bool is_steady = true;
+
+    static inline rep ticks = 0;
+
+    static time_point now() noexcept { return time_point{duration{ticks += 100}}; }
+};
+}  // namespace
+
+TEST(instrumented_host, counts)
+{
+    evmc::MockedHost mocked;
+    mocked.accounts[addr1].storage[0x01_bytes32] = 0x0a_bytes32;
+    evmc::InstrumentedHost host{mocked};
+
+    EXPECT_EQ(host.get_storage(addr1, 0x01_bytes32), 0x0a_bytes32);
+    EXPECT_EQ(host.get_storage(addr1, 0x02_bytes32), evmc::bytes32{});
+    host.set_storage(addr1, 0x01_bytes32, 0x0b_bytes32);
+    host.call(evmc_message{});
+    host.account_exists(addr1);
+
+    // The calls are forwarded.
+    EXPECT_EQ(mocked.accounts[addr1].storage[0x01_bytes32].current, 0x0b_bytes32);
+    EXPECT_EQ(mocked.recorded_calls.size(), 1u);
+
+    const auto stats = host.stats();
+    EXPECT_EQ(stats[size_t(HostMethod::get_storage)].count, 2u);
+    EXPECT_EQ(stats[size_t(HostMethod::get_storage)].sampled, 2u);
+    EXPECT_EQ(stats[size_t(HostMethod::set_storage)].count, 1u);
+    EXPECT_EQ(stats[size_t(HostMethod::call)].count, 1u);
+    EXPECT_EQ(stats[size_t(HostMethod::account_exists)].count, 1u);
+    EXPECT_EQ(stats[size_t(HostMethod::get_balance)].count, 0u);
+    EXPECT_EQ(host.stats(HostMethod::get_storage).count, 2u);
+
+    host.reset();
+    EXPECT_EQ(host.stats(HostMethod::get_storage).count, 0u);
+    EXPECT_EQ(host.stats(HostMethod::get_storage).sampled, 0u);
+}
+
+TEST(instrumented_host, latency)
+{
+    evmc::MockedHost mocked;
+    evmc::BasicInstrumentedHost<StepClock> host{mocked};
+
+    for (int i = 0; i < 10; ++i)
+        host.get_tx_context();
+
+    const auto s = host.stats(HostMethod::get_tx_context);
+    EXPECT_EQ(s.count, 10u);
+    EXPECT_EQ(s.sampled, 10u);
+    EXPECT_EQ(s.total_ns, 1000u);
+    EXPECT_EQ(s.max_ns, 100u);
+    EXPECT_EQ(s.mean_ns(), 100.0);
+    EXPECT_EQ(s.estimated_total_ns(), 1000.0);
+    EXPECT_EQ(s.histogram[6], 10u);  // [64, 128)
+    EXPECT_GE(s.percentile_ns(0.5), 64.0);
+    EXPECT_LE(s.percentile_ns(0.5), 100.0);
+    EXPECT_EQ(s.percentile_ns(1.0), 100.0);
+
+    const auto empty = host.stats(HostMethod::get_block_hash);
+    EXPECT_EQ(empty.mean_ns(), 0.0);
+    EXPECT_EQ(empty.percentile_ns(0.99), 0.0);
+}
+
+TEST(instrumented_host, sampling)
+{
+    evmc::MockedHost mocked;
+    evmc::BasicInstrumentedHost<StepClock> host{mocked, 3};
+    EXPECT_EQ(host.sample_period(), 4u);
+
+    for (int i = 0; i < 10; ++i)
+        host.get_tx_context();
+
+    const auto s = host.stats(HostMethod::get_tx_context);
+    EXPECT_EQ(s.count, 10u);
+    EXPECT_EQ(s.sampled, 3u);
+    EXPECT_EQ(s.total_ns, 300u);
+    EXPECT_EQ(s.estimated_total_ns(), 1000.0);
+
+    EXPECT_EQ(evmc::InstrumentedHost(mocked, 0).sample_period(), 1u);
+    EXPECT_EQ(evmc::InstrumentedHost(mocked, 1).sample_period(), 1u);
+    EXPECT_EQ(evmc::InstrumentedHost(mocked, 64).sample_period(), 64u);
+}
+
+TEST(instrumented_host, threads)
+{
+    evmc::MockedHost mocked;
+    evmc::InstrumentedHost host{mocked};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&host] {
+            for (int i = 0; i < 1000; ++i)
+                host.get_tx_context();
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    const auto s = host.stats(HostMethod::get_tx_context);
+    EXPECT_EQ(s.count, 4000u);
+    EXPECT_EQ(s.sampled, 4000u);
+    uint64_t histogram_total = 0;
+    for (const auto n : s.histogram)
+        histogram_total += n;
+    EXPECT_EQ(histogram_total, 4000u);
+}
+
+TEST(instrumented_host, execution)
+{
+    // Stores the value from the calldata[0:32] at the key 1 and returns the value at the key 2.
+    const auto code = *evmc::from_hex("60003560015560025460005260206000f3");
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    evmc::MockedHost mocked;
+    evmc::InstrumentedHost host{mocked};
+
+    const evmc::bytes input(32, 0x11);
+    evmc_message msg{};
+    msg.gas = 100000;
+    msg.recipient = addr1;
+    msg.input_data = input.data();
+    msg.input_size = input.size();
+    const auto r = vm.execute(host, EVMC_CANCUN, msg, code.data(), code.size());
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+
+    EXPECT_EQ(host.stats(HostMethod::set_storage).count, 1u);
+    EXPECT_EQ(host.stats(HostMethod::get_storage).count, 1u);
+}
+
+TEST(instrumented_host, method_names)
+{
+    EXPECT_STREQ(evmc::to_string(HostMethod::account_exists), "account_exists");
+    EXPECT_STREQ(evmc::to_string(HostMethod::call), "call");
+    EXPECT_STREQ(evmc::to_string(HostMethod::set_transient_storage), "set_transient_storage");
+    EXPECT_STREQ(evmc::to_string(HostMethod::allocate_output), "allocate_output");
+}
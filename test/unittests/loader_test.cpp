@@ -45,6 +45,7 @@ protected:
         destroy_count = 0;
         supported_options.clear();
         recorded_options.clear();
+        evmc_loader_clear_cache();
     }
 
     static void setup(const char* path, const char* symbol, evmc_create_fn fn) noexcept
@@ -83,8 +84,8 @@ protected:
     /// Creates a VM mock with only destroy() method.
     static evmc_vm* create_vm_barebone()
     {
-        static auto instance =
-            evmc_vm{EVMC_ABI_VERSION, "vm_barebone", "", destroy, nullptr, nullptr, nullptr};
+        static auto instance = evmc_vm{EVMC_ABI_VERSION, "vm_barebone", "", destroy, nullptr,
+                                       nullptr,          nullptr,       nullptr, nullptr};
         ++create_count;
         return &instance;
     }
@@ -94,8 +95,8 @@ protected:
     {
         constexpr auto wrong_abi_version = 1985;
         static_assert(wrong_abi_version != EVMC_ABI_VERSION);
-        static auto instance =
-            evmc_vm{wrong_abi_version, "", "", destroy, nullptr, nullptr, nullptr};
+        static auto instance = evmc_vm{
+            wrong_abi_version, "", "", destroy, nullptr, nullptr, nullptr, nullptr, nullptr};
         ++create_count;
         return &instance;
     }
@@ -103,8 +104,9 @@ protected:
     /// Creates a VM mock with optional set_option() method.
     static evmc_vm* create_vm_with_set_option() noexcept
     {
-        static auto instance = evmc_vm{
-            EVMC_ABI_VERSION, "vm_with_set_option", "", destroy, nullptr, nullptr, set_option};
+        static auto instance =
+            evmc_vm{EVMC_ABI_VERSION, "vm_with_set_option", "", destroy, nullptr, nullptr,
+                    set_option,       nullptr,              nullptr};
         ++create_count;
         return &instance;
     }
@@ -665,3 +667,146 @@ TEST_F(loader, load_and_configure_unknown_set_option_error_code)
                   option_name_causing_unknown_error + "'");
     EXPECT_EQ(destroy_count, create_count);
 }
+
+TEST_F(loader, load_cached)
+{
+    setup("path", "evmc_create", create_vm_barebone);
+    evmc_loader_error_code ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load("path", &ec), create_vm_barebone);
+    EXPECT_EQ(ec, EVMC_LOADER_SUCCESS);
+
+    // The module is not opened again.
+    setup(nullptr, nullptr, nullptr);
+    ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load("path", &ec), create_vm_barebone);
+    EXPECT_EQ(ec, EVMC_LOADER_SUCCESS);
+    EXPECT_FALSE(evmc_last_error_msg());
+
+    // Only the successfully loaded modules are cached.
+    ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load("other", &ec), nullptr);
+    EXPECT_EQ(ec, EVMC_LOADER_CANNOT_OPEN);
+    setup("other", "evmc_create", create_vm_with_set_option);
+    EXPECT_EQ(evmc_load("other", nullptr), create_vm_with_set_option);
+
+    evmc_loader_clear_cache();
+    setup(nullptr, nullptr, nullptr);
+    ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load("path", &ec), nullptr);
+    EXPECT_EQ(ec, EVMC_LOADER_CANNOT_OPEN);
+    EXPECT_STREQ(evmc_last_error_msg(), "cannot load library");
+}
+
+TEST_F(loader, load_cached_many)
+{
+    // Load more modules than the cache capacity.
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto path = "path" + std::to_string(i);
+        setup(path.c_str(), "evmc_create", create_vm_barebone);
+        EXPECT_EQ(evmc_load(path.c_str(), nullptr), create_vm_barebone);
+    }
+    setup(nullptr, nullptr, nullptr);
+    EXPECT_EQ(evmc_load("path99", nullptr), create_vm_barebone);
+    EXPECT_EQ(evmc_load("path0", nullptr), nullptr);
+}
+
+TEST_F(loader, load_and_configure_pool)
+{
+    supported_options["o"] = {"1"};
+    setup("path", "evmc_create", create_vm_with_set_option);
+
+    evmc_vm* vms[3]{};
+    evmc_loader_error_code ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load_and_configure_pool("path,o=1,o", vms, 3, &ec), 0u);
+    EXPECT_EQ(ec, EVMC_LOADER_INVALID_OPTION_VALUE);
+    EXPECT_STREQ(evmc_last_error_msg(),
+                 "vm_with_set_option (path): unsupported value '' for option 'o'");
+    EXPECT_EQ(create_count, 1);
+    EXPECT_EQ(destroy_count, 1);
+    EXPECT_EQ(vms[0], nullptr);
+
+    supported_options["o"] = {"1", ""};
+    recorded_options.clear();
+    ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load_and_configure_pool("path,o=1,o", vms, 3, &ec), 3u);
+    EXPECT_EQ(ec, EVMC_LOADER_SUCCESS);
+    EXPECT_FALSE(evmc_last_error_msg());
+    EXPECT_EQ(create_count, 4);
+    EXPECT_EQ(destroy_count, 1);
+    ASSERT_EQ(recorded_options.size(), 6u);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(vms[i], create_vm_with_set_option());
+        EXPECT_EQ(recorded_options[2 * i].first, "o");
+        EXPECT_EQ(recorded_options[2 * i].second, "1");
+        EXPECT_EQ(recorded_options[2 * i + 1].first, "o");
+        EXPECT_EQ(recorded_options[2 * i + 1].second, "");
+    }
+
+    setup(nullptr, nullptr, nullptr);
+    EXPECT_EQ(evmc_load_and_configure_pool("other", vms, 3, &ec), 0u);
+    EXPECT_EQ(ec, EVMC_LOADER_CANNOT_OPEN);
+}
+
+TEST_F(loader, registered_vm)
+{
+    setup(nullptr, nullptr, nullptr);
+    EXPECT_EQ(evmc_register_vm("static_vm", create_vm_barebone), EVMC_LOADER_SUCCESS);
+
+    // The registered VM is resolved without loading any DLL.
+    evmc_loader_error_code ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load("static_vm", &ec), create_vm_barebone);
+    EXPECT_EQ(ec, EVMC_LOADER_SUCCESS);
+
+    // Registering again replaces the create function.
+    supported_options["o"] = {"2"};
+    EXPECT_EQ(evmc_register_vm("static_vm", create_vm_with_set_option), EVMC_LOADER_SUCCESS);
+    ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    auto vm = evmc_load_and_configure("static_vm,o=2", &ec);
+    EXPECT_EQ(ec, EVMC_LOADER_SUCCESS);
+    EXPECT_EQ(vm, create_vm_with_set_option());
+    ASSERT_EQ(recorded_options.size(), 1u);
+    EXPECT_EQ(recorded_options[0].first, "o");
+    EXPECT_EQ(recorded_options[0].second, "2");
+
+    // The registry is not affected by clearing the cache.
+    evmc_loader_clear_cache();
+    EXPECT_EQ(evmc_load("static_vm", nullptr), create_vm_with_set_option);
+
+    evmc_unregister_vm("static_vm");
+    evmc_unregister_vm("static_vm");
+    evmc_unregister_vm(nullptr);
+    ec = EVMC_LOADER_UNSPECIFIED_ERROR;
+    EXPECT_EQ(evmc_load("static_vm", &ec), nullptr);
+    EXPECT_EQ(ec, EVMC_LOADER_CANNOT_OPEN);
+}
+
+TEST_F(loader, register_vm_invalid_argument)
+{
+    EXPECT_EQ(evmc_register_vm(nullptr, create_vm_barebone), EVMC_LOADER_INVALID_ARGUMENT);
+    EXPECT_STREQ(evmc_last_error_msg(),
+                 "invalid argument: VM name and create function cannot be null or empty");
+    EXPECT_EQ(evmc_register_vm("", create_vm_barebone), EVMC_LOADER_INVALID_ARGUMENT);
+    EXPECT_EQ(evmc_register_vm("vm", nullptr), EVMC_LOADER_INVALID_ARGUMENT);
+}
+
+TEST_F(loader, register_vm_too_many)
+{
+    std::vector<std::string> names;
+    evmc_loader_error_code ec = EVMC_LOADER_SUCCESS;
+    while (ec == EVMC_LOADER_SUCCESS)
+    {
+        names.push_back("vm" + std::to_string(names.size()));
+        ec = evmc_register_vm(names.back().c_str(), create_vm_barebone);
+    }
+    EXPECT_EQ(ec, EVMC_LOADER_INVALID_ARGUMENT);
+    EXPECT_EQ(names.size(), 33u);
+    EXPECT_STREQ(evmc_last_error_msg(),
+                 "cannot register vm32: too many VMs registered (maximum is 32)");
+
+    for (const auto& name : names)
+        evmc_unregister_vm(name.c_str());
+    EXPECT_EQ(evmc_register_vm("vm", create_vm_barebone), EVMC_LOADER_SUCCESS);
+    evmc_unregister_vm("vm");
+}
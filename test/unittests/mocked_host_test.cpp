@@ -151,3 +151,247 @@ TEST(mocked_host, transient_storage)
     // Get non-existing key of existing account.
     EXPECT_EQ(host.get_transient_storage(0xa1_address, 0xc2_bytes32), 0x00_bytes32);
 }
+
+TEST(mocked_host, storage_batch)
+{
+    evmc::MockedHost host;
+    host.accounts[0xa1_address].storage[0xc1_bytes32].current = 0x01_bytes32;
+    host.accounts[0xa1_address].storage[0xc2_bytes32].current = 0x02_bytes32;
+    host.accounts[0xa2_address].storage[0xc1_bytes32].current = 0x03_bytes32;
+
+    const evmc_storage_key keys[] = {
+        {0xa1_address, 0xc2_bytes32},
+        {0xa2_address, 0xc1_bytes32},
+        {0xa3_address, 0xc1_bytes32},  // Non-existing account.
+        {0xa1_address, 0xc3_bytes32},  // Non-existing key.
+        {0xa1_address, 0xc1_bytes32},
+    };
+    evmc::bytes32 values[std::size(keys)];
+    host.get_storage_batch(keys, values, std::size(keys));
+
+    EXPECT_EQ(values[0], 0x02_bytes32);
+    EXPECT_EQ(values[1], 0x03_bytes32);
+    EXPECT_EQ(values[2], 0x00_bytes32);
+    EXPECT_EQ(values[3], 0x00_bytes32);
+    EXPECT_EQ(values[4], 0x01_bytes32);
+
+    // Each entry is recorded as an individual account access.
+    ASSERT_EQ(host.recorded_account_accesses.size(), std::size(keys));
+    EXPECT_EQ(host.recorded_account_accesses[2], 0xa3_address);
+}
+
+TEST(mocked_host, code_view)
+{
+    evmc::MockedHost host;
+    auto& acc = host.accounts[0xa1_address];
+    acc.code = {0x60, 0x00, 0x00};
+    acc.codehash = 0xc0de_bytes32;
+
+    evmc_code_view view{};
+    ASSERT_TRUE(host.get_code_view(0xa1_address, view));
+    EXPECT_EQ(view.code, acc.code.data());
+    EXPECT_EQ(view.code_size, 3u);
+    EXPECT_EQ(view.code_hash, 0xc0de_bytes32);
+
+    // Non-existing account.
+    ASSERT_TRUE(host.get_code_view(0xa2_address, view));
+    EXPECT_EQ(view.code_size, 0u);
+    EXPECT_EQ(view.code_hash, evmc::bytes32{});
+
+    ASSERT_EQ(host.recorded_account_accesses.size(), 2u);
+    EXPECT_EQ(host.recorded_account_accesses[1], 0xa2_address);
+}
+
+TEST(mocked_host, access_account_beyond_record_limit)
+{
+    constexpr auto n = evmc::MockedHost::max_recorded_account_accesses * 2;
+
+    evmc::MockedHost host;
+    for (uint64_t i = 0; i < n; ++i)
+        EXPECT_EQ(host.access_account(evmc::address{0x1000 + i}), EVMC_ACCESS_COLD);
+    EXPECT_EQ(host.recorded_account_accesses.size(),
+              size_t{evmc::MockedHost::max_recorded_account_accesses});
+    EXPECT_EQ(host.accessed_accounts.size(), size_t{n});
+
+    for (uint64_t i = 0; i < n; ++i)
+        EXPECT_EQ(host.access_account(evmc::address{0x1000 + i}), EVMC_ACCESS_WARM);
+
+    // Any other account access makes the account warm.
+    host.get_balance(0xa1_address);
+    EXPECT_EQ(host.access_account(0xa1_address), EVMC_ACCESS_WARM);
+}
+
+TEST(mocked_host, snapshot_revert)
+{
+    evmc::MockedHost host;
+    host.accounts[0xa1_address].storage[0xc1_bytes32] = 0x01_bytes32;
+    host.accounts[0xa1_address].transient_storage[0xc1_bytes32] = 0x01_bytes32;
+    host.accounts[0xa1_address].set_balance(1);
+
+    const auto s0 = host.snapshot();
+    EXPECT_EQ(host.set_storage(0xa1_address, 0xc1_bytes32, 0x02_bytes32), EVMC_STORAGE_MODIFIED);
+    EXPECT_EQ(host.set_storage(0xa1_address, 0xc2_bytes32, 0x02_bytes32), EVMC_STORAGE_ADDED);
+    EXPECT_EQ(host.access_storage(0xa1_address, 0xc1_bytes32), EVMC_ACCESS_COLD);
+    host.set_transient_storage(0xa1_address, 0xc1_bytes32, 0x02_bytes32);
+    host.set_transient_storage(0xa2_address, 0xc1_bytes32, 0x02_bytes32);
+    host.set_balance(0xa1_address, 0x02_bytes32);
+    host.set_code(0xa3_address, {0x00}, 0xc0de_bytes32);
+    host.selfdestruct(0xa1_address, 0xbe_address);
+    host.emit_log(0xa1_address, nullptr, 0, nullptr, 0);
+    host.call({});
+    host.get_block_hash(1);
+    EXPECT_EQ(host.access_account(0xa4_address), EVMC_ACCESS_COLD);
+
+    const auto s1 = host.snapshot();
+    EXPECT_EQ(s1, s0 + 1);
+    host.set_storage(0xa1_address, 0xc1_bytes32, 0x03_bytes32);
+    host.set_storage(0xa5_address, 0xc1_bytes32, 0x03_bytes32);
+
+    host.revert(s1);
+    EXPECT_EQ(host.accounts[0xa1_address].storage[0xc1_bytes32].current, 0x02_bytes32);
+    EXPECT_EQ(host.accounts.count(0xa5_address), 0u);
+    EXPECT_EQ(host.accounts.count(0xa3_address), 1u);
+    EXPECT_EQ(host.recorded_logs.size(), 1u);
+
+    host.revert(s0);
+    ASSERT_EQ(host.accounts.size(), 1u);
+    const auto& acc = host.accounts[0xa1_address];
+    ASSERT_EQ(acc.storage.size(), 1u);
+    EXPECT_EQ(acc.storage.at(0xc1_bytes32).current, 0x01_bytes32);
+    EXPECT_EQ(acc.storage.at(0xc1_bytes32).access_status, EVMC_ACCESS_COLD);
+    ASSERT_EQ(acc.transient_storage.size(), 1u);
+    EXPECT_EQ(acc.transient_storage.at(0xc1_bytes32), 0x01_bytes32);
+    EXPECT_EQ(acc.balance, 0x01_bytes32);
+    EXPECT_TRUE(host.recorded_selfdestructs.empty());
+    EXPECT_TRUE(host.recorded_logs.empty());
+    EXPECT_TRUE(host.recorded_calls.empty());
+    EXPECT_TRUE(host.recorded_blockhashes.empty());
+    EXPECT_TRUE(host.recorded_account_accesses.empty());
+    EXPECT_TRUE(host.accessed_accounts.empty());
+    EXPECT_EQ(host.access_account(0xa4_address), EVMC_ACCESS_COLD);
+
+    // The reverted snapshot stays active.
+    host.set_storage(0xa1_address, 0xc1_bytes32, 0x04_bytes32);
+    host.revert(s0);
+    EXPECT_EQ(host.accounts[0xa1_address].storage[0xc1_bytes32].current, 0x01_bytes32);
+
+    // Without snapshots the modifications are not journaled and are kept.
+    host.discard_snapshots();
+    host.set_storage(0xa1_address, 0xc1_bytes32, 0x05_bytes32);
+    const auto s2 = host.snapshot();
+    EXPECT_EQ(s2, 0u);
+    host.revert(s2);
+    EXPECT_EQ(host.accounts[0xa1_address].storage[0xc1_bytes32].current, 0x05_bytes32);
+}
+
+TEST(mocked_host, output_arena)
+{
+    evmc::Arena arena;
+    auto* const a = arena.allocate(10);
+    auto* const b = arena.allocate(20);
+    EXPECT_EQ(b, a + 10);
+    auto* const big = arena.allocate(10000);
+    EXPECT_NE(big, nullptr);
+    auto* const c = arena.allocate(5);
+    EXPECT_NE(c, b + 20);  // Skips the big chunk, already full.
+
+    arena.reset();
+    EXPECT_EQ(arena.allocate(10), a);
+
+    evmc::MockedHost host;
+    EXPECT_EQ(host.allocate_output(1), nullptr);
+    host.output_arena_enabled = true;
+    auto* const out = host.allocate_output(1);
+    EXPECT_NE(out, nullptr);
+    host.output_arena.reset();
+    EXPECT_EQ(host.allocate_output(1), out);
+}
+
+TEST(mocked_host, get_tx_initcode)
+{
+    const evmc_tx_initcode initcodes[] = {{0x01_bytes32, nullptr, 1}, {0x02_bytes32, nullptr, 2}};
+
+    evmc::MockedHost host;
+    EXPECT_EQ(host.get_tx_initcode(0x01_bytes32), nullptr);
+
+    // The index is rebuilt when the initcodes are replaced.
+    host.tx_context.initcodes = initcodes;
+    host.tx_context.initcodes_count = 1;
+    EXPECT_EQ(host.get_tx_initcode(0x01_bytes32), &initcodes[0]);
+    EXPECT_EQ(host.get_tx_initcode(0x02_bytes32), nullptr);
+    host.tx_context.initcodes_count = 2;
+    EXPECT_EQ(host.get_tx_initcode(0x02_bytes32), &initcodes[1]);
+    host.tx_context = {};
+    EXPECT_EQ(host.get_tx_initcode(0x02_bytes32), nullptr);
+}
+
+TEST(mocked_host, record_arena)
+{
+    evmc::MockedHost host;
+    const uint8_t data[] = {0x01, 0x02, 0x03};
+    const evmc::bytes32 topics[] = {0xaa_bytes32, 0xbb_bytes32};
+
+    // The log data and topics are copied to the arena.
+    host.emit_log(0xa1_address, data, std::size(data), topics, std::size(topics));
+    host.emit_log(0xa2_address, nullptr, 0, nullptr, 0);
+    ASSERT_EQ(host.recorded_logs.size(), 2u);
+    const auto& log = host.recorded_logs[0];
+    EXPECT_EQ(log.creator, 0xa1_address);
+    EXPECT_EQ(log.data, evmc::bytes_view(data, std::size(data)));
+    EXPECT_NE(log.data.data(), data);
+    ASSERT_EQ(log.topics.size(), 2u);
+    EXPECT_EQ(log.topics[1], 0xbb_bytes32);
+    EXPECT_NE(log.topics.data(), topics);
+    EXPECT_TRUE(host.recorded_logs[1].data.empty());
+    EXPECT_TRUE(host.recorded_logs[1].topics.empty());
+    EXPECT_FALSE(log == host.recorded_logs[1]);
+    EXPECT_TRUE(log == host.recorded_logs[0]);
+
+    // The call inputs are copied to the arena.
+    evmc_message msg{};
+    msg.input_data = data;
+    msg.input_size = std::size(data);
+    host.call(msg);
+    ASSERT_EQ(host.recorded_calls.size(), 1u);
+    EXPECT_NE(host.recorded_calls[0].input_data, data);
+    const auto& call_msg = host.recorded_calls[0];
+    EXPECT_EQ(evmc::bytes_view(call_msg.input_data, call_msg.input_size),
+              evmc::bytes_view(data, std::size(data)));
+
+    // The copy has the records in its own arena.
+    const auto copy = host;
+    ASSERT_EQ(copy.recorded_logs.size(), 2u);
+    EXPECT_EQ(copy.recorded_logs[0], log);
+    EXPECT_NE(copy.recorded_logs[0].data.data(), log.data.data());
+    ASSERT_EQ(copy.recorded_calls.size(), 1u);
+    EXPECT_NE(copy.recorded_calls[0].input_data, call_msg.input_data);
+
+    // The memory is reused after clearing the records.
+    const auto* const log_data = log.data.data();
+    host.clear_records();
+    EXPECT_TRUE(host.recorded_logs.empty());
+    EXPECT_TRUE(host.recorded_calls.empty());
+    host.emit_log(0xa1_address, data, std::size(data), nullptr, 0);
+    EXPECT_EQ(host.recorded_logs[0].data.data(), log_data);
+}
+
+TEST(mocked_host, recorded_calls_limit)
+{
+    evmc::MockedHost host;
+    host.recorded_calls_limit = 2;
+    for (int i = 0; i < 3; ++i)
+        host.call({});
+    EXPECT_EQ(host.recorded_calls.size(), 2u);
+
+    host.clear_records();
+    host.recorded_calls_limit = SIZE_MAX;
+    for (int i = 0; i < 300; ++i)
+        host.call({});
+    EXPECT_EQ(host.recorded_calls.size(), 300u);
+    EXPECT_EQ(host.recorded_account_accesses.size(), 200u);
+
+    host.clear_records();
+    host.recorded_account_accesses_limit = 0;
+    host.call({});
+    EXPECT_TRUE(host.recorded_account_accesses.empty());
+}
@@ -0,0 +1,177 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include "examples/example_vm/example_vm.h"
+#include <evmc/hex.hpp>
+#include <evmc/parallel.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace evmc::literals;
+using evmc::bytes;
+using evmc::bytes32;
+using evmc::parallel::Executor;
+using evmc::parallel::Transaction;
+
+namespace
+{
+constexpr auto contract = 0xc0de_address;
+
+/// Increments the storage value at the key from the calldata[0:32]
+/// by the amount from the calldata[32:64].
+const auto increment_code = *evmc::from_hex("60203560003554016000355500");
+
+class parallel_executor : public testing::Test
+{
+protected:
+    evmc::VM vm{evmc_create_example_vm()};
+    evmc::MockedHost state;
+
+    /// The inputs of the transactions, must outlive the execution.
+    std::vector<bytes> inputs;
+
+    std::vector<Transaction> make_block(const std::vector<std::pair<uint8_t, uint8_t>>& increments)
+    {
+        std::vector<Transaction> txs;
+        inputs.resize(increments.size());
+        for (size_t i = 0; i < increments.size(); ++i)
+        {
+            inputs[i] = bytes(64, 0);
+            inputs[i][31] = increments[i].first;
+            inputs[i][63] = increments[i].second;
+
+            Transaction tx;
+            tx.msg.gas = 1'000'000;
+            tx.msg.recipient = contract;
+            tx.msg.input_data = inputs[i].data();
+            tx.msg.input_size = inputs[i].size();
+            tx.code = increment_code;
+            txs.push_back(tx);
+        }
+        return txs;
+    }
+
+    /// Executes the transactions sequentially on the copy of the state.
+    evmc::MockedHost execute_sequentially(const std::vector<Transaction>& txs)
+    {
+        auto host = state;
+        for (const auto& tx : txs)
+        {
+            const auto r = vm.execute(host, EVMC_CANCUN, tx.msg, tx.code.data(), tx.code.size());
+            EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+            for (auto& [key, value] : host.accounts[contract].storage)
+                value.original = value.current;
+        }
+        return host;
+    }
+
+    void expect_same_storage(const evmc::MockedHost& expected)
+    {
+        const auto& expected_storage = expected.accounts.at(contract).storage;
+        const auto& storage = state.accounts.at(contract).storage;
+        EXPECT_EQ(storage.size(), expected_storage.size());
+        for (const auto& [key, value] : expected_storage)
+        {
+            ASSERT_EQ(storage.count(key), 1u) << evmc::hex(key);
+            EXPECT_EQ(storage.at(key).current, value.current) << evmc::hex(key);
+        }
+    }
+};
+}  // namespace
+
+TEST_F(parallel_executor, independent_transactions)
+{
+    std::vector<std::pair<uint8_t, uint8_t>> increments;
+    for (uint8_t i = 1; i <= 64; ++i)
+        increments.emplace_back(i, i);
+    const auto txs = make_block(increments);
+    const auto expected = execute_sequentially(txs);
+
+    const auto results = Executor{vm, 4}.execute(state, EVMC_CANCUN, txs);
+    ASSERT_EQ(results.size(), txs.size());
+    for (const auto& r : results)
+    {
+        EXPECT_EQ(r.result.status_code, EVMC_SUCCESS);
+        EXPECT_EQ(r.incarnations, 1u);
+    }
+    expect_same_storage(expected);
+}
+
+TEST_F(parallel_executor, conflicting_transactions)
+{
+    state.accounts[contract].storage[0x01_bytes32] = 0x64_bytes32;
+
+    std::vector<std::pair<uint8_t, uint8_t>> increments;
+    for (uint8_t i = 0; i < 100; ++i)
+    {
+        increments.emplace_back(static_cast<uint8_t>(i % 3 == 0 ? 1 : 2 + i % 7),
+                                static_cast<uint8_t>(1 + i % 5));
+    }
+    const auto txs = make_block(increments);
+    const auto expected = execute_sequentially(txs);
+
+    const auto results = Executor{vm, 8}.execute(state, EVMC_CANCUN, txs);
+    ASSERT_EQ(results.size(), txs.size());
+    for (const auto& r : results)
+    {
+        EXPECT_EQ(r.result.status_code, EVMC_SUCCESS);
+        EXPECT_GE(r.incarnations, 1u);
+    }
+    expect_same_storage(expected);
+    EXPECT_EQ(state.accounts[contract].storage[0x01_bytes32].original,
+              expected.accounts.at(contract).storage.at(0x01_bytes32).current);
+}
+
+TEST_F(parallel_executor, single_thread)
+{
+    const auto txs = make_block({{1, 1}, {1, 2}, {2, 3}, {1, 4}});
+    const auto expected = execute_sequentially(txs);
+
+    const auto results = Executor{vm, 1}.execute(state, EVMC_CANCUN, txs);
+    ASSERT_EQ(results.size(), txs.size());
+    for (const auto& r : results)
+        EXPECT_EQ(r.incarnations, 1u);
+    expect_same_storage(expected);
+    EXPECT_EQ(state.accounts[contract].storage[0x01_bytes32].current, 0x07_bytes32);
+}
+
+TEST_F(parallel_executor, empty_block)
+{
+    const auto results = Executor{vm}.execute(state, EVMC_CANCUN, {});
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(state.accounts.empty());
+}
+
+TEST(parallel, transaction_result_copy)
+{
+    const bytes data{0x01, 0x02, 0x03};
+    const bytes32 topic = 0xab_bytes32;
+    const bytes output(32, 0xee);
+
+    auto source = std::make_unique<evmc::parallel::TransactionResult>();
+    source->result = evmc::Result{EVMC_REVERT, 10, 1, output.data(), output.size()};
+    source->logs.push_back({contract,
+                            {source->log_arena.copy(data.data(), data.size()), data.size()},
+                            {source->log_arena.copy(&topic, 1), 1}});
+    source->incarnations = 2;
+
+    auto copy = *source;
+    evmc::parallel::TransactionResult assigned;
+    assigned = *source;
+    source.reset();
+
+    for (const auto* r : {&copy, &assigned})
+    {
+        EXPECT_EQ(r->result.status_code, EVMC_REVERT);
+        EXPECT_EQ(r->result.gas_left, 10);
+        EXPECT_EQ(r->result.gas_refund, 1);
+        EXPECT_EQ(bytes(r->result.output_data, r->result.output_size), output);
+        ASSERT_EQ(r->logs.size(), 1u);
+        EXPECT_EQ(r->logs[0].creator, contract);
+        EXPECT_EQ(bytes(r->logs[0].data), data);
+        ASSERT_EQ(r->logs[0].topics.size(), 1u);
+        EXPECT_EQ(r->logs[0].topics[0], topic);
+        EXPECT_EQ(r->incarnations, 2u);
+    }
+}
@@ -0,0 +1,143 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include "examples/example_vm/example_vm.h"
+#include <evmc/hex.hpp>
+#include <evmc/mocked_host.hpp>
+#include <evmc/recording_host.hpp>
+#include <gtest/gtest.h>
+
+using namespace evmc::literals;
+using evmc::address;
+using evmc::bytes32;
+using evmc::StorageSlot;
+
+namespace
+{
+constexpr auto addr1 = 0x01_address;
+constexpr auto addr2 = 0x02_address;
+constexpr auto addr3 = 0x03_address;
+}  // namespace
+
+TEST(recording_host, sorted_and_deduplicated)
+{
+    evmc::MockedHost mocked;
+    evmc::RecordingHost host{mocked};
+
+    host.get_storage(addr2, 0x02_bytes32);
+    host.get_storage(addr1, 0x03_bytes32);
+    host.get_storage(addr2, 0x01_bytes32);
+    host.get_storage(addr2, 0x02_bytes32);
+    host.access_storage(addr1, 0x03_bytes32);
+    host.set_storage(addr2, 0x02_bytes32, 0x05_bytes32);
+    host.get_balance(addr3);
+    host.get_balance(addr3);
+    host.get_code_hash(addr3);
+    host.get_code_size(addr1);
+    host.account_exists(addr3);
+
+    EXPECT_EQ(host.accounts(), (std::vector<address>{addr1, addr2, addr3}));
+    EXPECT_EQ(host.balance_reads(), std::vector<address>{addr3});
+    EXPECT_TRUE(host.balance_writes().empty());
+    EXPECT_EQ(host.code_reads(), (std::vector<address>{addr1, addr3}));
+    EXPECT_EQ(host.storage_reads(),
+              (std::vector<StorageSlot>{
+                  {addr1, 0x03_bytes32}, {addr2, 0x01_bytes32}, {addr2, 0x02_bytes32}}));
+    EXPECT_EQ(host.storage_writes(), (std::vector<StorageSlot>{{addr2, 0x02_bytes32}}));
+
+    // The calls are forwarded.
+    EXPECT_EQ(mocked.accounts[addr2].storage[0x02_bytes32].current, 0x05_bytes32);
+
+    host.clear();
+    EXPECT_TRUE(host.accounts().empty());
+    EXPECT_TRUE(host.balance_reads().empty());
+    EXPECT_TRUE(host.code_reads().empty());
+    EXPECT_TRUE(host.storage_reads().empty());
+    EXPECT_TRUE(host.storage_writes().empty());
+}
+
+TEST(recording_host, balance_writes)
+{
+    evmc::MockedHost mocked;
+    evmc::RecordingHost host{mocked};
+
+    evmc_message msg{};
+    msg.recipient = addr2;
+    msg.sender = addr1;
+    host.call(msg);
+    EXPECT_TRUE(host.balance_writes().empty());
+
+    msg.value = 0x01_bytes32;
+    host.call(msg);
+    host.selfdestruct(addr3, addr1);
+    EXPECT_EQ(host.balance_writes(), (std::vector<address>{addr1, addr2, addr3}));
+    EXPECT_EQ(host.accounts(), (std::vector<address>{addr1, addr2, addr3}));
+    ASSERT_EQ(mocked.recorded_calls.size(), 2u);
+}
+
+TEST(recording_host, delegatecall_balance_writes)
+{
+    evmc::MockedHost mocked;
+    evmc::RecordingHost host{mocked};
+
+    // The value of the DELEGATECALL is the apparent value, nothing is transferred.
+    evmc_message msg{};
+    msg.kind = EVMC_DELEGATECALL;
+    msg.recipient = addr1;
+    msg.sender = addr2;
+    msg.code_address = addr3;
+    msg.value = 0x01_bytes32;
+    host.call(msg);
+    EXPECT_TRUE(host.balance_writes().empty());
+    EXPECT_EQ(host.accounts(), (std::vector<address>{addr1, addr3}));
+
+    // The CALLCODE transfers the value.
+    msg.kind = EVMC_CALLCODE;
+    msg.sender = addr1;
+    host.call(msg);
+    EXPECT_EQ(host.balance_writes(), (std::vector<address>{addr1}));
+}
+
+TEST(recording_host, access_list)
+{
+    evmc::MockedHost mocked;
+    evmc::RecordingHost host{mocked};
+
+    host.get_storage(addr2, 0x02_bytes32);
+    host.set_storage(addr2, 0x01_bytes32, 0x01_bytes32);
+    host.access_account(addr1);
+    host.get_balance(addr3);
+    host.set_storage(addr3, 0x07_bytes32, 0x01_bytes32);
+
+    const evmc::AccessList expected{
+        {addr1, {}}, {addr2, {0x01_bytes32, 0x02_bytes32}}, {addr3, {0x07_bytes32}}};
+    EXPECT_EQ(host.access_list(), expected);
+
+    // The excluded accounts are listed only with storage keys.
+    const evmc::AccessList expected_excluded{{addr2, {0x01_bytes32, 0x02_bytes32}},
+                                             {addr3, {0x07_bytes32}}};
+    EXPECT_EQ(host.access_list({addr1, addr3}), expected_excluded);
+}
+
+TEST(recording_host, execution)
+{
+    // Stores the value from the calldata[0:32] at the key 1 and returns the value at the key 2.
+    const auto code = *evmc::from_hex("60003560015560025460005260206000f3");
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    evmc::MockedHost mocked;
+    evmc::RecordingHost host{mocked};
+
+    const evmc::bytes input(32, 0x11);
+    evmc_message msg{};
+    msg.gas = 100000;
+    msg.recipient = addr1;
+    msg.input_data = input.data();
+    msg.input_size = input.size();
+    const auto r = vm.execute(host, EVMC_CANCUN, msg, code.data(), code.size());
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+
+    EXPECT_EQ(host.storage_writes(), (std::vector<StorageSlot>{{addr1, 0x01_bytes32}}));
+    EXPECT_EQ(host.storage_reads(), (std::vector<StorageSlot>{{addr1, 0x02_bytes32}}));
+    EXPECT_EQ(host.access_list(), (evmc::AccessList{{addr1, {0x01_bytes32, 0x02_bytes32}}}));
+}
@@ -0,0 +1,151 @@
+// EVMC: Ethereum Client-VM Connector API.
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include "examples/example_vm/example_vm.h"
+#include <evmc/caching_host.hpp>
+#include <evmc/mocked_host.hpp>
+#include <evmc/seeded_hash.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace evmc::literals;
+using evmc::address;
+using evmc::bytes32;
+using evmc::seeded_hash;
+using evmc::StorageSlot;
+
+static_assert(evmc::wyhash::mix(0, 0xffffffffffffffff) == 0);
+static_assert(evmc::wyhash::mix(0xffffffffffffffff, 0xffffffffffffffff) == 0xffffffffffffffff);
+static_assert(evmc::wyhash::mix(0x100000000, 0x100000000) == 1);
+
+TEST(seeded_hash, seed)
+{
+    EXPECT_EQ(evmc::random_hash_seed(), evmc::random_hash_seed());
+    EXPECT_EQ(seeded_hash<bytes32>{}.seed, evmc::random_hash_seed());
+
+    const auto key = 0xfe_bytes32;
+    EXPECT_EQ(seeded_hash<bytes32>{1}(key), seeded_hash<bytes32>{1}(key));
+    EXPECT_NE(seeded_hash<bytes32>{1}(key), seeded_hash<bytes32>{2}(key));
+    EXPECT_NE(seeded_hash<bytes32>{1}(key), std::hash<bytes32>{}(key));
+
+    const auto addr = 0xfe_address;
+    EXPECT_EQ(seeded_hash<address>{1}(addr), seeded_hash<address>{1}(addr));
+    EXPECT_NE(seeded_hash<address>{1}(addr), seeded_hash<address>{2}(addr));
+
+    const StorageSlot slot{addr, key};
+    EXPECT_EQ(seeded_hash<StorageSlot>{1}(slot), seeded_hash<StorageSlot>{1}(slot));
+    EXPECT_NE(seeded_hash<StorageSlot>{1}(slot), seeded_hash<StorageSlot>{2}(slot));
+    EXPECT_NE(seeded_hash<StorageSlot>{1}(slot), seeded_hash<StorageSlot>{1}({0xff_address, key}));
+}
+
+namespace
+{
+/// Stores the 64-bit word in little-endian order, as loaded by the seeded_hash.
+void store64le(uint8_t* data, uint64_t word) noexcept
+{
+    for (size_t i = 0; i < sizeof(word); ++i)
+        data[i] = static_cast<uint8_t>(word >> (8 * i));
+}
+}  // namespace
+
+TEST(seeded_hash, crafted_keys)
+{
+    // The keys with the words cancelling the wyhash secrets. If the seed were not mixed into
+    // both multiplication operands, the products would be 0 and the hashes of all such keys
+    // would be the same constant for any seed.
+    bytes32 key1;
+    store64le(&key1.bytes[0], evmc::wyhash::secret1);
+    store64le(&key1.bytes[8], 1);
+    store64le(&key1.bytes[16], evmc::wyhash::secret2);
+    store64le(&key1.bytes[24], 2);
+    auto key2 = key1;
+    store64le(&key2.bytes[8], 3);
+    store64le(&key2.bytes[24], 4);
+
+    std::unordered_set<size_t> hashes;
+    for (uint64_t seed = 1; seed <= 8; ++seed)
+    {
+        hashes.insert(seeded_hash<bytes32>{seed}(key1));
+        hashes.insert(seeded_hash<bytes32>{seed}(key2));
+    }
+    EXPECT_EQ(hashes.size(), 16u);
+
+    address addr1;
+    store64le(&addr1.bytes[0], evmc::wyhash::secret1);
+    store64le(&addr1.bytes[8], 1);
+    auto addr2 = addr1;
+    store64le(&addr2.bytes[8], 2);
+
+    hashes.clear();
+    for (uint64_t seed = 1; seed <= 8; ++seed)
+    {
+        hashes.insert(seeded_hash<address>{seed}(addr1));
+        hashes.insert(seeded_hash<address>{seed}(addr2));
+    }
+    EXPECT_EQ(hashes.size(), 16u);
+}
+
+TEST(seeded_hash, distribution)
+{
+    // The keys differing in a single byte at any position spread evenly over the buckets.
+    constexpr size_t num_buckets = 256;
+    std::vector<size_t> buckets(num_buckets);
+    std::unordered_set<size_t> hashes;
+    const seeded_hash<bytes32> hash{0};
+    for (size_t i = 0; i < sizeof(bytes32); ++i)
+    {
+        for (size_t v = 0; v < 256; ++v)
+        {
+            bytes32 key;
+            key.bytes[i] = static_cast<uint8_t>(v);
+            const auto h = hash(key);
+            hashes.insert(h);
+            ++buckets[h % num_buckets];
+        }
+    }
+    EXPECT_EQ(hashes.size(), sizeof(bytes32) * 255 + 1);  // The zero key repeats.
+    const auto [min, max] = std::minmax_element(buckets.begin(), buckets.end());
+    EXPECT_GT(*min, 0u);
+    EXPECT_LT(*max, 3 * sizeof(bytes32));  // On average, a bucket has sizeof(bytes32) keys.
+}
+
+TEST(seeded_hash, containers)
+{
+    std::unordered_map<address, int, seeded_hash<address>> map;
+    map[0x01_address] = 1;
+    map[0x02_address] = 2;
+    EXPECT_EQ(map.at(0x01_address), 1);
+    EXPECT_EQ(map.at(0x02_address), 2);
+
+    evmc::flat_hash_map<bytes32, int, seeded_hash<bytes32>> flat_map;
+    for (int i = 0; i < 100; ++i)
+        flat_map[bytes32{static_cast<uint64_t>(i)}] = i;
+    EXPECT_EQ(flat_map.size(), 100u);
+    EXPECT_EQ(flat_map.at(0x63_bytes32), 99);
+}
+
+TEST(seeded_hash, mocked_host_and_caching_host)
+{
+    // Stores the value from the calldata[0:32] at the key 1 and returns the value at the key 2.
+    const auto code = *evmc::from_hex("60003560015560025460005260206000f3");
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    evmc::BasicMockedHost<seeded_hash> mocked;
+    mocked.accounts[0x01_address].storage[0x02_bytes32] = 0xaa_bytes32;
+    evmc::BasicCachingHost<seeded_hash> host{mocked};
+
+    const auto input = 0xbb_bytes32;
+    evmc_message msg{};
+    msg.gas = 100000;
+    msg.recipient = 0x01_address;
+    msg.input_data = input.bytes;
+    msg.input_size = sizeof(input);
+    const auto r = vm.execute(host, EVMC_CANCUN, msg, code.data(), code.size());
+    EXPECT_EQ(r.status_code, EVMC_SUCCESS);
+    ASSERT_EQ(r.output_size, sizeof(bytes32));
+    EXPECT_EQ(bytes32{r.output_data[31]}, 0xaa_bytes32);
+    EXPECT_EQ(mocked.accounts[0x01_address].storage[0x01_bytes32].current, input);
+    EXPECT_EQ(host.num_cached_storage_values(), 2u);
+}
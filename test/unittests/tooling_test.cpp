@@ -4,11 +4,16 @@
 
 #include "examples/example_vm/example_vm.h"
 #include <evmc/hex.hpp>
+#include <evmc/instructions.h>
 #include <evmc/tooling.hpp>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
 
 using namespace evmc::tooling;
+using namespace std::literals;
 using evmc::from_hex;
 
 namespace
@@ -28,6 +33,29 @@ std::string out_pattern(const char* rev,
         s << "Output:   " << output << "\n";
     return s.str();
 }
+
+/// The temporary directory removed at the end of the test.
+struct TempDir
+{
+    const std::filesystem::path path;
+
+    explicit TempDir(const char* name)
+      : path{std::filesystem::temp_directory_path() / ("evmc-tooling-test-" + std::string{name})}
+    {
+        std::filesystem::remove_all(path);
+        std::filesystem::create_directory(path);
+    }
+
+    ~TempDir() { std::filesystem::remove_all(path); }
+
+    /// Writes the file in the directory and returns its path.
+    std::string write(const char* filename, std::string_view content) const
+    {
+        const auto file_path = (path / filename).string();
+        std::ofstream{file_path, std::ios::binary} << content;
+        return file_path;
+    }
+};
 }  // namespace
 
 TEST(tool_commands, run_empty_code)
@@ -154,8 +182,10 @@ TEST(tool_commands, bench_add)
     EXPECT_NE(o.find("Gas used: 3"), std::string::npos);
 }
 
-TEST(tool_commands, bench_inconsistent_output)
+TEST(tool_commands, bench_storage_state_reset)
 {
+    // The code modifies the storage: sstore(0, add(sload(0), 1)) and returns the original value.
+    // Every benchmark execution must start from the same state so the result is consistent.
     auto vm = evmc::VM{evmc_create_example_vm()};
     std::ostringstream out;
 
@@ -165,11 +195,470 @@ TEST(tool_commands, bench_inconsistent_output)
 
     const auto o = out.str();
     EXPECT_NE(o.find("Executing on Byzantium"), std::string::npos);
-    EXPECT_NE(
-        o.find(
-            "WARNING! Inconsistent execution result likely due to the use of storage (output: 01)"),
-        std::string::npos);
+    EXPECT_EQ(o.find("WARNING! Inconsistent execution result"), std::string::npos);
     EXPECT_NE(o.find("Time:     "), std::string::npos);
     EXPECT_NE(o.find("Result:   success"), std::string::npos);
     EXPECT_NE(o.find("Gas used: 10"), std::string::npos);
+    EXPECT_NE(o.find("Output:   00\n"), std::string::npos);
+}
+
+TEST(tool_commands, bench_stats_text)
+{
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+
+    const auto bench = BenchOptions{0, 10, BenchFormat::text};
+    const auto exit_code = run(vm, EVMC_LONDON, 200, *from_hex("60028001"), {}, false, bench, out);
+    EXPECT_EQ(exit_code, 0);
+
+    const auto o = out.str();
+    EXPECT_NE(o.find("(avg of 10 iterations)\n"), std::string::npos);
+    for (const auto* label :
+         {"Min:      ", "Median:   ", "P90:      ", "P99:      ", "Stddev:   ", "Gas rate: "})
+        EXPECT_NE(o.find(label), std::string::npos) << label;
+    EXPECT_NE(o.find(" gas/s\n"), std::string::npos);
+}
+
+TEST(tool_commands, bench_stats_json)
+{
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+
+    const auto bench = BenchOptions{2, 5, BenchFormat::json};
+    const auto exit_code = run(vm, EVMC_LONDON, 200, *from_hex("60028001"), {}, false, bench, out);
+    EXPECT_EQ(exit_code, 0);
+
+    // The JSON document is the only output.
+    const auto o = out.str();
+    EXPECT_EQ(o.find("{\"iterations\":5,\"warmup\":2,\"gas_used\":3,\"mean_ns\":"), 0u);
+    EXPECT_NE(o.find(",\"p99_ns\":"), std::string::npos);
+    EXPECT_NE(o.find(",\"gas_per_second\":"), std::string::npos);
+    EXPECT_EQ(o.find('\n'), o.size() - 1);
+    EXPECT_EQ(o.substr(o.size() - 2), "}\n");
+}
+
+TEST(tool_commands, bench_stats_csv)
+{
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+
+    const auto bench = BenchOptions{1, 3, BenchFormat::csv};
+    const auto exit_code = run(vm, EVMC_LONDON, 200, *from_hex("60028001"), {}, false, bench, out);
+    EXPECT_EQ(exit_code, 0);
+
+    // The CSV header and the row are the only output.
+    const auto o = out.str();
+    EXPECT_EQ(o.find("iterations,warmup,gas_used,mean_ns,min_ns,median_ns,p90_ns,p99_ns,stddev_ns,"
+                     "gas_per_second\n3,1,3,"),
+              0u);
+    EXPECT_EQ(std::count(o.begin(), o.end(), '\n'), 2);
+}
+
+TEST(tool_commands, bench_threads)
+{
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+
+    auto bench = BenchOptions{0, 20, BenchFormat::text};
+    bench.threads = 3;
+    const auto code = *from_hex("60005460016000556000526001601ff3");
+    const auto exit_code = run(vm, EVMC_BERLIN, 10000, code, {}, false, bench, out);
+    EXPECT_EQ(exit_code, 0);
+
+    const auto o = out.str();
+    EXPECT_NE(o.find("Threads:  3\n"), std::string::npos);
+    EXPECT_NE(o.find("Rate:     "), std::string::npos);
+    EXPECT_NE(o.find(" exec/s (single thread: "), std::string::npos);
+    EXPECT_NE(o.find("Scaling:  "), std::string::npos);
+    EXPECT_NE(o.find("Output:   00\n"), std::string::npos);
+}
+
+TEST(tool_commands, trace)
+{
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+    std::ostringstream trace;
+
+    // sstore(0, 1)
+    const auto exit_code = run(vm, EVMC_LONDON, 100, *from_hex("600160005500"), {}, false,
+                               std::nullopt, out, &trace);
+    EXPECT_EQ(exit_code, 0);
+    EXPECT_EQ(out.str(), out_pattern("London", 100, "success", 4, "") + "Trace:    7 records\n");
+
+    const auto t = trace.str();
+    const auto* p = reinterpret_cast<const uint8_t*>(t.data());
+    ASSERT_EQ(t.size(), sizeof(TraceWriter::header) + TraceWriter::call_start_record_size +
+                            4 * TraceWriter::step_record_size + TraceWriter::storage_record_size +
+                            TraceWriter::call_end_record_size);
+    EXPECT_EQ(evmc::bytes_view(p, sizeof(TraceWriter::header)),
+              evmc::bytes_view(TraceWriter::header, sizeof(TraceWriter::header)));
+    p += sizeof(TraceWriter::header);
+
+    EXPECT_EQ(p[0], uint8_t(TraceRecordType::call_start));
+    EXPECT_EQ(p[8], 100);  // gas
+    p += TraceWriter::call_start_record_size;
+
+    // The SSTORE step: opcode, depth, pc, gas left and stack height.
+    p += 2 * TraceWriter::step_record_size;
+    EXPECT_EQ(evmc::bytes_view(p, TraceWriter::step_record_size),
+              *from_hex("02" "55" "0000" "04000000" "6200000000000000" "02000000"));
+    p += TraceWriter::step_record_size;
+
+    EXPECT_EQ(p[0], uint8_t(TraceRecordType::storage));
+    EXPECT_EQ(p[4 + 20 + 31], 0);  // key
+    EXPECT_EQ(p[4 + 52 + 31], 1);  // value
+    p += TraceWriter::storage_record_size + TraceWriter::step_record_size;
+
+    EXPECT_EQ(evmc::bytes_view(p, TraceWriter::call_end_record_size),
+              *from_hex("04" "00" "0000" "00000000" "6000000000000000" "0000000000000000"));
+}
+
+TEST(tool_commands, profile)
+{
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+
+    const auto exit_code = run(vm, EVMC_LONDON, 100, *from_hex("60028001"), {}, false,
+                               std::nullopt, out, nullptr, true);
+    EXPECT_EQ(exit_code, 0);
+
+    const auto o = out.str();
+    const auto profile_pos = o.find("Profile:\nOpcode ");
+    const auto hot_pcs_pos = o.find("Hot PCs:\nPC ");
+    ASSERT_NE(profile_pos, std::string::npos);
+    ASSERT_NE(hot_pcs_pos, std::string::npos);
+    EXPECT_LT(o.find("Gas used: 3\n"), profile_pos);
+    EXPECT_LT(profile_pos, hot_pcs_pos);
+
+    for (const auto* op : {"\nPUSH1 ", "\nDUP1 ", "\nADD "})
+    {
+        const auto pos = o.find(op, profile_pos);
+        EXPECT_LT(pos, hot_pcs_pos) << op;
+    }
+    EXPECT_NE(o.find("\n0       PUSH1 ", hot_pcs_pos), std::string::npos);
+    EXPECT_NE(o.find("\n2       DUP1 ", hot_pcs_pos), std::string::npos);
+    EXPECT_NE(o.find("\n3       ADD ", hot_pcs_pos), std::string::npos);
+}
+
+TEST(tool_commands, profile_and_trace)
+{
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+    std::ostringstream trace;
+    EXPECT_THROW(run(vm, EVMC_LONDON, 1, {}, {}, false, std::nullopt, out, &trace, true),
+                 std::invalid_argument);
+}
+
+TEST(tool_commands, profiler_nested_calls)
+{
+    Profiler profiler{EVMC_LONDON};
+    const auto& t = profiler.tracer();
+
+    // CALL at pc 0 executing ADD in the nested call, then STOP at pc 1.
+    evmc_message msg{};
+    msg.gas = 100;
+    t.on_call_start(t.context, &msg);
+    t.on_step(t.context, 0, 0, OP_CALL, 100, 0, nullptr);
+    msg.depth = 1;
+    msg.gas = 50;
+    t.on_call_start(t.context, &msg);
+    t.on_step(t.context, 1, 0, OP_ADD, 50, 2, nullptr);
+    evmc_result result{};
+    result.gas_left = 40;
+    t.on_call_end(t.context, 1, &result);
+    t.on_step(t.context, 0, 1, OP_STOP, 80, 1, nullptr);
+    result.gas_left = 80;
+    t.on_call_end(t.context, 0, &result);
+
+    const auto& ops = profiler.opcodes();
+    EXPECT_EQ(ops[OP_CALL].count, 1u);
+    EXPECT_EQ(ops[OP_CALL].gas_used, 20);
+    EXPECT_EQ(ops[OP_ADD].count, 1u);
+    EXPECT_EQ(ops[OP_ADD].gas_used, 10);
+    EXPECT_EQ(ops[OP_STOP].count, 1u);
+    EXPECT_EQ(ops[OP_STOP].gas_used, 0);
+    EXPECT_GE(ops[OP_CALL].time, ops[OP_ADD].time);
+
+    // Only the top-level code offsets are profiled.
+    const auto& pcs = profiler.pcs();
+    ASSERT_EQ(pcs.size(), 2u);
+    EXPECT_EQ(pcs.at(0).opcode, OP_CALL);
+    EXPECT_EQ(pcs.at(1).opcode, OP_STOP);
+
+    // The number of the reported hottest code offsets is limited.
+    std::ostringstream report;
+    profiler.report(report, 1);
+    const auto r = report.str();
+    const auto hot_pcs = r.substr(r.find("Hot PCs:\n"));
+    EXPECT_EQ(std::count(hot_pcs.begin(), hot_pcs.end(), '\n'), 3);
+}
+
+TEST(tool_commands, file_bytes)
+{
+    const TempDir dir{"file_bytes"};
+
+    const FileBytes hex{dir.write("code.hex", "0x6000\n 60 01\n")};
+    EXPECT_FALSE(hex.is_mapped());
+    EXPECT_EQ(hex.view(), *from_hex("60006001"));
+
+    const FileBytes bin{dir.write("code.bin", "\x60\x00\xfe"sv)};
+    EXPECT_TRUE(bin.is_mapped());
+    EXPECT_EQ(bin.view(), *from_hex("6000fe"));
+
+    // The moved-from object is empty.
+    auto moved_from = FileBytes{dir.write("moved.bin", "\x01\x02"sv)};
+    const auto moved = std::move(moved_from);
+    EXPECT_EQ(moved.view(), *from_hex("0102"));
+    EXPECT_TRUE(moved_from.view().empty());  // NOLINT(bugprone-use-after-move)
+
+    const FileBytes empty{dir.write("empty.bin", "")};
+    EXPECT_TRUE(empty.view().empty());
+
+    EXPECT_TRUE(FileBytes::is_binary_path("a.bin"));
+    EXPECT_FALSE(FileBytes::is_binary_path("a.bin.hex"));
+    EXPECT_FALSE(FileBytes::is_binary_path("bin"));
+
+    EXPECT_THROW(FileBytes{dir.write("invalid.hex", "0xzz")}, std::invalid_argument);
+    EXPECT_THROW(FileBytes{(dir.path / "missing.bin").string()}, std::invalid_argument);
+    EXPECT_THROW(FileBytes{(dir.path / "missing.hex").string()}, std::invalid_argument);
+    EXPECT_THROW(FileBytes{dir.path.string()}, std::invalid_argument);
+}
+
+TEST(tool_commands, run_corpus)
+{
+    const TempDir dir{"run_corpus"};
+    dir.write("b.hex", "60028001");  // PUSH1 2 DUP1 ADD
+    dir.write("a.bin", "\x30\x60\x00\x52\x59\x60\x00\xf3"sv);  // Returns the address.
+
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    std::ostringstream out;
+    EXPECT_EQ(run_corpus(vm, EVMC_BERLIN, 100, dir.path.string(), {}, false, out), 0);
+    EXPECT_EQ(out.str().substr(0, out.str().find("Time:")),
+              "Executing 2 contracts on Berlin with 100 gas limit\n\n"
+              "a.bin: success, gas used: 6\n"
+              "b.hex: success, gas used: 3\n"
+              "\nExecuted: 2 contracts, 0 failed\n"
+              "Gas used: 9\n");
+
+    // The creation of the contracts: the code returned by the initcode is executed.
+    dir.write("c.hex", "01");  // ADD
+    std::ostringstream create_out;
+    EXPECT_EQ(run_corpus(vm, EVMC_BERLIN, 100, dir.path.string(), {}, true, create_out), 1);
+    EXPECT_NE(create_out.str().find("a.bin: success, gas used: "), std::string::npos);
+    EXPECT_NE(create_out.str().find("b.hex: success, gas used: 0\n"), std::string::npos);
+    EXPECT_NE(create_out.str().find("c.hex: creation failed: stack underflow\n"),
+              std::string::npos);
+    EXPECT_NE(create_out.str().find("Executed: 3 contracts, 1 failed\n"), std::string::npos);
+
+    EXPECT_THROW(run_corpus(vm, EVMC_BERLIN, 100, (dir.path / "missing").string(), {}, false, out),
+                 std::invalid_argument);
+}
+
+namespace
+{
+/// The state test fixture: the contract 0xaa stores the input and calls the contract 0xbb,
+/// which stores the block number.
+constexpr auto state_test_fixture = R"({
+  "simple": {
+    "env": {
+      "currentCoinbase": "0xc0", "currentGasLimit": "0x05f5e100", "currentNumber": "0x07",
+      "currentTimestamp": "1000", "currentBaseFee": "0x0a", "currentRandom": "0x2"
+    },
+    "pre": {
+      "0x00000000000000000000000000000000000000aa": {
+        "balance": "0", "nonce": "1", "storage": {},
+        "code": "0x6000356000556000600060006000600060bb61fffff100"
+      },
+      "0x00000000000000000000000000000000000000bb": {
+        "balance": "0", "nonce": "1", "storage": {"0x01": "0x02"}, "code": "0x4360015500"
+      },
+      "0x00000000000000000000000000000000000000e0": {
+        "balance": "0x0de0b6b3a7640000", "nonce": "0", "storage": {}, "code": "0x"
+      }
+    },
+    "transaction": {
+      "data": ["0x01", "0x"], "gasLimit": ["1000000", "21000"], "value": ["0"],
+      "maxFeePerGas": "0x20", "maxPriorityFeePerGas": "0x01",
+      "sender": "0x00000000000000000000000000000000000000e0",
+      "to": "0x00000000000000000000000000000000000000aa"
+    },
+    "post": {
+      "Istanbul": [{"indexes": {"data": 0, "gas": 0, "value": 0}}],
+      "Cancun": [
+        {"indexes": {"data": 0, "gas": 0, "value": 0}},
+        {"indexes": {"data": 0, "gas": 1, "value": 0}},
+        {"indexes": {"data": 1, "gas": 0, "value": 0}, "expectException": "TR_TypeNotSupported"}
+      ],
+      "ShanghaiToCancunAtTime15k": [{"indexes": {"data": 0, "gas": 0, "value": 0}}]
+    }
+  }
+})";
+
+/// The state test fixture of the failing creation with value and with the access list
+/// of an account not in the prestate.
+constexpr auto failed_create_fixture = R"({
+  "failed_create": {
+    "env": {
+      "currentCoinbase": "0xc0", "currentGasLimit": "0x05f5e100", "currentNumber": "0x01",
+      "currentTimestamp": "1000", "currentBaseFee": "0x0a"
+    },
+    "pre": {
+      "0x00000000000000000000000000000000000000e0": {
+        "balance": "0x0de0b6b3a7640000", "nonce": "0", "storage": {}, "code": "0x"
+      }
+    },
+    "transaction": {
+      "data": ["0xfe"], "gasLimit": ["1000000"], "value": ["0x01"],
+      "accessLists": [
+        [{"address": "0x00000000000000000000000000000000000000dd", "storageKeys": ["0x01"]}]
+      ],
+      "maxFeePerGas": "0x20", "maxPriorityFeePerGas": "0x01",
+      "sender": "0x00000000000000000000000000000000000000e0", "to": ""
+    },
+    "post": {"Cancun": [{"indexes": {"data": 0, "gas": 0, "value": 0}}]}
+  }
+})";
+}  // namespace
+
+TEST(tool_commands, state_test_fork_names)
+{
+    EXPECT_EQ(to_revision("Frontier"), EVMC_FRONTIER);
+    EXPECT_EQ(to_revision("EIP150"), EVMC_TANGERINE_WHISTLE);
+    EXPECT_EQ(to_revision("EIP158"), EVMC_SPURIOUS_DRAGON);
+    EXPECT_EQ(to_revision("ConstantinopleFix"), EVMC_PETERSBURG);
+    EXPECT_EQ(to_revision("Merge"), EVMC_PARIS);
+    EXPECT_EQ(to_revision("Osaka"), EVMC_OSAKA);
+    EXPECT_FALSE(to_revision("BerlinToLondonAt5").has_value());
+    EXPECT_FALSE(to_revision("cancun").has_value());
+}
+
+TEST(tool_commands, load_state_tests)
+{
+    const auto tests = load_state_tests(state_test_fixture);
+
+    // The transactions expected to be invalid, without the intrinsic gas
+    // and of the transition forks are skipped.
+    ASSERT_EQ(tests.size(), 2u);
+    const auto& istanbul = tests[0];
+    const auto& cancun = tests[1];
+    EXPECT_EQ(istanbul.name, "simple/Istanbul/d0g0v0");
+    EXPECT_EQ(istanbul.rev, EVMC_ISTANBUL);
+    EXPECT_EQ(cancun.name, "simple/Cancun/d0g0v0");
+    EXPECT_EQ(cancun.rev, EVMC_CANCUN);
+
+    EXPECT_EQ(cancun.msg.kind, EVMC_CALL);
+    EXPECT_EQ(cancun.msg.gas, 1000000 - 21000 - 16);
+    EXPECT_EQ(cancun.msg.sender, evmc::address{0xe0});
+    EXPECT_EQ(cancun.msg.recipient, evmc::address{0xaa});
+    EXPECT_EQ(cancun.data, evmc::bytes{0x01});
+
+    const auto& tx_context = cancun.pre.tx_context;
+    EXPECT_EQ(tx_context.block_number, 7);
+    EXPECT_EQ(tx_context.block_timestamp, 1000);
+    EXPECT_EQ(tx_context.block_coinbase, evmc::address{0xc0});
+    EXPECT_EQ(tx_context.block_prev_randao, evmc::bytes32{2});
+    EXPECT_EQ(tx_context.tx_gas_price, evmc::bytes32{0x0b});
+    EXPECT_EQ(tx_context.tx_origin, evmc::address{0xe0});
+    EXPECT_EQ(cancun.pre.accounts.size(), 3u);
+    EXPECT_EQ(cancun.pre.accounts.at(evmc::address{0xbb}).storage.at(evmc::bytes32{1}).current,
+              evmc::bytes32{2});
+
+    // The sender, the recipient and the coinbase are warm since Berlin and Shanghai.
+    EXPECT_EQ(cancun.pre.accessed_accounts.count(evmc::address{0xe0}), 1u);
+    EXPECT_EQ(cancun.pre.accessed_accounts.count(evmc::address{0xaa}), 1u);
+    EXPECT_EQ(cancun.pre.accessed_accounts.count(evmc::address{0xc0}), 1u);
+    EXPECT_TRUE(istanbul.pre.accessed_accounts.empty());
+
+    EXPECT_THROW(load_state_tests("{\"simple\": "), std::invalid_argument);
+    EXPECT_THROW(load_state_tests("[]"), std::invalid_argument);
+    EXPECT_THROW(load_state_tests(R"({"simple": {"env": {}}})"), std::invalid_argument);
+    EXPECT_EQ(load_state_tests("{}").size(), 0u);
+}
+
+TEST(tool_commands, execute_state_test)
+{
+    const auto tests = load_state_tests(state_test_fixture);
+    ASSERT_EQ(tests.size(), 2u);
+
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    evmc::MockedHost post;
+    const auto result = execute_state_test(vm, tests[1], &post);
+    EXPECT_EQ(result.status, EVMC_SUCCESS);
+    EXPECT_GT(result.gas_used, 0);
+
+    // The input is stored and the nested call is executed.
+    evmc::bytes32 input{};
+    input.bytes[0] = 0x01;
+    EXPECT_EQ(post.accounts.at(evmc::address{0xaa}).storage.at(evmc::bytes32{}).current, input);
+    EXPECT_EQ(post.accounts.at(evmc::address{0xbb}).storage.at(evmc::bytes32{1}).current,
+              evmc::bytes32{7});
+    EXPECT_EQ(post.accounts.at(evmc::address{0xe0}).nonce, 1);
+
+    // The prestate is not modified.
+    EXPECT_EQ(tests[1].pre.accounts.at(evmc::address{0xaa}).storage.count(evmc::bytes32{}), 0u);
+    EXPECT_EQ(tests[1].pre.accounts.at(evmc::address{0xe0}).nonce, 0);
+}
+
+TEST(tool_commands, execute_state_test_failed_create)
+{
+    const auto tests = load_state_tests(failed_create_fixture);
+    ASSERT_EQ(tests.size(), 1u);
+    const auto& test = tests[0];
+    EXPECT_EQ(test.msg.kind, EVMC_CREATE);
+
+    // The access list storage slot is warm, but the account is not added to the prestate.
+    EXPECT_EQ(test.pre.accounts.count(evmc::address{0xdd}), 0u);
+    ASSERT_EQ(test.warm_storage.size(), 1u);
+    EXPECT_EQ(test.warm_storage[0].addr, evmc::address{0xdd});
+    EXPECT_EQ(test.warm_storage[0].key, evmc::bytes32{1});
+
+    // The account created by the value transfer is removed when the creation fails.
+    auto vm = evmc::VM{evmc_create_example_vm()};
+    evmc::MockedHost post;
+    const auto result = execute_state_test(vm, test, &post);
+    EXPECT_NE(result.status, EVMC_SUCCESS);
+    ASSERT_EQ(post.accounts.size(), 1u);
+    const auto& sender = post.accounts.at(evmc::address{0xe0});
+    EXPECT_EQ(sender.balance, test.pre.accounts.at(evmc::address{0xe0}).balance);
+    EXPECT_EQ(sender.nonce, 1);
+}
+
+TEST(tool_commands, run_state_tests)
+{
+    const TempDir dir{"run_state_tests"};
+    dir.write("a.json", state_test_fixture);
+    dir.write("b.txt", "not a fixture");
+
+    // Every thread gets its own VM instance.
+    std::vector<const evmc_vm*> created;
+    const auto create_vm = [&created] {
+        auto vm = evmc::VM{evmc_create_example_vm()};
+        created.emplace_back(vm.get_raw_pointer());
+        return vm;
+    };
+    std::ostringstream out;
+    StateTestOptions options;
+    options.threads = 2;
+    options.repetitions = 2;
+    EXPECT_EQ(run_state_tests(create_vm, {dir.path.string()}, options, out), 0);
+    ASSERT_EQ(created.size(), 2u);
+    EXPECT_NE(created[0], created[1]);
+    const auto str = out.str();
+    EXPECT_EQ(str.find("simple/Istanbul/d0g0v0: success, "), 0u);
+    EXPECT_NE(str.find("\nsimple/Cancun/d0g0v0: success, "), std::string::npos);
+    EXPECT_NE(str.find("\nTests:    2 (threads: 2)\n"), std::string::npos);
+    EXPECT_NE(str.find("\nGas rate: "), std::string::npos);
+
+    std::ostringstream fork_out;
+    options.rev = EVMC_CANCUN;
+    EXPECT_EQ(run_state_tests(create_vm, {dir.path.string()}, options, fork_out), 0);
+    EXPECT_EQ(fork_out.str().find("simple/Cancun/d0g0v0: success, "), 0u);
+    EXPECT_NE(fork_out.str().find("\nTests:    1 (threads: 1)\n"), std::string::npos);
+
+    const auto invalid = dir.write("c.json", "{");
+    EXPECT_THROW(run_state_tests(create_vm, {invalid}, options, out), std::invalid_argument);
+    EXPECT_THROW(run_state_tests(create_vm, {(dir.path / "missing").string()}, options, out),
+                 std::invalid_argument);
+    EXPECT_THROW(run_state_tests([] { return evmc::VM{}; }, {dir.path.string()}, options, out),
+                 std::invalid_argument);
 }
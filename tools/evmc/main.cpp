@@ -6,36 +6,43 @@
 #include <evmc/hex.hpp>
 #include <evmc/loader.h>
 #include <evmc/tooling.hpp>
+#include <filesystem>
 #include <fstream>
 
 namespace
 {
-/// If the argument starts with @ returns the hex-decoded contents of the file
-/// at the path following the @. Otherwise, returns the argument.
-/// @todo The file content is expected to be a hex string but not validated.
-evmc::bytes load_from_hex(const std::string& str)
+/// The bytes of the code or the input argument.
+///
+/// If the argument starts with @ the bytes are loaded from the file at the path following
+/// the @: the raw binary .bin files are memory-mapped, the other files are hex-decoded
+/// (see evmc::tooling::FileBytes). Otherwise, the argument is hex-decoded.
+class BytesArg
 {
-    if (str[0] == '@')  // The argument is file path.
+    std::optional<evmc::tooling::FileBytes> m_file;
+    evmc::bytes m_decoded;
+
+public:
+    explicit BytesArg(const std::string& str)
     {
-        const auto path = str.substr(1);
-        std::ifstream file{path};
-        auto out = evmc::from_spaced_hex(std::istreambuf_iterator<char>{file},
-                                         std::istreambuf_iterator<char>{});
-        if (!out)
-            throw std::invalid_argument{"invalid hex in " + path};
-        return out.value();
+        if (!str.empty() && str[0] == '@')  // The argument is file path.
+            m_file.emplace(str.substr(1));
+        else
+            m_decoded = evmc::from_hex(str).value();  // Should be validated already.
     }
 
-    return evmc::from_hex(str).value();  // Should be validated already.
-}
+    evmc::bytes_view view() const noexcept { return m_file ? m_file->view() : m_decoded; }
+};
 
 struct HexOrFileValidator : public CLI::Validator
 {
-    HexOrFileValidator() : CLI::Validator{"HEX|@FILE"}
+    /// @param allow_dir  Allow @DIR (the corpus directory) in addition to @FILE.
+    explicit HexOrFileValidator(bool allow_dir = false)
+      : CLI::Validator{allow_dir ? "HEX|@FILE|@DIR" : "HEX|@FILE"}
     {
-        func_ = [](const std::string& str) -> std::string {
+        func_ = [allow_dir](const std::string& str) -> std::string {
             if (!str.empty() && str[0] == '@')
-                return CLI::ExistingFile(str.substr(1));
+                return allow_dir ? CLI::ExistingPath(str.substr(1)) :
+                                   CLI::ExistingFile(str.substr(1));
             if (!evmc::validate_hex(str))
                 return "invalid hex";
             return {};
@@ -51,6 +58,7 @@ int main(int argc, const char** argv) noexcept
     try
     {
         const HexOrFileValidator HexOrFile;
+        const HexOrFileValidator HexOrFileOrDir{true};
 
         std::string vm_config;
         std::string code_arg;
@@ -59,6 +67,13 @@ int main(int argc, const char** argv) noexcept
         std::string input_arg;
         auto create = false;
         auto bench = false;
+        tooling::BenchOptions bench_options;
+        std::string bench_format = "text";
+        std::string trace_path;
+        auto profile = false;
+        std::vector<std::string> statetest_paths;
+        tooling::StateTestOptions statetest_options;
+        std::string statetest_fork;
 
         CLI::App app{"EVMC tool"};
         const auto& version_flag = *app.add_flag("--version", "Print version information and exit");
@@ -66,7 +81,11 @@ int main(int argc, const char** argv) noexcept
             *app.add_option("--vm", vm_config, "EVMC VM module")->envname("EVMC_VM");
 
         auto& run_cmd = *app.add_subcommand("run", "Execute EVM bytecode")->fallthrough();
-        run_cmd.add_option("code", code_arg, "Bytecode")->required()->check(HexOrFile);
+        run_cmd
+            .add_option("code", code_arg,
+                        "Bytecode, or the directory of the bytecode files to execute each")
+            ->required()
+            ->check(HexOrFileOrDir);
         run_cmd.add_option("--gas", gas, "Execution gas limit")
             ->capture_default_str()
             ->check(CLI::Range(0, 1000000000));
@@ -75,9 +94,55 @@ int main(int argc, const char** argv) noexcept
         run_cmd.add_flag(
             "--create", create,
             "Create new contract out of the code and then execute this contract with the input");
-        run_cmd.add_flag(
+        auto* const bench_flag = run_cmd.add_flag(
             "--bench", bench,
-            "Benchmark execution time (state modification may result in unexpected behaviour)");
+            "Benchmark execution time (every execution starts from the same initial state)");
+        run_cmd.add_option("--bench-warmup", bench_options.warmup, "Number of warm-up executions")
+            ->capture_default_str()
+            ->check(CLI::Range(0, 1000000))
+            ->needs(bench_flag);
+        run_cmd
+            .add_option("--bench-repetitions", bench_options.repetitions,
+                        "Number of measured executions (0: auto, around 1 second)")
+            ->capture_default_str()
+            ->check(CLI::Range(0, 100000000))
+            ->needs(bench_flag);
+        run_cmd
+            .add_option("--threads", bench_options.threads,
+                        "Number of threads executing the code concurrently to measure throughput")
+            ->capture_default_str()
+            ->check(CLI::Range(1, 1024))
+            ->needs(bench_flag);
+        run_cmd.add_option("--bench-format", bench_format, "Benchmark statistics output format")
+            ->capture_default_str()
+            ->check(CLI::IsMember({"text", "json", "csv"}))
+            ->needs(bench_flag);
+        auto* const trace_option = run_cmd.add_option(
+            "--trace", trace_path, "Write the binary execution trace to the file");
+        run_cmd
+            .add_flag("--profile", profile,
+                      "Report the execution count, gas and time of opcodes and hottest PCs")
+            ->excludes(trace_option);
+
+        auto& statetest_cmd =
+            *app.add_subcommand("statetest", "Execute Ethereum state test fixtures")->fallthrough();
+        statetest_cmd
+            .add_option("paths", statetest_paths,
+                        "State test fixture files or directories searched for the .json files")
+            ->required()
+            ->check(CLI::ExistingPath);
+        statetest_cmd
+            .add_option("--threads", statetest_options.threads,
+                        "Number of threads executing the tests (0: number of hardware threads)")
+            ->capture_default_str()
+            ->check(CLI::Range(0, 1024));
+        statetest_cmd
+            .add_option("--repetitions", statetest_options.repetitions,
+                        "Number of executions of every test, the best time is reported")
+            ->capture_default_str()
+            ->check(CLI::Range(1, 1000000));
+        statetest_cmd.add_option("--fork", statetest_fork,
+                                 "Execute only the tests of the fork, e.g. Cancun");
 
         try
         {
@@ -118,12 +183,62 @@ int main(int argc, const char** argv) noexcept
                 if (vm_option.count() == 0)
                     throw CLI::RequiredError{vm_option.get_name()};
 
-                std::cout << "Config: " << vm_config << "\n";
+                // The structured benchmark output is not mixed with the human-readable lines.
+                if (!bench || bench_format == "text")
+                    std::cout << "Config: " << vm_config << "\n";
 
                 // If code_arg or input_arg contains invalid hex string an exception is thrown.
-                const auto code = load_from_hex(code_arg);
-                const auto input = load_from_hex(input_arg);
-                return tooling::run(vm, rev, gas, code, input, create, bench, std::cout);
+                const BytesArg input{input_arg};
+                if (code_arg[0] == '@' && std::filesystem::is_directory(code_arg.substr(1)))
+                {
+                    if (bench || !trace_path.empty() || profile)
+                    {
+                        throw std::invalid_argument{
+                            "the corpus directory excludes --bench, --trace and --profile"};
+                    }
+                    return tooling::run_corpus(vm, rev, gas, code_arg.substr(1), input.view(),
+                                               create, std::cout);
+                }
+                const BytesArg code{code_arg};
+                std::optional<tooling::BenchOptions> bench_config;
+                if (bench)
+                {
+                    bench_options.format = bench_format == "json" ? tooling::BenchFormat::json :
+                                           bench_format == "csv"  ? tooling::BenchFormat::csv :
+                                                                    tooling::BenchFormat::text;
+                    bench_config = bench_options;
+                }
+                std::ofstream trace_file;
+                if (!trace_path.empty())
+                {
+                    trace_file.open(trace_path, std::ios::binary);
+                    if (!trace_file)
+                        throw std::invalid_argument{"cannot open trace file " + trace_path};
+                }
+                return tooling::run(vm, rev, gas, code.view(), input.view(), create, bench_config,
+                                    std::cout, trace_file.is_open() ? &trace_file : nullptr,
+                                    profile);
+            }
+
+            if (statetest_cmd)
+            {
+                // For statetest command the --vm is required.
+                if (vm_option.count() == 0)
+                    throw CLI::RequiredError{vm_option.get_name()};
+
+                if (!statetest_fork.empty())
+                {
+                    statetest_options.rev = tooling::to_revision(statetest_fork);
+                    if (!statetest_options.rev)
+                        throw std::invalid_argument{"unknown fork " + statetest_fork};
+                }
+
+                std::cout << "Config: " << vm_config << "\n";
+                const auto create_vm = [&vm_config] {
+                    return VM{evmc_load_and_configure(vm_config.c_str(), nullptr)};
+                };
+                return tooling::run_state_tests(create_vm, statetest_paths, statetest_options,
+                                                std::cout);
             }
 
             return 0;
@@ -0,0 +1,341 @@
+// EVMC: Ethereum Client-VM Connector API
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+
+#include "perf.hpp"
+#include <evmc/hex.hpp>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace evmc::vmtester
+{
+namespace
+{
+/// The address of the account executing the scenario code.
+constexpr auto recipient = 0x000000000000000000000000000000000000c0de_address;
+
+/// The gas limit of the scenario execution.
+constexpr int64_t gas_limit = 30'000'000;
+
+/// The maximum depth of the nested calls.
+///
+/// Lower than the EVM limit of 1024, because the VMs may keep the stack and the memory
+/// of each call frame on the native stack.
+constexpr int32_t max_depth = 64;
+
+/// The minimal Host for measuring the VM performance.
+///
+/// Unlike the MockedHost it does not record the accesses, so its cost stays constant
+/// over many executions. All accounts have the scenario code, the calls are executed
+/// recursively by the VM up to the maximum depth.
+class PerfHost : public Host
+{
+    VM& m_vm;
+    bytes_view m_code;
+    int32_t m_depth = 0;
+    std::unordered_map<bytes32, bytes32> m_storage;
+    std::unordered_map<bytes32, bytes32> m_transient_storage;
+
+public:
+    PerfHost(VM& vm, bytes_view code) noexcept : m_vm{vm}, m_code{code} {}
+
+    bool account_exists(const address& /*addr*/) const noexcept override { return true; }
+
+    bytes32 get_storage(const address& /*addr*/, const bytes32& key) const noexcept override
+    {
+        const auto it = m_storage.find(key);
+        return it != m_storage.end() ? it->second : bytes32{};
+    }
+
+    evmc_storage_status set_storage(const address& /*addr*/,
+                                    const bytes32& key,
+                                    const bytes32& value) noexcept override
+    {
+        m_storage[key] = value;
+        return EVMC_STORAGE_ASSIGNED;
+    }
+
+    uint256be get_balance(const address& /*addr*/) const noexcept override { return {}; }
+
+    size_t get_code_size(const address& /*addr*/) const noexcept override
+    {
+        return m_code.size();
+    }
+
+    bytes32 get_code_hash(const address& /*addr*/) const noexcept override { return {}; }
+
+    size_t copy_code(const address& /*addr*/,
+                     size_t code_offset,
+                     uint8_t* buffer_data,
+                     size_t buffer_size) const noexcept override
+    {
+        if (code_offset >= m_code.size())
+            return 0;
+        const auto n = std::min(buffer_size, m_code.size() - code_offset);
+        std::copy_n(&m_code[code_offset], n, buffer_data);
+        return n;
+    }
+
+    bool selfdestruct(const address& /*addr*/, const address& /*beneficiary*/) noexcept override
+    {
+        return false;
+    }
+
+    Result call(const evmc_message& msg) noexcept override
+    {
+        if (m_depth >= max_depth)
+            return Result{EVMC_CALL_DEPTH_EXCEEDED, 0, 0};
+
+        auto nested = msg;
+        nested.depth = ++m_depth;
+        auto result = m_vm.execute(*this, EVMC_LATEST_STABLE_REVISION, nested, m_code.data(),
+                                   m_code.size());
+        --m_depth;
+        return result;
+    }
+
+    evmc_tx_context get_tx_context() const noexcept override
+    {
+        evmc_tx_context tx_context{};
+        tx_context.block_number = 1;
+        tx_context.block_gas_limit = gas_limit;
+        return tx_context;
+    }
+
+    bytes32 get_block_hash(int64_t /*block_number*/) const noexcept override { return {}; }
+
+    void emit_log(const address& /*addr*/,
+                  const uint8_t* /*data*/,
+                  size_t /*data_size*/,
+                  const bytes32 /*topics*/[],
+                  size_t /*topics_count*/) noexcept override
+    {}
+
+    evmc_access_status access_account(const address& /*addr*/) noexcept override
+    {
+        return EVMC_ACCESS_WARM;
+    }
+
+    evmc_access_status access_storage(const address& /*addr*/,
+                                      const bytes32& /*key*/) noexcept override
+    {
+        return EVMC_ACCESS_WARM;
+    }
+
+    bytes32 get_transient_storage(const address& /*addr*/,
+                                  const bytes32& key) const noexcept override
+    {
+        const auto it = m_transient_storage.find(key);
+        return it != m_transient_storage.end() ? it->second : bytes32{};
+    }
+
+    void set_transient_storage(const address& /*addr*/,
+                               const bytes32& key,
+                               const bytes32& value) noexcept override
+    {
+        m_transient_storage[key] = value;
+    }
+};
+
+/// Executes the scenario code once.
+Result execute(VM& vm, PerfHost& host, bytes_view code) noexcept
+{
+    evmc_message msg{};
+    msg.gas = gas_limit;
+    msg.recipient = recipient;
+    return vm.execute(host, EVMC_LATEST_STABLE_REVISION, msg, code.data(), code.size());
+}
+
+/// Builds the loop code decrementing the counter from the initial value down to 0.
+/// The loop body must not change the stack.
+bytes loop(const char* counter_push_hex, const std::string& body_hex)
+{
+    const auto counter_push = from_hex(counter_push_hex).value();
+    const auto jumpdest = static_cast<uint8_t>(counter_push.size());
+    std::ostringstream code_hex;
+    code_hex << counter_push_hex << "5b" << body_hex
+             << "7f" + std::string(64, 'f')  // PUSH32 -1
+             << "01"                         // ADD
+             << "80"                         // DUP1
+             << "60" << hex({&jumpdest, 1})  // PUSH1 jumpdest
+             << "57"                         // JUMPI
+             << "00";                        // STOP
+    return from_hex(code_hex.str()).value();
+}
+}  // namespace
+
+const std::vector<PerfScenario>& perf_corpus()
+{
+    static const std::vector<PerfScenario> corpus{
+        {"arith_loop", "10000 iterations of a counter loop", loop("612710", "")},
+
+        // KECCAK256(0, 32) MSTORE(0)
+        {"keccak_loop", "10000 iterations of KECCAK256 of 32 bytes of memory",
+         loop("612710", "6020600020600052")},
+
+        // SSTORE(1, SLOAD(1) + 1) SSTORE(2, SLOAD(2) + 1)
+        {"storage_churn", "1000 iterations of SLOAD and SSTORE of 2 slots",
+         loop("6103e8", "600154600101600155600254600101600255")},
+
+        // CALL(0xffffffff, ADDRESS, 0, 0, 0, 0, 0)
+        {"call_recursion", "CALL of itself to the depth of 64",
+         from_hex("6000808080803063fffffffff100").value()},
+
+        // MSTORE(counter * 32, counter * 32)
+        {"memory_expansion", "MSTORE to every word of 1 MiB of memory, expanded at once",
+         loop("618000", "806020028052")},
+    };
+    return corpus;
+}
+
+PerfResult measure(VM& vm, const PerfScenario& scenario)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr int64_t batch_time = 20'000'000;  // 20 ms.
+    constexpr int num_batches = 5;
+
+    PerfHost host{vm, scenario.code};
+    PerfResult result;
+    result.name = scenario.name;
+
+    // The warm-up run checking the VM supports the scenario.
+    const auto start = clock::now();
+    {
+        const auto r = execute(vm, host, scenario.code);
+        result.status = r.status_code;
+        result.gas_used = gas_limit - r.gas_left;
+    }
+    const auto first_time = clock::now() - start;
+    if (!result.supported())
+        return result;
+
+    const auto first_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(first_time);
+    const auto runs_per_batch = static_cast<uint64_t>(
+        std::max<int64_t>(batch_time / std::max<int64_t>(first_ns.count(), 1), 1));
+    for (int i = 0; i < num_batches; ++i)
+    {
+        const auto batch_start = clock::now();
+        for (uint64_t j = 0; j < runs_per_batch; ++j)
+            execute(vm, host, scenario.code);
+        const auto batch_duration =
+            std::chrono::duration<double, std::nano>{clock::now() - batch_start};
+        const auto ns_per_run = batch_duration.count() / static_cast<double>(runs_per_batch);
+        if (i == 0 || ns_per_run < result.ns_per_run)
+            result.ns_per_run = ns_per_run;
+        result.runs += runs_per_batch;
+    }
+    return result;
+}
+
+PerfBaseline load_baseline(std::istream& in)
+{
+    PerfBaseline baseline;
+    std::string line;
+    for (int line_number = 1; std::getline(in, line); ++line_number)
+    {
+        std::istringstream fields{line};
+        std::string name;
+        if (!(fields >> name) || name[0] == '#')
+            continue;
+
+        double ns_per_run = 0;
+        std::string rest;
+        if (!(fields >> ns_per_run) || ns_per_run <= 0 || fields >> rest)
+        {
+            throw std::invalid_argument{"invalid baseline line " + std::to_string(line_number) +
+                                        ": " + line};
+        }
+        baseline[name] = ns_per_run;
+    }
+    return baseline;
+}
+
+void save_baseline(std::ostream& out, const VM& vm, const std::vector<PerfResult>& results)
+{
+    out << "# evmc-vmtester perf baseline of " << vm.name() << " " << vm.version() << "\n";
+    out << "# scenario time-per-execution-ns\n";
+    for (const auto& r : results)
+    {
+        if (r.supported())
+            out << r.name << " " << std::fixed << std::setprecision(1) << r.ns_per_run << "\n";
+    }
+}
+
+int run_perf(VM& vm, const PerfOptions& options, std::ostream& out)
+{
+    PerfBaseline baseline;
+    if (options.baseline)
+    {
+        std::ifstream file{*options.baseline};
+        if (!file)
+            throw std::invalid_argument{"cannot open the baseline file " + *options.baseline};
+        baseline = load_baseline(file);
+    }
+
+    out << std::left << std::setw(20) << "Scenario" << std::right << std::setw(10) << "Runs"
+        << std::setw(14) << "Time [us]" << std::setw(12) << "Mgas/s" << std::setw(14)
+        << "Baseline [us]" << std::setw(10) << "Change"
+        << "\n";
+
+    std::vector<PerfResult> results;
+    int num_regressions = 0;
+    for (const auto& scenario : perf_corpus())
+    {
+        const auto& r = results.emplace_back(measure(vm, scenario));
+        out << std::left << std::setw(20) << r.name << std::right << std::fixed
+            << std::setprecision(2);
+
+        const auto b = baseline.find(r.name);
+        if (!r.supported())
+        {
+            out << "  unsupported: " << r.status;
+            if (b != baseline.end())
+            {
+                out << "  REGRESSION";
+                ++num_regressions;
+            }
+            out << "\n";
+            continue;
+        }
+
+        out << std::setw(10) << r.runs << std::setw(14) << r.ns_per_run / 1000 << std::setw(12)
+            << static_cast<double>(r.gas_used) / r.ns_per_run * 1000;
+        if (b != baseline.end())
+        {
+            const auto change = (r.ns_per_run / b->second - 1) * 100;
+            out << std::setw(14) << b->second / 1000 << std::setw(9) << std::showpos << change
+                << std::noshowpos << "%";
+            if (change > options.tolerance)
+            {
+                out << "  REGRESSION";
+                ++num_regressions;
+            }
+        }
+        out << "\n";
+    }
+
+    if (options.save_baseline)
+    {
+        std::ofstream file{*options.save_baseline};
+        if (!file)
+        {
+            throw std::invalid_argument{"cannot write the baseline file " +
+                                        *options.save_baseline};
+        }
+        save_baseline(file, vm, results);
+    }
+
+    if (num_regressions != 0)
+    {
+        out << num_regressions << " regression(s) over the tolerance of " << options.tolerance
+            << "%\n";
+        return 1;
+    }
+    return 0;
+}
+}  // namespace evmc::vmtester
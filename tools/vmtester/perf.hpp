@@ -0,0 +1,78 @@
+// EVMC: Ethereum Client-VM Connector API
+// Copyright 2024 The EVMC Authors.
+// Licensed under the Apache License, Version 2.0.
+#pragma once
+
+#include <evmc/evmc.hpp>
+#include <iosfwd>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace evmc::vmtester
+{
+/// The bytecode scenario of the performance conformance mode.
+struct PerfScenario
+{
+    const char* name;         ///< The scenario name, used as the key in the baseline file.
+    const char* description;  ///< The short description of what the code exercises.
+    bytes code;               ///< The code executed at the depth 0.
+};
+
+/// The measured performance of a scenario.
+struct PerfResult
+{
+    std::string name;                         ///< The scenario name.
+    evmc_status_code status = EVMC_SUCCESS;   ///< The status of the execution.
+    uint64_t runs = 0;                        ///< The number of the measured executions.
+    double ns_per_run = 0;                    ///< The best time of an execution, in nanoseconds.
+    int64_t gas_used = 0;                     ///< The gas used by an execution.
+
+    /// Is the scenario supported by the VM, i.e. the execution has succeeded.
+    bool supported() const noexcept { return status == EVMC_SUCCESS; }
+};
+
+/// The options of the performance conformance mode.
+struct PerfOptions
+{
+    /// The path of the baseline file to compare the results against.
+    std::optional<std::string> baseline;
+
+    /// The path of the file to save the results to as the new baseline.
+    std::optional<std::string> save_baseline;
+
+    /// The maximum slowdown against the baseline not reported as a regression, in percent.
+    double tolerance = 10;
+};
+
+/// The baseline: the times of an execution of the scenarios in nanoseconds, by the names.
+using PerfBaseline = std::map<std::string, double>;
+
+/// Returns the fixed corpus of the scenarios: arithmetic loop, keccak loop, storage churn,
+/// deep call recursion and large memory expansion.
+const std::vector<PerfScenario>& perf_corpus();
+
+/// Measures the performance of the VM executing the scenario in the latest stable revision.
+///
+/// The scenario is executed once to check the status and then in 5 batches of about 20 ms.
+/// The best time per execution of the batches is reported to reduce the noise.
+PerfResult measure(VM& vm, const PerfScenario& scenario);
+
+/// Parses the baseline file: the lines of the scenario name and the time in nanoseconds.
+/// The empty lines and the lines starting with # are ignored.
+/// Throws std::invalid_argument in case of a malformed line.
+PerfBaseline load_baseline(std::istream& in);
+
+/// Writes the times of the supported scenarios in the baseline file format.
+void save_baseline(std::ostream& out, const VM& vm, const std::vector<PerfResult>& results);
+
+/// Runs the performance conformance mode: measures all the corpus scenarios, reports
+/// the throughput and flags the regressions against the baseline.
+///
+/// A scenario present in the baseline is a regression if it is slower by more than
+/// the tolerance or it is no longer supported.
+///
+/// @return  0 if no regressions, 1 otherwise.
+int run_perf(VM& vm, const PerfOptions& options, std::ostream& out);
+}  // namespace evmc::vmtester
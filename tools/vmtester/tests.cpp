@@ -21,6 +21,31 @@ void read_buffer(const uint8_t* ptr, size_t size) noexcept
     for (size_t i = 0; i < size; i++)
         read_uint8(&ptr[i]);
 }
+
+/// Validates the output of the execution result and reads it to detect invalid memory accesses.
+///
+/// The output stored in evmc_result::inline_output is accessed with evmc_get_output_data(),
+/// the evmc_result::output_data is NULL or references the inline output of another copy then.
+void check_output(const evmc_result& result) noexcept
+{
+    const auto output_data = evmc_get_output_data(&result);
+
+    if ((result.flags & EVMC_RESULT_INLINE_OUTPUT) != 0)
+    {
+        EXPECT_LE(result.output_size, size_t{EVMC_INLINE_OUTPUT_MAX_SIZE});
+    }
+    else if (output_data == nullptr)
+    {
+        EXPECT_EQ(result.output_size, size_t{0});
+    }
+    else
+    {
+        EXPECT_NE(result.output_size, size_t{0});
+    }
+
+    if (result.output_size != 0)
+        read_buffer(output_data, result.output_size);
+}
 }  // namespace
 
 TEST_F(evmc_vm_test, abi_version_match)
@@ -68,15 +93,7 @@ TEST_F(evmc_vm_test, execute_call)
         EXPECT_EQ(result.gas_left, 0);
     }
 
-    if (result.output_data == nullptr)
-    {
-        EXPECT_EQ(result.output_size, size_t{0});
-    }
-    else
-    {
-        EXPECT_NE(result.output_size, size_t{0});
-        read_buffer(result.output_data, result.output_size);
-    }
+    check_output(result);
 
     EXPECT_TRUE(evmc::is_zero(result.create_address));
 
@@ -99,7 +116,8 @@ TEST_F(evmc_vm_test, execute_create)
                            evmc_bytes32{},
                            evmc_address{},
                            nullptr,
-                           0};
+                           0,
+                           nullptr};
     std::array<uint8_t, 2> code = {{0xfe, 0x00}};
 
     const evmc_result result =
@@ -112,15 +130,7 @@ TEST_F(evmc_vm_test, execute_create)
         EXPECT_EQ(result.gas_left, 0);
     }
 
-    if (result.output_data == nullptr)
-    {
-        EXPECT_EQ(result.output_size, size_t{0});
-    }
-    else
-    {
-        EXPECT_NE(result.output_size, size_t{0});
-        read_buffer(result.output_data, result.output_size);
-    }
+    check_output(result);
 
     // The VM will never provide the create address.
     EXPECT_TRUE(evmc::is_zero(result.create_address));
@@ -129,6 +139,33 @@ TEST_F(evmc_vm_test, execute_create)
         result.release(&result);
 }
 
+TEST_F(evmc_vm_test, execute_short_output)
+{
+    if (!evmc_vm_has_capability(vm, EVMC_CAPABILITY_EVM1))
+        return;
+
+    evmc::MockedHost mockedHost;
+    evmc_message msg{};
+    msg.gas = 65536;
+    // MSTORE(0, 0x2a) RETURN(30, 2)
+    const uint8_t code[] = {0x60, 0x2a, 0x60, 0x00, 0x52, 0x60, 0x02, 0x60, 0x1e, 0xf3};
+
+    const evmc_result result =
+        vm->execute(vm, &evmc::MockedHost::get_interface(), mockedHost.to_context(),
+                    EVMC_MAX_REVISION, &msg, code, sizeof(code));
+
+    // The output short enough to be stored inline must survive copying the result by value.
+    evmc_result copy = result;
+    ASSERT_EQ(copy.status_code, EVMC_SUCCESS);
+    ASSERT_EQ(copy.output_size, size_t{2});
+    check_output(copy);
+    const auto output = evmc_get_output_data(&copy);
+    EXPECT_EQ(output[0], 0x00);
+    EXPECT_EQ(output[1], 0x2a);
+
+    evmc_release_result(&copy);
+}
+
 TEST_F(evmc_vm_test, set_option_unknown_name)
 {
     if (vm->set_option != nullptr)
@@ -192,7 +229,8 @@ TEST_F(evmc_vm_test, precompile_test)
                                evmc_bytes32{},
                                addr,
                                nullptr,
-                               0};
+                               0,
+                               nullptr};
 
         const evmc_result result =
             vm->execute(vm, nullptr, nullptr, EVMC_MAX_REVISION, &msg, nullptr, 0);
@@ -209,15 +247,18 @@ TEST_F(evmc_vm_test, precompile_test)
             EXPECT_EQ(result.gas_left, 0);
         }
 
-        if (result.output_data == nullptr)
+        if ((result.flags & EVMC_RESULT_INLINE_OUTPUT) != 0)
         {
-            EXPECT_EQ(result.output_size, size_t{0});
+            EXPECT_LE(result.output_size, size_t{EVMC_INLINE_OUTPUT_MAX_SIZE});
         }
-        else if (result.output_size != 0)
+        else if (result.output_data == nullptr)
         {
-            read_buffer(result.output_data, result.output_size);
+            EXPECT_EQ(result.output_size, size_t{0});
         }
 
+        if (result.output_size != 0)
+            read_buffer(evmc_get_output_data(&result), result.output_size);
+
         if (result.release != nullptr)
             result.release(&result);
     }
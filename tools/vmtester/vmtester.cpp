@@ -2,13 +2,26 @@
 // Copyright 2018 The EVMC Authors.
 // Licensed under the Apache License, Version 2.0.
 
+#include "perf.hpp"
 #include "vmtester.hpp"
 #include <evmc/evmc.hpp>
 #include <evmc/loader.h>
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
+#include <map>
 
 evmc::VM evmc_vm_test::owned_vm;
 
+/// The command line option: the name, the name of the value (empty for flags)
+/// and the description.
+struct cli_option
+{
+    std::string name;
+    std::string value_name;
+    std::string description;
+};
+
 class cli_parser
 {
 public:
@@ -16,14 +29,20 @@ public:
     const char* const application_version = nullptr;
 
     std::vector<std::string> arguments_names;
+    std::vector<cli_option> options_specs;
     std::vector<std::string> arguments;
 
+    /// The values of the provided options by the names. Empty for flags.
+    std::map<std::string, std::string> options;
+
     cli_parser(const char* app_name,
                const char* app_version,
-               std::vector<std::string> args_names) noexcept
+               std::vector<std::string> args_names,
+               std::vector<cli_option> opts_specs = {}) noexcept
       : application_name{app_name},
         application_version{app_version},
-        arguments_names{std::move(args_names)}
+        arguments_names{std::move(args_names)},
+        options_specs{std::move(opts_specs)}
     {
         arguments.reserve(this->arguments_names.size());
     }
@@ -31,7 +50,8 @@ public:
     /// Parses the command line arguments.
     ///
     /// It recognize --help and --version options and output for these is sent
-    /// to the @p out output stream.
+    /// to the @p out output stream. The other options are given either as --name=value
+    /// or as --name value.
     /// Errors are sent to the @p err output stream.
     ///
     /// @return Negative value in case of error,
@@ -72,6 +92,33 @@ public:
                     help = true;
                     continue;
                 }
+
+                const auto eq = arg.find('=');
+                const auto name = arg.substr(0, eq);
+                const auto spec = std::find_if(options_specs.begin(), options_specs.end(),
+                                               [&](const auto& o) { return o.name == name; });
+                if (spec != options_specs.end())
+                {
+                    if (spec->value_name.empty() && eq == std::string::npos)
+                    {
+                        options[name];
+                        continue;
+                    }
+                    if (!spec->value_name.empty())
+                    {
+                        if (eq != std::string::npos)
+                            options[name] = arg.substr(eq + 1);
+                        else if (i + 1 < argc)
+                            options[name] = argv[++i];
+                        else
+                        {
+                            err << "The option \"" << argv[i] << "\" requires "
+                                << spec->value_name << "\n";
+                            return -1;
+                        }
+                        continue;
+                    }
+                }
             }
 
             err << "Unknown option \"" << argv[i] << "\"\n";
@@ -86,6 +133,17 @@ public:
             for (const auto& name : arguments_names)
                 out << " " << name;
             out << "\n";
+            if (!options_specs.empty())
+            {
+                out << "Options:\n";
+                for (const auto& o : options_specs)
+                {
+                    auto usage = "--" + o.name;
+                    if (!o.value_name.empty())
+                        usage += " " + o.value_name;
+                    out << "  " << std::left << std::setw(24) << usage << o.description << "\n";
+                }
+            }
             return 0;
         }
 
@@ -110,7 +168,16 @@ int main(int argc, char* argv[])
     {
         testing::InitGoogleTest(&argc, argv);
 
-        auto cli = cli_parser{"EVMC VM Tester", PROJECT_VERSION, {"MODULE"}};
+        auto cli = cli_parser{
+            "EVMC VM Tester",
+            PROJECT_VERSION,
+            {"MODULE"},
+            {
+                {"perf", "", "Run the performance conformance mode instead of the ABI tests"},
+                {"baseline", "FILE", "Compare the performance with the baseline file"},
+                {"save-baseline", "FILE", "Save the performance results as the baseline file"},
+                {"tolerance", "PERCENT", "The slowdown not reported as regression (default 10)"},
+            }};
 
         const auto error_code = cli.parse(argc, argv, std::cout, std::cerr);
         if (error_code <= 0)
@@ -131,6 +198,20 @@ int main(int argc, char* argv[])
             return static_cast<int>(ec);
         }
 
+        if (!cli.options.empty())
+        {
+            evmc::vmtester::PerfOptions perf_options;
+            if (const auto it = cli.options.find("baseline"); it != cli.options.end())
+                perf_options.baseline = it->second;
+            if (const auto it = cli.options.find("save-baseline"); it != cli.options.end())
+                perf_options.save_baseline = it->second;
+            if (const auto it = cli.options.find("tolerance"); it != cli.options.end())
+                perf_options.tolerance = std::stod(it->second);
+
+            std::cout << std::endl;
+            return evmc::vmtester::run_perf(vm, perf_options, std::cout);
+        }
+
         evmc_vm_test::set_vm(std::move(vm));
 
         std::cout << std::endl;